@@ -0,0 +1,60 @@
+// Compile-time benchmark: instantiates expression trees of configurable depth.
+//
+// Every level produces a new `Expr::Binary`/`Expr::Unary` type, so the number
+// of trait checks (`Traits::Expr::is_valid_v`, `Traits::Op::is_valid_v`,
+// `Traits::Core::is_valid_v`) grows linearly with `SGLTY_BENCH_DEPTH`, and the
+// number of distinct trees with `SGLTY_BENCH_WIDTH`.
+//
+// Built by `Bench/compile_time.sh`; the resulting binary is never run.
+
+#include "Singularity/Lib.hpp"
+#include "Singularity/Convenience.hpp"
+
+#ifndef SGLTY_BENCH_DEPTH
+#define SGLTY_BENCH_DEPTH 32
+#endif
+
+#ifndef SGLTY_BENCH_WIDTH
+#define SGLTY_BENCH_WIDTH 8
+#endif
+
+namespace {
+
+template <std::size_t _seed>
+using Mat = Sglty::DenseMat<float, 4 + _seed % 3, 4 + _seed % 3>;
+
+// Alternates the node kinds so every level exercises a different op trait.
+// Each level adds one node on top of `_e`, so type names grow linearly.
+template <std::size_t _depth, typename _expr, typename _leaf>
+constexpr auto Deep(const _expr& _e, const _leaf& _a) {
+  if constexpr (_depth == 0) {
+    return _e;
+  } else if constexpr (_depth % 4 == 0) {
+    return Deep<_depth - 1>(_e * _a, _a);
+  } else if constexpr (_depth % 4 == 1) {
+    return Deep<_depth - 1>(_e + _a, _a);
+  } else if constexpr (_depth % 4 == 2) {
+    return Deep<_depth - 1>(-_e, _a);
+  } else {
+    return Deep<_depth - 1>(Sglty::Op::Alg::Trp(_e), _a);
+  }
+}
+
+template <std::size_t _seed>
+float Tree() {
+  Mat<_seed> a(static_cast<float>(_seed));
+  Mat<_seed> r = Deep<SGLTY_BENCH_DEPTH>(a, a);
+  return r(0, 0);
+}
+
+template <std::size_t... _seeds>
+float Forest(std::index_sequence<_seeds...>) {
+  return (Tree<_seeds>() + ...);
+}
+
+}  // namespace
+
+int main() {
+  return static_cast<int>(
+      Forest(std::make_index_sequence<SGLTY_BENCH_WIDTH>{}));
+}
@@ -0,0 +1,60 @@
+#!/usr/bin/env bash
+# Measures compile time and peak compiler memory for deep expression trees.
+#
+# Usage: Bench/compile_time.sh [depth...]
+#
+# Environment:
+#   CXX       compiler to benchmark (default: c++)
+#   WIDTH     number of independent trees per translation unit (default: 8)
+#   STANDARDS space-separated list of -std values (default: "c++17 c++20")
+#
+# For each depth and standard the script prints wall time and peak resident
+# memory of the compiler. C++20 runs use the concept-based trait layer; the
+# `c++20-noconcepts` row forces the C++17 fallback under the same standard so
+# the two trait implementations can be compared directly.
+
+set -euo pipefail
+
+root="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+src="${root}/Bench/CompileTime/DeepExpr.cpp"
+cxx="${CXX:-c++}"
+width="${WIDTH:-8}"
+standards="${STANDARDS:-c++17 c++20}"
+depths=("$@")
+if [ "${#depths[@]}" -eq 0 ]; then
+  depths=(8 16 32 64)
+fi
+
+out="$(mktemp -d)"
+trap 'rm -rf "${out}"' EXIT
+
+measure() {
+  local label="$1" depth="$2"
+  shift 2
+  local flags=(-I"${root}" -O0 -c "${src}" -o "${out}/bench.o"
+               -DSGLTY_BENCH_DEPTH="${depth}" -DSGLTY_BENCH_WIDTH="${width}"
+               "$@")
+  if [ -x /usr/bin/time ]; then
+    /usr/bin/time -f "%e %M" -o "${out}/time" "${cxx}" "${flags[@]}"
+    read -r secs kb < "${out}/time"
+  else
+    local start end ms
+    start="$(date +%s%N)"
+    "${cxx}" "${flags[@]}"
+    end="$(date +%s%N)"
+    ms=$(( (end - start) / 1000000 ))
+    secs="$(printf "%d.%03d" $(( ms / 1000 )) $(( ms % 1000 )))"
+    kb="n/a"
+  fi
+  printf "%-18s %6s %10s %12s\n" "${label}" "${depth}" "${secs}" "${kb}"
+}
+
+printf "%-18s %6s %10s %12s\n" "mode" "depth" "seconds" "peak-KB"
+for depth in "${depths[@]}"; do
+  for std in ${standards}; do
+    measure "${std}" "${depth}" -std="${std}"
+    if [ "${std}" = "c++20" ]; then
+      measure "${std}-noconcepts" "${depth}" -std="${std}" -DSGLTY_NO_CONCEPTS
+    fi
+  done
+done
@@ -0,0 +1,104 @@
+#pragma once
+
+/**
+ * @brief Library-wide configuration switches.
+ *
+ * Define the `SGLTY_ENABLE_*` and `SGLTY_NO_*` switches on the command line
+ * (or before the first Singularity include) so every translation unit sees
+ * the same configuration.
+ *
+ * - `SGLTY_HAS_CONCEPTS` is `1` when the compiler supports C++20 concepts.
+ *   The trait layer is then expressed with `concept`s, which the compiler
+ *   caches per type and which are cheaper to check than the C++17
+ *   `std::void_t` specializations used otherwise. Define `SGLTY_NO_CONCEPTS`
+ *   to force the C++17 fallback (useful for comparing build times).
+ *
+ * - `SGLTY_ENABLE_TRACE` turns on runtime instrumentation of evaluations.
+ *   See `Singularity/Instr/Trace.hpp`.
+ *
+ * - `SGLTY_ENABLE_CBLAS` registers and selects the CBLAS adapter of
+ *   `Singularity/Kernel/Cblas.hpp`, so large `float` and `double` products
+ *   go to the system BLAS; link it (e.g. `-lopenblas`). `SGLTY_CBLAS_HEADER`
+ *   and `SGLTY_CBLAS_INT` override the header and the index type.
+ *
+ * - `SGLTY_IS_CONSTANT_EVALUATED()` is true while the enclosing function is
+ *   being constant evaluated. Runtime kernels (heap buffers, threads) are only
+ *   dispatched when it is false. Without C++20 or a compiler builtin it is
+ *   always true, so evaluation stays on the `constexpr` scalar path.
+ *
+ * - `SGLTY_HAS_VECTOR_EXTENSIONS` is `1` when the compiler supports the GCC
+ *   `vector_size` attribute (GCC and Clang). `Types::Lanes` then stores its
+ *   lanes as a native vector, so each lane-wise operation is a single SIMD
+ *   expression even at `-O2`. Define `SGLTY_NO_VECTOR_EXTENSIONS` to use
+ *   plain arrays and loops instead.
+ *
+ * - `SGLTY_HAS_MULTIVERSIONING` is `1` with GCC on x86-64. The vectorized
+ *   kernels are then compiled for AVX2 and AVX-512 as well as for the build
+ *   flags, and the variant is chosen from CPUID at run time. See
+ *   `Singularity/Kernel/Isa.hpp`. Define `SGLTY_NO_MULTIVERSIONING` to only
+ *   use the build flags.
+ *
+ * - `SGLTY_ENABLE_X86_KERNELS` compiles the hand-written x86 kernels
+ *   (transposes, half and bfloat16 conversions, int8 dot products, square
+ *   roots) with the `<immintrin.h>` intrinsics. That header declares every
+ *   intrinsic of every extension, about 45k lines, so the kernels are
+ *   opt-in; without them the same operations run portable loops, which the
+ *   multiversioned variants still vectorize. `SGLTY_HAS_X86_KERNELS` is `1`
+ *   when the switch is defined and the target is x86 with SSE2.
+ *
+ * - `SGLTY_HAS_MDSPAN` is `1` when the standard library provides
+ *   `std::mdspan`. `Core::Map` can then be constructed from an `mdspan` and
+ *   `Matrix::AsMdspan()` exposes dense storage as one.
+ */
+
+#if !defined(SGLTY_NO_CONCEPTS) && defined(__cpp_concepts) && \
+    __cpp_concepts >= 201907L && __has_include(<concepts>)
+#define SGLTY_HAS_CONCEPTS 1
+#else
+#define SGLTY_HAS_CONCEPTS 0
+#endif
+
+#if __cplusplus >= 202002L
+#include <type_traits>
+#define SGLTY_IS_CONSTANT_EVALUATED() std::is_constant_evaluated()
+#elif defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define SGLTY_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+#endif
+
+#ifndef SGLTY_IS_CONSTANT_EVALUATED
+#define SGLTY_IS_CONSTANT_EVALUATED() true
+#endif
+
+#if !defined(SGLTY_NO_VECTOR_EXTENSIONS) && defined(__GNUC__)
+#define SGLTY_HAS_VECTOR_EXTENSIONS 1
+#else
+#define SGLTY_HAS_VECTOR_EXTENSIONS 0
+#endif
+
+#if !defined(SGLTY_NO_MULTIVERSIONING) && defined(__GNUC__) && \
+    !defined(__clang__) && defined(__x86_64__)
+#define SGLTY_HAS_MULTIVERSIONING 1
+#else
+#define SGLTY_HAS_MULTIVERSIONING 0
+#endif
+
+#if defined(SGLTY_ENABLE_X86_KERNELS) && defined(__SSE2__) && \
+    (defined(__x86_64__) || defined(__i386__))
+#define SGLTY_HAS_X86_KERNELS 1
+#else
+#define SGLTY_HAS_X86_KERNELS 0
+#endif
+
+#if __has_include(<version>)
+#include <version>
+#endif
+#if defined(__cpp_lib_mdspan) && __cpp_lib_mdspan >= 202207L
+#include <mdspan>
+#define SGLTY_HAS_MDSPAN 1
+#else
+#define SGLTY_HAS_MDSPAN 0
+#endif
+
+// Singularity/Config.hpp
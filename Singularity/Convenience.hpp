@@ -2,21 +2,7 @@
 
 #include <cstddef>
 
-#include "Core/Enums.hpp"
-
-namespace Sglty::Core {
-
-template <typename, std::size_t, std::size_t, Major>
-class Dense;
-
-}  // namespace Sglty::Core
-
-namespace Sglty::Types {
-
-template <typename>
-class Matrix;
-
-}  // namespace Sglty::Types
+#include "Fwd.hpp"
 
 namespace Sglty {
 
@@ -48,6 +34,141 @@ template <typename _Tp,
 using DenseMat =
     Sglty::Types::Matrix<Sglty::Core::Dense<_Tp, _rows, _cols, _core_major>>;
 
+/**
+ * @brief Convenience alias for a heap-backed dense matrix.
+ *
+ * Storage comes from `Mem::Allocator`, i.e. the thread's pool or the active
+ * arena. Requires `Singularity/Core/Heap.hpp`.
+ *
+ * Example:
+ * ```cpp
+ * HeapMat<float, 1024, 1024> big;  // no stack usage, O(1) moves
+ * ```
+ *
+ * @tparam _Tp         Value type (e.g., float, int, etc.)
+ * @tparam _rows       Number of rows (must be > 0)
+ * @tparam _cols       Number of columns (must be > 0)
+ * @tparam _core_major Memory layout (row-major or column-major)
+ */
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major = Core::Major::Row>
+using HeapMat = Sglty::Types::Matrix<
+    Sglty::Core::Heap<_Tp, _rows, _cols, _core_major, Mem::Allocator<_Tp>>>;
+
+/**
+ * @brief Convenience alias for a dense matrix with a padded, aligned leading
+ * dimension.
+ *
+ * Requires `Singularity/Core/Padded.hpp`.
+ *
+ * Example:
+ * ```cpp
+ * PaddedMat<float, 512, 512> a;  // rows 528 floats apart, 64-byte aligned
+ * ```
+ *
+ * @tparam _Tp           Value type (e.g., float, int, etc.)
+ * @tparam _rows         Number of rows (must be > 0)
+ * @tparam _cols         Number of columns (must be > 0)
+ * @tparam _core_major   Memory layout (row-major by default)
+ * @tparam _align        Alignment of every row or column, in bytes
+ * @tparam _outer_stride Elements between rows (row-major) or columns
+ * (column-major); `0` to pick one automatically
+ */
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major   = Core::Major::Row,
+          std::size_t _align        = 64,
+          std::size_t _outer_stride = 0>
+using PaddedMat = Sglty::Types::Matrix<Sglty::Core::Padded<_Tp,
+                                                           _rows,
+                                                           _cols,
+                                                           _core_major,
+                                                           _align,
+                                                           _outer_stride>>;
+
+/**
+ * @brief Convenience alias for a heap-backed matrix whose copies share their
+ * storage until one of them is written (copy-on-write).
+ *
+ * Requires `Singularity/Core/Shared.hpp`.
+ *
+ * Example:
+ * ```cpp
+ * SharedMat<float, 1024, 1024> a;
+ * auto b = a;  // O(1); b copies the elements at its first write
+ * ```
+ *
+ * @tparam _Tp         Value type (e.g., float, int, etc.)
+ * @tparam _rows       Number of rows (must be > 0)
+ * @tparam _cols       Number of columns (must be > 0)
+ * @tparam _core_major Memory layout (row-major or column-major)
+ */
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major = Core::Major::Row>
+using SharedMat = Sglty::Types::Matrix<
+    Sglty::Core::Shared<_Tp, _rows, _cols, _core_major, Mem::Allocator<_Tp>>>;
+
+/**
+ * @brief Convenience alias for a matrix backed by a memory-mapped file.
+ *
+ * Requires `Singularity/Core/Mapped.hpp`.
+ *
+ * Example:
+ * ```cpp
+ * MappedMat<float, 1024, 1024> w("weights.bin");
+ * ```
+ *
+ * @tparam _Tp         Value type stored in the file
+ * @tparam _rows       Number of rows (must be > 0)
+ * @tparam _cols       Number of columns (must be > 0)
+ * @tparam _core_major Memory layout of the file (row-major by default)
+ * @tparam _mode       Read-only (default) or private copy-on-write pages
+ */
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major = Core::Major::Row,
+          Core::MapMode _mode     = Core::MapMode::ReadOnly>
+using MappedMat = Sglty::Types::Matrix<
+    Sglty::Core::Mapped<_Tp, _rows, _cols, _core_major, _mode>>;
+
+/**
+ * @brief Convenience alias for a matrix viewing externally owned memory.
+ *
+ * Example:
+ * ```cpp
+ * MapMat<const float, 64, 64> m(buffer);  // read-only view of `buffer`
+ * ```
+ *
+ * Requires `Singularity/Core/Map.hpp`.
+ *
+ * @tparam _Tp           Value type of the viewed elements (`const` to forbid
+ * writes)
+ * @tparam _rows         Number of rows (must be > 0)
+ * @tparam _cols         Number of columns (must be > 0)
+ * @tparam _core_major   Memory layout (row-major by default)
+ * @tparam _outer_stride Elements between rows (row-major) or columns
+ * (column-major); `0` for packed
+ * @tparam _inner_stride Elements between neighbours within a row or column
+ */
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major   = Core::Major::Row,
+          std::size_t _outer_stride = 0,
+          std::size_t _inner_stride = 1>
+using MapMat = Sglty::Types::Matrix<Sglty::Core::Map<_Tp,
+                                                     _rows,
+                                                     _cols,
+                                                     _core_major,
+                                                     _outer_stride,
+                                                     _inner_stride>>;
+
 }  // namespace Sglty
 
 // Singularity/Convenience.hpp
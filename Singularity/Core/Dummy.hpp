@@ -70,6 +70,18 @@ struct Dummy {
   template <std::size_t, std::size_t>
   using core_rebind_size = Dummy;
 
+  /**
+   * @brief Rebinds to another Dummy regardless of value type.
+   */
+  template <typename>
+  using core_rebind_value = Dummy;
+
+  /**
+   * @brief Rebinds to another Dummy regardless of layout.
+   */
+  template <Sglty::Core::Major>
+  using core_rebind_major = Dummy;
+
   /**
    * @brief Accesses the single dummy element.
    *
@@ -33,6 +33,21 @@ enum class Major {
   Undefined
 };
 
+/**
+ * @brief Enum describing how a file-backed core maps its file.
+ *
+ * Used by `Sglty::Core::Mapped`.
+ */
+enum class MapMode {
+  /// Pages are shared with the page cache; the core hands out only const
+  /// references and pointers.
+  ReadOnly,
+
+  /// Pages are shared until written; writes stay private to the core (copies
+  /// of it included) and never reach the file.
+  CopyOnWrite
+};
+
 }  // namespace Sglty::Core
 
 // Singularity/Core/Enums.hpp
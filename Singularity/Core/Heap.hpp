@@ -0,0 +1,228 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#include "Enums.hpp"
+#include "../Mem/Allocator.hpp"
+#include "../Traits/Type.hpp"
+#include "../Traits/Size.hpp"
+#include "../Traits/Core.hpp"
+
+namespace Sglty::Core {
+
+/**
+ * @brief Selects the `Heap` constructor that leaves the elements
+ * default-initialized, for storage whose every element is written next.
+ */
+struct Uninitialized {};
+
+/**
+ * @brief Fixed-size dense core with allocator-managed heap storage.
+ *
+ * Behaves like `Dense` but keeps its elements in a buffer obtained from
+ * `_Alloc`, so large matrices do not live on the stack and moves are O(1).
+ * With the default `Mem::Allocator`, storage comes from the calling thread's
+ * `Mem::LocalPool()`, or from an arena while a `Mem::ArenaScope` is active,
+ * which makes repeated temporaries of the same shape free of system
+ * allocations.
+ *
+ * All rebinds keep the allocator (rebound to the new value type with
+ * `std::allocator_traits`), so expression results, `Cast()` and `Reorder()`
+ * stay heap-backed. Any standard-conforming allocator can be used; with one
+ * whose `Mem::parallel_first_touch_v` is true (e.g. `Mem::PagedAllocator`
+ * with `Mem::Numa::FirstTouch`), new storage is initialized in parallel.
+ *
+ * Example Usage:
+ * ```
+ * Sglty::Types::Matrix<Sglty::Core::Heap<float, 512, 512, Major::Row>> a, b;
+ * auto c = Sglty::Evaluate(a * b);  // storage from the thread's pool
+ * ```
+ *
+ * @tparam _Tp         The scalar element type.
+ * @tparam _rows       The number of rows in the matrix.
+ * @tparam _cols       The number of columns in the matrix.
+ * @tparam _core_major The memory layout (row-major or column-major).
+ * @tparam _Alloc      The allocator; rebound to `_Tp` if needed.
+ */
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc = Mem::Allocator<_Tp>>
+class Heap {
+ public:
+  /// Type traits for the matrix element type.
+  using type_traits = Traits::Type::Get<_Tp>;
+
+  using size_type       = typename type_traits::size_type;
+  using value_type      = typename type_traits::value_type;
+  using difference_type = typename type_traits::difference_type;
+  using reference       = typename type_traits::reference;
+  using const_reference = typename type_traits::const_reference;
+  using pointer         = typename type_traits::pointer;
+  using const_pointer   = typename type_traits::const_pointer;
+
+  /// The allocator, rebound to the element type.
+  using allocator_type =
+      typename std::allocator_traits<_Alloc>::template rebind_alloc<_Tp>;
+
+  /// Size traits defining row and column dimensions.
+  using size_traits = Traits::Size::Get<_rows, _cols, size_type>;
+
+  /// Core trait describing layout and type identity.
+  using core_traits = Traits::Core::Get<Core::Type::Dense, _core_major>;
+
+  /// Expression nodes hold this core's matrices by reference; see
+  /// `Traits::Core::is_held_by_reference_v`.
+  constexpr static bool core_held_by_reference = true;
+
+  /**
+   * @brief Rebinds the Heap core to a new size, keeping the allocator.
+   *
+   * @tparam _rebind_rows New row count.
+   * @tparam _rebind_cols New column count.
+   */
+  template <size_type _rebind_rows, size_type _rebind_cols>
+  using core_rebind_size = Heap<_Tp,
+                                _rebind_rows,
+                                _rebind_cols,
+                                core_traits::core_major,
+                                allocator_type>;
+
+  /**
+   * @brief Rebinds the Heap core to a new value type, keeping the allocator.
+   *
+   * @tparam _rebind_value The new value type.
+   */
+  template <typename _rebind_value>
+  using core_rebind_value =
+      Heap<_rebind_value,
+           _rows,
+           _cols,
+           core_traits::core_major,
+           typename std::allocator_traits<
+               allocator_type>::template rebind_alloc<_rebind_value>>;
+
+  /**
+   * @brief Rebinds the Heap core to a different layout, keeping the
+   * allocator.
+   *
+   * @tparam _rebind_major The new layout.
+   */
+  template <Core::Major _rebind_major>
+  using core_rebind_major =
+      Heap<_Tp, _rows, _cols, _rebind_major, allocator_type>;
+
+  /**
+   * @brief Alias to a zero-sized base version of Heap with the same layout
+   * and allocator.
+   */
+  using core_base = Heap<_Tp, 0, 0, core_traits::core_major, allocator_type>;
+
+  /**
+   * @brief Allocates zero-initialized storage from a default-constructed
+   * allocator.
+   */
+  Heap();
+
+  /**
+   * @brief Allocates storage with every element set to a value.
+   *
+   * @param val The value to fill every element with.
+   */
+  Heap(value_type val);
+
+  /**
+   * @brief Allocates zero-initialized storage from the given allocator.
+   *
+   * @param _alloc The allocator to use.
+   */
+  explicit Heap(const allocator_type& _alloc);
+
+  /**
+   * @brief Allocates default-initialized storage (indeterminate values for
+   * arithmetic types) from the given allocator. Storage is still
+   * zero-initialized in parallel if `Mem::parallel_first_touch_v` holds.
+   *
+   * @param _alloc The allocator to use.
+   */
+  Heap(const allocator_type& _alloc, Uninitialized);
+
+  /**
+   * @brief Copies the elements into storage from
+   * `select_on_container_copy_construction()` of the source's allocator.
+   * A copy of a moved-from matrix has no storage either.
+   */
+  Heap(const Heap& _other);
+
+  /**
+   * @brief Takes over the storage and allocator of `_other`, which is left
+   * without storage and may only be destroyed, copied or assigned to.
+   */
+  Heap(Heap&& _other) noexcept;
+
+  /**
+   * @brief Copies the elements; the allocator is kept. Assigning a
+   * moved-from matrix releases the storage.
+   */
+  Heap& operator=(const Heap& _other);
+
+  /**
+   * @brief Takes over the storage of `_other` if both allocators are equal,
+   * copies the elements otherwise.
+   */
+  Heap& operator=(Heap&& _other);
+
+  ~Heap();
+
+  /**
+   * @brief Accesses a mutable reference to the element at (_row, _col).
+   *
+   * @param _row The row index (zero-based).
+   * @param _col The column index (zero-based).
+   * @return Reference to the element.
+   */
+  reference At(const size_type _row, const size_type _col);
+
+  /**
+   * @brief Accesses a read-only reference to the element at (_row, _col).
+   *
+   * @param _row The row index (zero-based).
+   * @param _col The column index (zero-based).
+   * @return Const reference to the element.
+   */
+  const_reference At(const size_type _row, const size_type _col) const;
+
+  /**
+   * @brief Returns a raw pointer to the underlying storage.
+   *
+   * @return Mutable pointer to the matrix data.
+   */
+  pointer Data();
+
+  /**
+   * @brief Returns a const raw pointer to the underlying storage.
+   *
+   * @return Const pointer to the matrix data.
+   */
+  const_pointer Data() const;
+
+  /// Returns a copy of the allocator.
+  allocator_type GetAllocator() const;
+
+ private:
+  constexpr static size_type size = _rows * _cols;
+
+  allocator_type _m_alloc;
+  pointer _m_data = nullptr;
+
+  void _m_Allocate(bool _value_init = true);
+  void _m_Deallocate();
+};
+
+}  // namespace Sglty::Core
+
+#include "Impl/Heap.tpp"
+
+// Singularity/Core/Heap.hpp
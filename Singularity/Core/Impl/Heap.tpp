@@ -0,0 +1,226 @@
+#pragma once
+
+#include "../Heap.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+#include "../../Exec/Parallel.hpp"
+
+namespace Sglty::Core {
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc>
+Heap<_Tp, _rows, _cols, _core_major, _Alloc>::Heap() {
+  _m_Allocate();
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc>
+Heap<_Tp, _rows, _cols, _core_major, _Alloc>::Heap(value_type val) {
+  _m_Allocate();
+  std::fill_n(_m_data, size, val);
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc>
+Heap<_Tp, _rows, _cols, _core_major, _Alloc>::Heap(const allocator_type& _alloc)
+    : _m_alloc(_alloc) {
+  _m_Allocate();
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc>
+Heap<_Tp, _rows, _cols, _core_major, _Alloc>::Heap(const allocator_type& _alloc,
+                                                   Uninitialized)
+    : _m_alloc(_alloc) {
+  _m_Allocate(false);
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc>
+Heap<_Tp, _rows, _cols, _core_major, _Alloc>::Heap(const Heap& _other)
+    : _m_alloc(std::allocator_traits<allocator_type>::
+                   select_on_container_copy_construction(_other._m_alloc)) {
+  if (_other._m_data) {
+    _m_Allocate();
+    std::copy_n(_other._m_data, size, _m_data);
+  }
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc>
+Heap<_Tp, _rows, _cols, _core_major, _Alloc>::Heap(Heap&& _other) noexcept
+    : _m_alloc(_other._m_alloc),
+      _m_data(std::exchange(_other._m_data, nullptr)) {}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc>
+Heap<_Tp, _rows, _cols, _core_major, _Alloc>&
+Heap<_Tp, _rows, _cols, _core_major, _Alloc>::operator=(const Heap& _other) {
+  if (this == &_other) {
+    return *this;
+  }
+  if (!_other._m_data) {
+    _m_Deallocate();
+    return *this;
+  }
+  if (!_m_data) {
+    _m_Allocate();
+  }
+  std::copy_n(_other._m_data, size, _m_data);
+  return *this;
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc>
+Heap<_Tp, _rows, _cols, _core_major, _Alloc>&
+Heap<_Tp, _rows, _cols, _core_major, _Alloc>::operator=(Heap&& _other) {
+  if (this == &_other) {
+    return *this;
+  }
+  if (_m_alloc == _other._m_alloc) {
+    _m_Deallocate();
+    _m_data = std::exchange(_other._m_data, nullptr);
+  } else {
+    *this = std::as_const(_other);
+  }
+  return *this;
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc>
+Heap<_Tp, _rows, _cols, _core_major, _Alloc>::~Heap() {
+  _m_Deallocate();
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc>
+typename Heap<_Tp, _rows, _cols, _core_major, _Alloc>::reference
+Heap<_Tp, _rows, _cols, _core_major, _Alloc>::At(const size_type _row,
+                                                 const size_type _col) {
+  return const_cast<reference>(std::as_const(*this).At(_row, _col));
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc>
+typename Heap<_Tp, _rows, _cols, _core_major, _Alloc>::const_reference
+Heap<_Tp, _rows, _cols, _core_major, _Alloc>::At(const size_type _row,
+                                                 const size_type _col) const {
+  if constexpr (core_traits::core_major == Core::Major::Row) {
+    return _m_data[_row * _cols + _col];
+  } else {
+    return _m_data[_col * _rows + _row];
+  }
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc>
+typename Heap<_Tp, _rows, _cols, _core_major, _Alloc>::pointer
+Heap<_Tp, _rows, _cols, _core_major, _Alloc>::Data() {
+  return _m_data;
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc>
+typename Heap<_Tp, _rows, _cols, _core_major, _Alloc>::const_pointer
+Heap<_Tp, _rows, _cols, _core_major, _Alloc>::Data() const {
+  return _m_data;
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc>
+typename Heap<_Tp, _rows, _cols, _core_major, _Alloc>::allocator_type
+Heap<_Tp, _rows, _cols, _core_major, _Alloc>::GetAllocator() const {
+  return _m_alloc;
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc>
+void Heap<_Tp, _rows, _cols, _core_major, _Alloc>::_m_Allocate(
+    bool _value_init) {
+  if constexpr (size != 0) {
+    using traits = std::allocator_traits<allocator_type>;
+
+    _m_data = traits::allocate(_m_alloc, size);
+
+    if constexpr (Mem::parallel_first_touch_v<allocator_type>) {
+      constexpr size_type outer =
+          core_traits::core_major == Core::Major::Row ? _rows : _cols;
+      constexpr size_type inner = size / outer;
+
+      Exec::ParallelFor(0, outer, [&](std::size_t lo, std::size_t hi) {
+        std::uninitialized_value_construct_n(_m_data + lo * inner,
+                                             (hi - lo) * inner);
+      });
+    } else if (_value_init) {
+      std::uninitialized_value_construct_n(_m_data, size);
+    } else {
+      std::uninitialized_default_construct_n(_m_data, size);
+    }
+  }
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc>
+void Heap<_Tp, _rows, _cols, _core_major, _Alloc>::_m_Deallocate() {
+  if (_m_data) {
+    std::destroy_n(_m_data, size);
+    std::allocator_traits<allocator_type>::deallocate(_m_alloc, _m_data, size);
+    _m_data = nullptr;
+  }
+}
+
+}  // namespace Sglty::Core
+
+// Singularity/Core/Impl/Heap.tpp
@@ -0,0 +1,134 @@
+#pragma once
+
+#include "../Map.hpp"
+
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace Sglty::Core {
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          std::size_t _outer_stride,
+          std::size_t _inner_stride>
+constexpr Map<_Tp, _rows, _cols, _core_major, _outer_stride, _inner_stride>::
+    Map(pointer _data)
+    : _m_data(_data) {}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          std::size_t _outer_stride,
+          std::size_t _inner_stride>
+constexpr Map<_Tp, _rows, _cols, _core_major, _outer_stride, _inner_stride>&
+Map<_Tp, _rows, _cols, _core_major, _outer_stride, _inner_stride>::operator=(
+    const Map& _other) {
+  static_assert(!std::is_const_v<_Tp>,
+                "Error: cannot assign into a map over const elements.");
+
+  if (_m_data != _other._m_data) {
+    for (size_type i = 0; i < _rows; i++) {
+      for (size_type j = 0; j < _cols; j++) {
+        At(i, j) = _other.At(i, j);
+      }
+    }
+  }
+  return *this;
+}
+
+#if SGLTY_HAS_MDSPAN
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          std::size_t _outer_stride,
+          std::size_t _inner_stride>
+template <typename _Up, typename _extents, typename _layout>
+constexpr Map<_Tp, _rows, _cols, _core_major, _outer_stride, _inner_stride>::
+    Map(std::mdspan<_Up, _extents, _layout> _span)
+    : _m_data(_span.data_handle()) {
+  static_assert(_extents::rank() == 2, "Error: `mdspan` must be of rank 2.");
+  static_assert((_extents::static_extent(0) == std::dynamic_extent ||
+                 _extents::static_extent(0) == _rows) &&
+                    (_extents::static_extent(1) == std::dynamic_extent ||
+                     _extents::static_extent(1) == _cols),
+                "Error: dimension mismatch between `mdspan` and `Map`.");
+  static_assert(std::is_convertible_v<_Up*, pointer>,
+                "Error: cannot view `mdspan` elements through `pointer`.");
+
+  if (_span.extent(0) != _rows || _span.extent(1) != _cols) {
+    throw std::runtime_error(
+        "Error: dimension mismatch between `mdspan` and `Map`.");
+  }
+  if (_span.stride(0) != core_row_stride ||
+      _span.stride(1) != core_col_stride) {
+    throw std::runtime_error(
+        "Error: stride mismatch between `mdspan` and `Map`.");
+  }
+}
+#endif
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          std::size_t _outer_stride,
+          std::size_t _inner_stride>
+constexpr
+    typename Map<_Tp, _rows, _cols, _core_major, _outer_stride, _inner_stride>::
+        reference
+        Map<_Tp, _rows, _cols, _core_major, _outer_stride, _inner_stride>::At(
+            const size_type _row, const size_type _col) {
+  return _m_data[_row * core_row_stride + _col * core_col_stride];
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          std::size_t _outer_stride,
+          std::size_t _inner_stride>
+constexpr
+    typename Map<_Tp, _rows, _cols, _core_major, _outer_stride, _inner_stride>::
+        const_reference
+        Map<_Tp, _rows, _cols, _core_major, _outer_stride, _inner_stride>::At(
+            const size_type _row, const size_type _col) const {
+  return _m_data[_row * core_row_stride + _col * core_col_stride];
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          std::size_t _outer_stride,
+          std::size_t _inner_stride>
+constexpr
+    typename Map<_Tp, _rows, _cols, _core_major, _outer_stride, _inner_stride>::
+        pointer
+        Map<_Tp, _rows, _cols, _core_major, _outer_stride, _inner_stride>::
+            Data() {
+  return _m_data;
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          std::size_t _outer_stride,
+          std::size_t _inner_stride>
+constexpr
+    typename Map<_Tp, _rows, _cols, _core_major, _outer_stride, _inner_stride>::
+        const_pointer
+        Map<_Tp, _rows, _cols, _core_major, _outer_stride, _inner_stride>::
+            Data() const {
+  return _m_data;
+}
+
+}  // namespace Sglty::Core
+
+// Singularity/Core/Impl/Map.tpp
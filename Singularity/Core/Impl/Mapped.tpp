@@ -0,0 +1,265 @@
+#pragma once
+
+#include "../Mapped.hpp"
+
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "../../IO/Format.hpp"
+
+namespace Sglty::Core {
+
+namespace Impl {
+
+/// Owns one `mmap` region; unmapped when the last `Mapped` copy goes away.
+struct Mapping {
+  void* addr         = nullptr;
+  std::size_t length = 0;
+
+  Mapping(void* _addr, std::size_t _length) : addr(_addr), length(_length) {}
+
+  Mapping(const Mapping&)            = delete;
+  Mapping& operator=(const Mapping&) = delete;
+
+  ~Mapping() {
+    ::munmap(addr, length);
+  }
+};
+
+inline std::shared_ptr<const Mapping> MapFile(const std::string& _path,
+                                              Core::MapMode _mode) {
+  const int fd = ::open(_path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    throw std::system_error(
+        errno, std::generic_category(), "Error: cannot open `" + _path + "`");
+  }
+
+  struct stat st {};
+  if (::fstat(fd, &st) != 0) {
+    const int err = errno;
+    ::close(fd);
+    throw std::system_error(
+        err, std::generic_category(), "Error: cannot stat `" + _path + "`");
+  }
+
+  const std::size_t length = static_cast<std::size_t>(st.st_size);
+  if (length < sizeof(IO::RawHeader)) {
+    ::close(fd);
+    throw std::runtime_error("Error: `" + _path +
+                             "` is too small to be a raw matrix file.");
+  }
+
+  // MAP_PRIVATE in both modes: read-only pages stay shared with the page
+  // cache, and copy-on-write pages are duplicated only when written.
+  const int prot =
+      PROT_READ | (_mode == Core::MapMode::CopyOnWrite ? PROT_WRITE : 0);
+  void* addr = ::mmap(nullptr, length, prot, MAP_PRIVATE, fd, 0);
+  const int err = errno;
+  ::close(fd);
+
+  if (addr == MAP_FAILED) {
+    throw std::system_error(
+        err, std::generic_category(), "Error: cannot map `" + _path + "`");
+  }
+
+  return std::make_shared<const Mapping>(addr, length);
+}
+
+inline void CheckRawHeader(const Mapping& _map,
+                           const std::string& _path,
+                           IO::Value _value,
+                           std::size_t _value_size,
+                           Core::Major _major,
+                           std::size_t _rows,
+                           std::size_t _cols) {
+  IO::RawHeader header;
+  std::memcpy(&header, _map.addr, sizeof(header));
+
+  const auto fail = [&](const char* what) {
+    throw std::runtime_error("Error: `" + _path + "` " + what + ".");
+  };
+
+  if (std::memcmp(header.magic, "SGLTYRAW", sizeof(header.magic)) != 0) {
+    fail("is not a raw matrix file");
+  }
+  if (header.version != IO::raw_version) {
+    fail("has an unsupported format version");
+  }
+  if (header.byte_order != IO::byte_order_mark) {
+    fail("was written with a different byte order");
+  }
+  if (header.value != static_cast<std::uint8_t>(_value) ||
+      header.value_size != _value_size) {
+    fail("stores a different value type");
+  }
+  if (header.core_major != static_cast<std::uint8_t>(_major)) {
+    fail("stores a different major order");
+  }
+  if (header.rows != _rows || header.cols != _cols) {
+    fail("stores a matrix of a different shape");
+  }
+  if (header.offset % alignof(std::max_align_t) != 0 ||
+      header.offset > _map.length ||
+      _map.length - header.offset < _rows * _cols * _value_size) {
+    fail("is truncated or has a corrupt payload offset");
+  }
+}
+
+/// Copies a whole mapping into a private anonymous one, for a copy-on-write
+/// core that is written while its mapping is shared.
+inline std::shared_ptr<const Mapping> CopyMapping(const Mapping& _map) {
+  void* addr = ::mmap(nullptr,
+                      _map.length,
+                      PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS,
+                      -1,
+                      0);
+  if (addr == MAP_FAILED) {
+    throw std::system_error(
+        errno, std::generic_category(), "Error: cannot copy a mapping");
+  }
+  std::memcpy(addr, _map.addr, _map.length);
+  return std::make_shared<const Mapping>(addr, _map.length);
+}
+
+}  // namespace Impl
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          Core::MapMode _mode>
+Mapped<_Tp, _rows, _cols, _core_major, _mode>::Mapped(
+    const std::string& _path)
+    : _m_map(Impl::MapFile(_path, _mode)) {
+  static_assert(IO::value_v<_Tp> != IO::Value::Unknown,
+                "Error: `_Tp` has no raw file representation.");
+
+  Impl::CheckRawHeader(*_m_map,
+                       _path,
+                       IO::value_v<_Tp>,
+                       sizeof(_Tp),
+                       _core_major,
+                       _rows,
+                       _cols);
+
+  IO::RawHeader header;
+  std::memcpy(&header, _m_map->addr, sizeof(header));
+  _m_data = reinterpret_cast<pointer>(static_cast<char*>(_m_map->addr) +
+                                      header.offset);
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          Core::MapMode _mode>
+typename Mapped<_Tp, _rows, _cols, _core_major, _mode>::reference
+Mapped<_Tp, _rows, _cols, _core_major, _mode>::At(const size_type _row,
+                                                  const size_type _col) {
+  _m_Detach();
+  return const_cast<reference>(std::as_const(*this).At(_row, _col));
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          Core::MapMode _mode>
+typename Mapped<_Tp, _rows, _cols, _core_major, _mode>::const_reference
+Mapped<_Tp, _rows, _cols, _core_major, _mode>::At(
+    const size_type _row, const size_type _col) const {
+  if (core_traits::core_major == Core::Major::Row) {
+    return _m_data[_row * _cols + _col];
+  } else {
+    return _m_data[_col * _rows + _row];
+  }
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          Core::MapMode _mode>
+typename Mapped<_Tp, _rows, _cols, _core_major, _mode>::pointer
+Mapped<_Tp, _rows, _cols, _core_major, _mode>::Data() {
+  _m_Detach();
+  return _m_data;
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          Core::MapMode _mode>
+typename Mapped<_Tp, _rows, _cols, _core_major, _mode>::const_pointer
+Mapped<_Tp, _rows, _cols, _core_major, _mode>::Data() const {
+  return _m_data;
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          Core::MapMode _mode>
+bool Mapped<_Tp, _rows, _cols, _core_major, _mode>::IsMapped() const {
+  return _m_data != nullptr;
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          Core::MapMode _mode>
+bool Mapped<_Tp, _rows, _cols, _core_major, _mode>::Unique() const {
+  return _mode == Core::MapMode::ReadOnly || _m_map.use_count() <= 1;
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          Core::MapMode _mode>
+void Mapped<_Tp, _rows, _cols, _core_major, _mode>::Discard() {
+  _m_Detach();
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          Core::MapMode _mode>
+void Mapped<_Tp, _rows, _cols, _core_major, _mode>::_m_Detach() {
+  if constexpr (_mode == Core::MapMode::CopyOnWrite) {
+    if (_m_map == nullptr) {
+      return;
+    }
+    if (_m_map.use_count() == 1) {
+      // Pairs with the release of the last other copy, so its reads of the
+      // shared pages happen before our writes.
+      std::atomic_thread_fence(std::memory_order_acquire);
+      return;
+    }
+    const std::ptrdiff_t offset =
+        reinterpret_cast<char*>(_m_data) - static_cast<char*>(_m_map->addr);
+    _m_map  = Impl::CopyMapping(*_m_map);
+    _m_data = reinterpret_cast<pointer>(static_cast<char*>(_m_map->addr) +
+                                        offset);
+  }
+}
+
+}  // namespace Sglty::Core
+
+// Singularity/Core/Impl/Mapped.tpp
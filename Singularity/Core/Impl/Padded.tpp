@@ -0,0 +1,112 @@
+#pragma once
+
+#include "../Padded.hpp"
+
+#include <cstddef>
+#include <utility>
+
+namespace Sglty::Core {
+
+namespace Impl {
+
+constexpr std::size_t PaddedStride(std::size_t _inner,
+                                   std::size_t _size,
+                                   std::size_t _align) {
+  // Alignment unit in elements; element sizes that do not divide it (e.g.
+  // 12-byte structs) cannot keep every line aligned and are not rounded.
+  const std::size_t unit = _align % _size == 0 ? _align / _size : 1;
+
+  std::size_t stride = (_inner + unit - 1) / unit * unit;
+  if (stride != 0 && stride * _size % padded_conflict_bytes == 0) {
+    stride += unit;
+  }
+  return stride;
+}
+
+}  // namespace Impl
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          std::size_t _align,
+          std::size_t _outer_stride>
+constexpr Padded<_Tp, _rows, _cols, _core_major, _align, _outer_stride>::
+    Padded(value_type val)
+    : _m_data() {
+  for (size_type o = 0; o < outer_size; o++) {
+    for (size_type n = 0; n < inner_size; n++) {
+      _m_data[o * outer_stride + n] = val;
+    }
+  }
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          std::size_t _align,
+          std::size_t _outer_stride>
+constexpr typename Padded<_Tp,
+                          _rows,
+                          _cols,
+                          _core_major,
+                          _align,
+                          _outer_stride>::reference
+Padded<_Tp, _rows, _cols, _core_major, _align, _outer_stride>::At(
+    const size_type _row, const size_type _col) {
+  return const_cast<reference>(std::as_const(*this).At(_row, _col));
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          std::size_t _align,
+          std::size_t _outer_stride>
+constexpr typename Padded<_Tp,
+                          _rows,
+                          _cols,
+                          _core_major,
+                          _align,
+                          _outer_stride>::const_reference
+Padded<_Tp, _rows, _cols, _core_major, _align, _outer_stride>::At(
+    const size_type _row, const size_type _col) const {
+  return _m_data[_row * core_row_stride + _col * core_col_stride];
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          std::size_t _align,
+          std::size_t _outer_stride>
+constexpr typename Padded<_Tp,
+                          _rows,
+                          _cols,
+                          _core_major,
+                          _align,
+                          _outer_stride>::pointer
+Padded<_Tp, _rows, _cols, _core_major, _align, _outer_stride>::Data() {
+  return const_cast<pointer>(std::as_const(*this).Data());
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          std::size_t _align,
+          std::size_t _outer_stride>
+constexpr typename Padded<_Tp,
+                          _rows,
+                          _cols,
+                          _core_major,
+                          _align,
+                          _outer_stride>::const_pointer
+Padded<_Tp, _rows, _cols, _core_major, _align, _outer_stride>::Data() const {
+  return _m_data.data();
+}
+
+}  // namespace Sglty::Core
+
+// Singularity/Core/Impl/Padded.tpp
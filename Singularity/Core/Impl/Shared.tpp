@@ -0,0 +1,246 @@
+#pragma once
+
+#include "../Shared.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace Sglty::Core {
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc>
+template <typename... _args>
+Shared<_Tp, _rows, _cols, _core_major, _Alloc>::Block::Block(_args&&... _a)
+    : heap(std::forward<_args>(_a)...) {}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc>
+Shared<_Tp, _rows, _cols, _core_major, _Alloc>::Shared()
+    : _m_block(_m_Create(allocator_type())) {}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc>
+Shared<_Tp, _rows, _cols, _core_major, _Alloc>::Shared(value_type val)
+    : _m_block(_m_Create(allocator_type(), val)) {}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc>
+Shared<_Tp, _rows, _cols, _core_major, _Alloc>::Shared(
+    const allocator_type& _alloc)
+    : _m_block(_m_Create(_alloc, _alloc)) {}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc>
+Shared<_Tp, _rows, _cols, _core_major, _Alloc>::Shared(
+    const Shared& _other) noexcept
+    : _m_block(_other._m_block) {
+  if (_m_block) {
+    _m_block->refs.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc>
+Shared<_Tp, _rows, _cols, _core_major, _Alloc>::Shared(
+    Shared&& _other) noexcept
+    : _m_block(std::exchange(_other._m_block, nullptr)) {}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc>
+Shared<_Tp, _rows, _cols, _core_major, _Alloc>&
+Shared<_Tp, _rows, _cols, _core_major, _Alloc>::operator=(
+    const Shared& _other) noexcept {
+  // Counted before the release, so self-assignment keeps the buffer.
+  Block* block = _other._m_block;
+  if (block) {
+    block->refs.fetch_add(1, std::memory_order_relaxed);
+  }
+  _m_Release();
+  _m_block = block;
+  return *this;
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc>
+Shared<_Tp, _rows, _cols, _core_major, _Alloc>&
+Shared<_Tp, _rows, _cols, _core_major, _Alloc>::operator=(
+    Shared&& _other) noexcept {
+  if (this != &_other) {
+    _m_Release();
+    _m_block = std::exchange(_other._m_block, nullptr);
+  }
+  return *this;
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc>
+Shared<_Tp, _rows, _cols, _core_major, _Alloc>::~Shared() {
+  _m_Release();
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc>
+typename Shared<_Tp, _rows, _cols, _core_major, _Alloc>::reference
+Shared<_Tp, _rows, _cols, _core_major, _Alloc>::At(const size_type _row,
+                                                   const size_type _col) {
+  _m_Detach();
+  return _m_block->heap.At(_row, _col);
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc>
+typename Shared<_Tp, _rows, _cols, _core_major, _Alloc>::const_reference
+Shared<_Tp, _rows, _cols, _core_major, _Alloc>::At(
+    const size_type _row, const size_type _col) const {
+  return std::as_const(_m_block->heap).At(_row, _col);
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc>
+typename Shared<_Tp, _rows, _cols, _core_major, _Alloc>::pointer
+Shared<_Tp, _rows, _cols, _core_major, _Alloc>::Data() {
+  _m_Detach();
+  return _m_block->heap.Data();
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc>
+typename Shared<_Tp, _rows, _cols, _core_major, _Alloc>::const_pointer
+Shared<_Tp, _rows, _cols, _core_major, _Alloc>::Data() const {
+  return std::as_const(_m_block->heap).Data();
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc>
+bool Shared<_Tp, _rows, _cols, _core_major, _Alloc>::Unique() const {
+  // Acquire: pairs with the release in `_m_Release()`, so the reads of a
+  // copy destroyed on another thread happen before our writes.
+  return _m_block == nullptr ||
+         _m_block->refs.load(std::memory_order_acquire) == 1;
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc>
+void Shared<_Tp, _rows, _cols, _core_major, _Alloc>::Discard() {
+  if (_m_block != nullptr && Unique()) {
+    return;
+  }
+  const allocator_type alloc =
+      _m_block ? _m_block->heap.GetAllocator() : allocator_type();
+  Block* block = _m_Create(alloc, alloc, Uninitialized());
+  _m_Release();
+  _m_block = block;
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc>
+typename Shared<_Tp, _rows, _cols, _core_major, _Alloc>::allocator_type
+Shared<_Tp, _rows, _cols, _core_major, _Alloc>::GetAllocator() const {
+  return _m_block ? _m_block->heap.GetAllocator() : allocator_type();
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc>
+template <typename... _args>
+typename Shared<_Tp, _rows, _cols, _core_major, _Alloc>::Block*
+Shared<_Tp, _rows, _cols, _core_major, _Alloc>::_m_Create(
+    const allocator_type& _alloc, _args&&... _a) {
+  using traits = std::allocator_traits<block_allocator>;
+
+  block_allocator alloc(_alloc);
+  Block* block = traits::allocate(alloc, 1);
+  try {
+    traits::construct(alloc, block, std::forward<_args>(_a)...);
+  } catch (...) {
+    traits::deallocate(alloc, block, 1);
+    throw;
+  }
+  return block;
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc>
+void Shared<_Tp, _rows, _cols, _core_major, _Alloc>::_m_Detach() {
+  if (!Unique()) {
+    Block* block = _m_Create(_m_block->heap.GetAllocator(),
+                             std::as_const(_m_block->heap));
+    _m_Release();
+    _m_block = block;
+  }
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc>
+void Shared<_Tp, _rows, _cols, _core_major, _Alloc>::_m_Release() {
+  Block* block = std::exchange(_m_block, nullptr);
+  if (block && block->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    using traits = std::allocator_traits<block_allocator>;
+
+    block_allocator alloc(block->heap.GetAllocator());
+    traits::destroy(alloc, block);
+    traits::deallocate(alloc, block, 1);
+  }
+}
+
+}  // namespace Sglty::Core
+
+// Singularity/Core/Impl/Shared.tpp
@@ -0,0 +1,233 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+#include "../Config.hpp"
+
+#include "Enums.hpp"
+#include "Dense.hpp"
+#include "../Traits/Type.hpp"
+#include "../Traits/Size.hpp"
+#include "../Traits/Core.hpp"
+
+namespace Sglty::Core {
+
+namespace Impl {
+
+/**
+ * @brief Type traits of a `Map` over `_Tp`.
+ *
+ * `value_type` never carries `const`; a map over `const _Tp` only changes the
+ * mutable `reference` and `pointer` to const ones, so it can be read in
+ * expressions but not assigned into.
+ */
+template <typename _Tp>
+struct MapTypeTraits : Traits::Type::Get<std::remove_const_t<_Tp>> {
+  using reference = _Tp&;
+  using pointer   = _Tp*;
+};
+
+}  // namespace Impl
+
+/**
+ * @brief Fixed-size dense core viewing memory owned by someone else.
+ *
+ * `Map` wraps a pointer with a compile-time shape, major order and strides,
+ * so buffers handed over by other components (network frames, shared memory
+ * segments, numpy-style arrays) can be used in expressions and assigned into
+ * without being copied into a `Dense` first. The memory must outlive the map.
+ *
+ * Element (i, j) of a row-major map lives at
+ * `Data()[i * outer_stride + j * inner_stride]`; for column-major the roles
+ * of i and j are swapped. An outer stride of `0` means the rows (or columns)
+ * are packed back to back, which together with the default inner stride of
+ * `1` makes the map contiguous (`Traits::Core::is_contiguous_v`).
+ *
+ * It satisfies the same interface as `Dense`. Rebinding (results of
+ * expressions, `Cast()`, `Reorder()`) yields an owning `Dense` core.
+ *
+ * Copies view the same memory. Assigning one map to another copies the
+ * elements, like assigning any other matrix. An expression may read the
+ * memory it is assigned to, as in `m = Trp(m)`, `m = m * m` or through a
+ * second map overlapping the first: `Expr::Assign()` then evaluates it into
+ * a temporary first. A default-constructed `Map` views nothing and must not
+ * be accessed.
+ *
+ * Example Usage:
+ * ```
+ * float frame[3 * 8];  // 3x3 payload with rows padded to 8 floats
+ * Sglty::Types::Matrix<Sglty::Core::Map<float, 3, 3, Major::Row, 8>> m(frame);
+ * m = m * 2.0f;        // written back into `frame`
+ * ```
+ *
+ * @tparam _Tp           The scalar element type; `const` for read-only views.
+ * @tparam _rows         The number of rows in the matrix.
+ * @tparam _cols         The number of columns in the matrix.
+ * @tparam _core_major   The memory layout (row-major or column-major).
+ * @tparam _outer_stride Elements between consecutive rows (row-major) or
+ * columns (column-major); `0` for packed.
+ * @tparam _inner_stride Elements between consecutive entries of a row
+ * (row-major) or column (column-major).
+ */
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          std::size_t _outer_stride = 0,
+          std::size_t _inner_stride = 1>
+class Map {
+  static_assert(_inner_stride > 0, "Error: `_inner_stride` must be positive.");
+
+ public:
+  /// Type traits for the matrix element type.
+  using type_traits = Impl::MapTypeTraits<_Tp>;
+
+  using size_type       = typename type_traits::size_type;
+  using value_type      = typename type_traits::value_type;
+  using difference_type = typename type_traits::difference_type;
+  using reference       = typename type_traits::reference;
+  using const_reference = typename type_traits::const_reference;
+  using pointer         = typename type_traits::pointer;
+  using const_pointer   = typename type_traits::const_pointer;
+
+  /// Size traits defining row and column dimensions.
+  using size_traits = Traits::Size::Get<_rows, _cols, size_type>;
+
+  /// Core trait describing layout and type identity.
+  using core_traits = Traits::Core::Get<Core::Type::Dense, _core_major>;
+
+  /// Elements between consecutive rows or columns, resolved if packed.
+  constexpr static size_type outer_stride =
+      _outer_stride != 0
+          ? _outer_stride
+          : _inner_stride * (_core_major == Core::Major::Row ? _cols : _rows);
+
+  /// Elements between consecutive entries of a row or column.
+  constexpr static size_type inner_stride = _inner_stride;
+
+  /// Distance between (i, j) and (i + 1, j); see `Traits::Core::row_stride_v`.
+  constexpr static size_type core_row_stride =
+      _core_major == Core::Major::Row ? outer_stride : inner_stride;
+
+  /// Distance between (i, j) and (i, j + 1); see `Traits::Core::col_stride_v`.
+  constexpr static size_type core_col_stride =
+      _core_major == Core::Major::Row ? inner_stride : outer_stride;
+
+  /**
+   * @brief Rebinds to an owning `Dense` core of a new size.
+   *
+   * @tparam _rebind_rows New row count.
+   * @tparam _rebind_cols New column count.
+   */
+  template <size_type _rebind_rows, size_type _rebind_cols>
+  using core_rebind_size =
+      Dense<value_type, _rebind_rows, _rebind_cols, core_traits::core_major>;
+
+  /**
+   * @brief Rebinds to an owning `Dense` core with a new value type.
+   *
+   * @tparam _rebind_value The new value type.
+   */
+  template <typename _rebind_value>
+  using core_rebind_value =
+      Dense<_rebind_value, _rows, _cols, core_traits::core_major>;
+
+  /**
+   * @brief Rebinds to an owning `Dense` core with a different layout.
+   *
+   * @tparam _rebind_major The new layout.
+   */
+  template <Core::Major _rebind_major>
+  using core_rebind_major = Dense<value_type, _rows, _cols, _rebind_major>;
+
+  /**
+   * @brief Shares its base with `Dense`, so maps and dense operands can be
+   * mixed in products.
+   */
+  using core_base = Dense<value_type, 0, 0, core_traits::core_major>;
+
+  /**
+   * @brief Constructs a map that views nothing.
+   *
+   * Required by the core interface; accessing elements is undefined.
+   */
+  constexpr Map() = default;
+
+  /**
+   * @brief Views the memory starting at `_data`.
+   *
+   * @param _data Pointer to element (0, 0); must stay valid while the map
+   * (or a copy of it) is used.
+   */
+  constexpr explicit Map(pointer _data);
+
+  /**
+   * @brief Views the same memory as `_other`.
+   */
+  constexpr Map(const Map& _other) = default;
+
+  /**
+   * @brief Copies the elements of `_other` into the viewed memory.
+   *
+   * Does not rebind the map; use a new `Map` to view other memory.
+   */
+  constexpr Map& operator=(const Map& _other);
+
+#if SGLTY_HAS_MDSPAN
+  /**
+   * @brief Views the memory of a rank-2 `std::mdspan`.
+   *
+   * Static extents must match this map's shape; dynamic extents and the
+   * mapping's strides are checked at runtime.
+   *
+   * @param _span The span to view; its accessor must be the default one.
+   *
+   * @throws std::runtime_error if the extents or strides do not match.
+   */
+  template <typename _Up, typename _extents, typename _layout>
+  constexpr explicit Map(std::mdspan<_Up, _extents, _layout> _span);
+#endif
+
+  /**
+   * @brief Accesses a mutable reference to the element at (_row, _col).
+   *
+   * @param _row The row index (zero-based).
+   * @param _col The column index (zero-based).
+   * @return Reference to the element.
+   */
+  constexpr reference At(const size_type _row, const size_type _col);
+
+  /**
+   * @brief Accesses a read-only reference to the element at (_row, _col).
+   *
+   * @param _row The row index (zero-based).
+   * @param _col The column index (zero-based).
+   * @return Const reference to the element.
+   */
+  constexpr const_reference At(const size_type _row,
+                               const size_type _col) const;
+
+  /**
+   * @brief Returns the pointer to element (0, 0).
+   *
+   * @return Mutable pointer to the viewed memory.
+   */
+  constexpr pointer Data();
+
+  /**
+   * @brief Returns the const pointer to element (0, 0).
+   *
+   * @return Const pointer to the viewed memory.
+   */
+  constexpr const_pointer Data() const;
+
+ private:
+  pointer _m_data = nullptr;
+};
+
+}  // namespace Sglty::Core
+
+#include "Impl/Map.tpp"
+
+// Singularity/Core/Map.hpp
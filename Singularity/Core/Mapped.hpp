@@ -0,0 +1,210 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include "Enums.hpp"
+#include "Dense.hpp"
+#include "Map.hpp"
+#include "../Traits/Type.hpp"
+#include "../Traits/Size.hpp"
+#include "../Traits/Core.hpp"
+
+namespace Sglty::Core {
+
+namespace Impl {
+
+struct Mapping;
+
+}  // namespace Impl
+
+/**
+ * @brief Fixed-size dense core backed by a memory-mapped file.
+ *
+ * `Mapped` maps a raw matrix file (see `Sglty::IO::RawHeader`) and reads its
+ * elements in place: opening a file of any size costs a single `mmap`, and
+ * every process mapping the same file shares one copy in the page cache.
+ *
+ * It satisfies the same interface as `Dense`, so a `Matrix<Mapped<...>>` can
+ * be used directly in expressions. Rebinding (results of expressions,
+ * `Cast()`, `Reorder()`) yields an owning `Dense` core, since results cannot
+ * live in the mapped file.
+ *
+ * A `ReadOnly` core maps the file read-only and, like `Map<const _Tp>`, has
+ * const `reference` and `pointer` types, so it can be read in expressions
+ * but not written. A `CopyOnWrite` core maps it privately: pages are copied
+ * by the kernel when first written, and writes never reach the file.
+ *
+ * Copies share the mapping, which is released with the last copy. A
+ * `CopyOnWrite` copy keeps value semantics: the first mutable `At()` or
+ * `Data()` on a core whose mapping is shared moves that core to a private
+ * anonymous mapping holding the current elements, so writes to one copy are
+ * never seen by another. A default-constructed `Mapped` maps nothing and must
+ * not be accessed.
+ *
+ * Example Usage:
+ * ```
+ * Sglty::IO::WriteRaw("weights.bin", weights);
+ * Sglty::Types::Matrix<Sglty::Core::Mapped<float, 4096, 4096, Major::Row>>
+ *     w("weights.bin");
+ * ```
+ *
+ * POSIX only.
+ *
+ * @tparam _Tp         The scalar element type.
+ * @tparam _rows       The number of rows in the matrix.
+ * @tparam _cols       The number of columns in the matrix.
+ * @tparam _core_major The memory layout; must match the file.
+ * @tparam _mode       Whether writes are forbidden or kept private.
+ */
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          Core::MapMode _mode = Core::MapMode::ReadOnly>
+class Mapped {
+ public:
+  /// Type traits for the matrix element type; const references for
+  /// `ReadOnly`.
+  using type_traits =
+      std::conditional_t<_mode == Core::MapMode::ReadOnly,
+                         Impl::MapTypeTraits<const _Tp>,
+                         Traits::Type::Get<_Tp>>;
+
+  using size_type       = typename type_traits::size_type;
+  using value_type      = typename type_traits::value_type;
+  using difference_type = typename type_traits::difference_type;
+  using reference       = typename type_traits::reference;
+  using const_reference = typename type_traits::const_reference;
+  using pointer         = typename type_traits::pointer;
+  using const_pointer   = typename type_traits::const_pointer;
+
+  /// Size traits defining row and column dimensions.
+  using size_traits = Traits::Size::Get<_rows, _cols, size_type>;
+
+  /// Core trait describing layout and type identity.
+  using core_traits = Traits::Core::Get<Core::Type::Dense, _core_major>;
+
+  /// Expression nodes hold this core's matrices by reference; see
+  /// `Traits::Core::is_held_by_reference_v`.
+  constexpr static bool core_held_by_reference = true;
+
+  /**
+   * @brief Rebinds to an owning `Dense` core of a new size.
+   *
+   * @tparam _rebind_rows New row count.
+   * @tparam _rebind_cols New column count.
+   */
+  template <size_type _rebind_rows, size_type _rebind_cols>
+  using core_rebind_size =
+      Dense<_Tp, _rebind_rows, _rebind_cols, core_traits::core_major>;
+
+  /**
+   * @brief Rebinds to an owning `Dense` core with a new value type.
+   *
+   * @tparam _rebind_value The new value type.
+   */
+  template <typename _rebind_value>
+  using core_rebind_value =
+      Dense<_rebind_value, _rows, _cols, core_traits::core_major>;
+
+  /**
+   * @brief Rebinds to an owning `Dense` core with a different layout.
+   *
+   * @tparam _rebind_major The new layout.
+   */
+  template <Core::Major _rebind_major>
+  using core_rebind_major = Dense<_Tp, _rows, _cols, _rebind_major>;
+
+  /**
+   * @brief Shares its base with `Dense`, so mapped and dense operands can be
+   * mixed in products.
+   */
+  using core_base = Dense<_Tp, 0, 0, core_traits::core_major>;
+
+  /**
+   * @brief Constructs an empty core that maps nothing.
+   *
+   * Required by the core interface; accessing elements is undefined.
+   */
+  Mapped() = default;
+
+  /**
+   * @brief Maps a raw matrix file.
+   *
+   * The header must match this core's value type, shape and layout.
+   *
+   * @param _path Path of the file written by `Sglty::IO::WriteRaw`.
+   *
+   * @throws std::system_error if the file cannot be opened or mapped.
+   * @throws std::runtime_error if the header does not match this core.
+   */
+  explicit Mapped(const std::string& _path);
+
+  /**
+   * @brief Accesses a mutable reference to the element at (_row, _col).
+   *
+   * A `CopyOnWrite` core whose mapping is shared with a copy detaches first;
+   * a `ReadOnly` core returns a const reference.
+   *
+   * @param _row The row index (zero-based).
+   * @param _col The column index (zero-based).
+   * @return Reference to the element.
+   */
+  reference At(const size_type _row, const size_type _col);
+
+  /**
+   * @brief Accesses a read-only reference to the element at (_row, _col).
+   *
+   * @param _row The row index (zero-based).
+   * @param _col The column index (zero-based).
+   * @return Const reference to the element.
+   */
+  const_reference At(const size_type _row, const size_type _col) const;
+
+  /**
+   * @brief Returns a raw pointer to the mapped payload, detaching a shared
+   * `CopyOnWrite` mapping first. Valid for writes until the core is copied.
+   *
+   * @return Mutable pointer to the matrix data (const for `ReadOnly`).
+   */
+  pointer Data();
+
+  /**
+   * @brief Returns a const raw pointer to the mapped payload.
+   *
+   * @return Const pointer to the matrix data.
+   */
+  const_pointer Data() const;
+
+  /**
+   * @brief Returns whether a file is currently mapped.
+   */
+  bool IsMapped() const;
+
+  /**
+   * @brief Returns whether no copy shares the mapping, i.e. whether writes
+   * need no copy. Always `true` for `ReadOnly`, which is never written.
+   */
+  bool Unique() const;
+
+  /**
+   * @brief Detaches a shared `CopyOnWrite` mapping ahead of a write that
+   * replaces every element, so `Expr::Assign()` takes `Data()` once.
+   */
+  void Discard();
+
+ private:
+  std::shared_ptr<const Impl::Mapping> _m_map;
+  pointer _m_data = nullptr;
+
+  void _m_Detach();
+};
+
+}  // namespace Sglty::Core
+
+#include "Impl/Mapped.tpp"
+
+// Singularity/Core/Mapped.hpp
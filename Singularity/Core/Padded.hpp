@@ -0,0 +1,226 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include "Enums.hpp"
+#include "../Traits/Type.hpp"
+#include "../Traits/Size.hpp"
+#include "../Traits/Core.hpp"
+
+namespace Sglty::Core {
+
+/**
+ * @brief Leading dimensions, in bytes, that `Padded` steps away from by
+ * default.
+ *
+ * Rows (or columns) whose starts are a multiple of this many bytes apart map
+ * to a handful of L1 sets, so walking down a column of a 256, 512 or 1024
+ * wide matrix keeps evicting its own lines.
+ */
+constexpr inline std::size_t padded_conflict_bytes = 512;
+
+namespace Impl {
+
+/**
+ * @brief Default leading dimension of a `Padded` core: `_inner` rounded up
+ * to a whole number of `_align` bytes, plus one more such unit if the result
+ * is a multiple of `padded_conflict_bytes`.
+ */
+constexpr std::size_t PaddedStride(std::size_t _inner,
+                                   std::size_t _size,
+                                   std::size_t _align);
+
+}  // namespace Impl
+
+/**
+ * @brief Fixed-size dense core with a padded leading dimension.
+ *
+ * Stores the same elements as `Dense`, but the rows (row-major) or columns
+ * (column-major) start `outer_stride` elements apart instead of `cols` (or
+ * `rows`), and the storage is aligned to `_align` bytes. With the default
+ * stride every row or column therefore starts on an `_align` boundary, and
+ * power-of-two shapes (256, 512, 1024, ...) are padded by one extra unit so
+ * that column walks, as in the inner loop of a matrix product, spread over
+ * the cache sets instead of conflicting in a few of them.
+ *
+ * The padding is exposed through `core_row_stride` / `core_col_stride` and
+ * `Matrix::OuterStride()`. Kernels that work line by line (`Kernel::Gemm()`
+ * packing, `Kernel::Transpose()`, same-layout copies) step by it; code that
+ * requires packed storage (`Traits::Core::is_contiguous_v`, e.g. snapshots)
+ * does not accept a padded core. Padding elements are zero and never read.
+ *
+ * Example Usage:
+ * ```
+ * using Core = Sglty::Core::Padded<float, 512, 512, Sglty::Core::Major::Row>;
+ * static_assert(Sglty::Types::Matrix<Core>::OuterStride() == 528);
+ * ```
+ *
+ * @tparam _Tp           The scalar element type.
+ * @tparam _rows         The number of rows in the matrix.
+ * @tparam _cols         The number of columns in the matrix.
+ * @tparam _core_major   The memory layout (row-major or column-major).
+ * @tparam _align        Alignment of the storage and, with the default
+ * stride, of every row or column, in bytes (a power of two; 64 is a cache
+ * line and one AVX-512 register).
+ * @tparam _outer_stride Elements between consecutive rows or columns; `0`
+ * for `Impl::PaddedStride()`.
+ */
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          std::size_t _align        = 64,
+          std::size_t _outer_stride = 0>
+class Padded {
+  static_assert(_align != 0 && (_align & (_align - 1)) == 0,
+                "Error: `_align` must be a power of two.");
+  static_assert(_align >= alignof(_Tp),
+                "Error: `_align` is smaller than the alignment of `_Tp`.");
+
+ public:
+  /// Type traits for the matrix element type.
+  using type_traits = Traits::Type::Get<_Tp>;
+
+  using size_type       = typename type_traits::size_type;
+  using value_type      = typename type_traits::value_type;
+  using difference_type = typename type_traits::difference_type;
+  using reference       = typename type_traits::reference;
+  using const_reference = typename type_traits::const_reference;
+  using pointer         = typename type_traits::pointer;
+  using const_pointer   = typename type_traits::const_pointer;
+
+  /// Size traits defining row and column dimensions.
+  using size_traits = Traits::Size::Get<_rows, _cols, size_type>;
+
+  /// Core trait describing layout and type identity.
+  using core_traits = Traits::Core::Get<Core::Type::Dense, _core_major>;
+
+  /// Number of rows (row-major) or columns (column-major) stored.
+  constexpr static size_type outer_size =
+      _core_major == Core::Major::Row ? _rows : _cols;
+
+  /// Number of elements in each row (row-major) or column (column-major).
+  constexpr static size_type inner_size =
+      _core_major == Core::Major::Row ? _cols : _rows;
+
+  /// Elements between consecutive rows or columns, resolved if defaulted.
+  constexpr static size_type outer_stride =
+      _outer_stride != 0 ? _outer_stride
+                         : Impl::PaddedStride(inner_size, sizeof(_Tp), _align);
+
+  static_assert(outer_stride >= inner_size,
+                "Error: `_outer_stride` is smaller than a row or column.");
+
+  /// Distance between (i, j) and (i + 1, j); see `Traits::Core::row_stride_v`.
+  constexpr static size_type core_row_stride =
+      _core_major == Core::Major::Row ? outer_stride : 1;
+
+  /// Distance between (i, j) and (i, j + 1); see `Traits::Core::col_stride_v`.
+  constexpr static size_type core_col_stride =
+      _core_major == Core::Major::Row ? 1 : outer_stride;
+
+  /// Expression nodes hold this core's matrices by reference; see
+  /// `Traits::Core::is_held_by_reference_v`.
+  constexpr static bool core_held_by_reference = true;
+
+  /**
+   * @brief Rebinds the Padded core to a new size, keeping the alignment.
+   *
+   * The leading dimension is recomputed for the new shape.
+   *
+   * @tparam _rebind_rows New row count.
+   * @tparam _rebind_cols New column count.
+   */
+  template <size_type _rebind_rows, size_type _rebind_cols>
+  using core_rebind_size = Padded<_Tp,
+                                  _rebind_rows,
+                                  _rebind_cols,
+                                  core_traits::core_major,
+                                  _align>;
+
+  /**
+   * @brief Rebinds the Padded core to a new value type, keeping the
+   * alignment.
+   *
+   * @tparam _rebind_value The new value type.
+   */
+  template <typename _rebind_value>
+  using core_rebind_value =
+      Padded<_rebind_value, _rows, _cols, core_traits::core_major, _align>;
+
+  /**
+   * @brief Rebinds the Padded core to a different layout, keeping the
+   * alignment.
+   *
+   * @tparam _rebind_major The new layout.
+   */
+  template <Core::Major _rebind_major>
+  using core_rebind_major = Padded<_Tp, _rows, _cols, _rebind_major, _align>;
+
+  /**
+   * @brief Alias to a zero-sized base version of Padded with the same layout
+   * and alignment.
+   */
+  using core_base = Padded<_Tp, 0, 0, core_traits::core_major, _align>;
+
+  /**
+   * @brief Default-constructs the Padded core with zero-initialized data,
+   * padding included.
+   */
+  constexpr Padded() = default;
+
+  /**
+   * @brief Constructs a Padded core with all elements initialized to a value.
+   *
+   * The padding stays zero.
+   *
+   * @param val The value to fill every element with.
+   */
+  constexpr Padded(value_type val);
+
+  /**
+   * @brief Accesses a mutable reference to the element at (_row, _col).
+   *
+   * @param _row The row index (zero-based).
+   * @param _col The column index (zero-based).
+   * @return Reference to the element.
+   */
+  constexpr reference At(const size_type _row, const size_type _col);
+
+  /**
+   * @brief Accesses a read-only reference to the element at (_row, _col).
+   *
+   * @param _row The row index (zero-based).
+   * @param _col The column index (zero-based).
+   * @return Const reference to the element.
+   */
+  constexpr const_reference At(const size_type _row,
+                               const size_type _col) const;
+
+  /**
+   * @brief Returns a raw pointer to the first element.
+   *
+   * Aligned to `_align` bytes. Element (i, j) is at
+   * `i * core_row_stride + j * core_col_stride`.
+   *
+   * @return Mutable pointer to the matrix data.
+   */
+  constexpr pointer Data();
+
+  /**
+   * @brief Returns a const raw pointer to the first element.
+   *
+   * @return Const pointer to the matrix data.
+   */
+  constexpr const_pointer Data() const;
+
+ private:
+  alignas(_align) std::array<_Tp, outer_size * outer_stride> _m_data{};
+};
+
+}  // namespace Sglty::Core
+
+#include "Impl/Padded.tpp"
+
+// Singularity/Core/Padded.hpp
@@ -0,0 +1,250 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+#include "Enums.hpp"
+#include "Heap.hpp"
+#include "../Mem/Allocator.hpp"
+#include "../Traits/Type.hpp"
+#include "../Traits/Size.hpp"
+#include "../Traits/Core.hpp"
+
+namespace Sglty::Core {
+
+/**
+ * @brief Fixed-size dense core whose copies share one reference-counted
+ * buffer until one of them is written (copy-on-write).
+ *
+ * Copying a `Shared` core, and with it a `Matrix` over one, only increments
+ * a reference count, so matrices can be passed by value and stored in
+ * expressions in O(1). The first mutable `At()` or `Data()` on a copy whose
+ * buffer is still shared detaches it: the copy gets a buffer of its own with
+ * the same elements, the others keep the old one. Reads through `const`
+ * access never copy, so a stage that only reads its inputs should take them
+ * by `const` reference or read them through `std::as_const()`; a mutable
+ * `operator()` counts as a write even when it is only read from.
+ *
+ * Assigning an expression to a matrix over a shared buffer replaces the
+ * buffer instead of copying it first, since every element is overwritten.
+ * `Unique()` tells kernels whether they may write through `Data()` in place.
+ *
+ * The buffer is a `Heap` core allocated with `_Alloc`, together with its
+ * reference count. The count is atomic, so copies of one matrix may be read,
+ * written (each detaches on its own), copied and destroyed on different
+ * threads, like `std::shared_ptr`. One `Shared` object must not be written
+ * on one thread while it is accessed on another.
+ *
+ * All rebinds keep the core (and the allocator, rebound to the new value
+ * type), so expression results, `Cast()` and `Reorder()` are `Shared` too.
+ *
+ * Example Usage:
+ * ```
+ * using Mat = Sglty::Types::Matrix<
+ *     Sglty::Core::Shared<float, 1024, 1024, Major::Row>>;
+ * Mat a = Load();
+ * Mat b = a;        // shares the buffer
+ * Stage(b);         // `void Stage(Mat)` reading through `const`: no copy
+ * b(0, 0) = 1.0f;   // b detaches; a is unchanged
+ * ```
+ *
+ * @tparam _Tp         The scalar element type.
+ * @tparam _rows       The number of rows in the matrix.
+ * @tparam _cols       The number of columns in the matrix.
+ * @tparam _core_major The memory layout (row-major or column-major).
+ * @tparam _Alloc      The allocator; rebound to `_Tp` if needed.
+ */
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          Core::Major _core_major,
+          typename _Alloc = Mem::Allocator<_Tp>>
+class Shared {
+ public:
+  /// Type traits for the matrix element type.
+  using type_traits = Traits::Type::Get<_Tp>;
+
+  using size_type       = typename type_traits::size_type;
+  using value_type      = typename type_traits::value_type;
+  using difference_type = typename type_traits::difference_type;
+  using reference       = typename type_traits::reference;
+  using const_reference = typename type_traits::const_reference;
+  using pointer         = typename type_traits::pointer;
+  using const_pointer   = typename type_traits::const_pointer;
+
+  /// The allocator, rebound to the element type.
+  using allocator_type =
+      typename std::allocator_traits<_Alloc>::template rebind_alloc<_Tp>;
+
+  /// Size traits defining row and column dimensions.
+  using size_traits = Traits::Size::Get<_rows, _cols, size_type>;
+
+  /// Core trait describing layout and type identity.
+  using core_traits = Traits::Core::Get<Core::Type::Dense, _core_major>;
+
+  /// Expression nodes hold this core's matrices by reference; see
+  /// `Traits::Core::is_held_by_reference_v`.
+  constexpr static bool core_held_by_reference = true;
+
+  /**
+   * @brief Rebinds the Shared core to a new size, keeping the allocator.
+   *
+   * @tparam _rebind_rows New row count.
+   * @tparam _rebind_cols New column count.
+   */
+  template <size_type _rebind_rows, size_type _rebind_cols>
+  using core_rebind_size = Shared<_Tp,
+                                  _rebind_rows,
+                                  _rebind_cols,
+                                  core_traits::core_major,
+                                  allocator_type>;
+
+  /**
+   * @brief Rebinds the Shared core to a new value type, keeping the
+   * allocator.
+   *
+   * @tparam _rebind_value The new value type.
+   */
+  template <typename _rebind_value>
+  using core_rebind_value =
+      Shared<_rebind_value,
+             _rows,
+             _cols,
+             core_traits::core_major,
+             typename std::allocator_traits<
+                 allocator_type>::template rebind_alloc<_rebind_value>>;
+
+  /**
+   * @brief Rebinds the Shared core to a different layout, keeping the
+   * allocator.
+   *
+   * @tparam _rebind_major The new layout.
+   */
+  template <Core::Major _rebind_major>
+  using core_rebind_major =
+      Shared<_Tp, _rows, _cols, _rebind_major, allocator_type>;
+
+  /**
+   * @brief Alias to a zero-sized base version of Shared with the same layout
+   * and allocator.
+   */
+  using core_base = Shared<_Tp, 0, 0, core_traits::core_major, allocator_type>;
+
+  /**
+   * @brief Allocates a zero-initialized buffer from a default-constructed
+   * allocator.
+   */
+  Shared();
+
+  /**
+   * @brief Allocates a buffer with every element set to a value.
+   *
+   * @param val The value to fill every element with.
+   */
+  Shared(value_type val);
+
+  /**
+   * @brief Allocates a zero-initialized buffer from the given allocator.
+   *
+   * @param _alloc The allocator to use.
+   */
+  explicit Shared(const allocator_type& _alloc);
+
+  /// Shares the buffer of `_other`.
+  Shared(const Shared& _other) noexcept;
+
+  /**
+   * @brief Takes over the buffer of `_other`, which is left without one and
+   * may only be destroyed or assigned to.
+   */
+  Shared(Shared&& _other) noexcept;
+
+  /// Releases the current buffer and shares the one of `_other`.
+  Shared& operator=(const Shared& _other) noexcept;
+
+  /// Releases the current buffer and takes over the one of `_other`.
+  Shared& operator=(Shared&& _other) noexcept;
+
+  ~Shared();
+
+  /**
+   * @brief Accesses a mutable reference to the element at (_row, _col),
+   * detaching a shared buffer first.
+   *
+   * @param _row The row index (zero-based).
+   * @param _col The column index (zero-based).
+   * @return Reference to the element.
+   */
+  reference At(const size_type _row, const size_type _col);
+
+  /**
+   * @brief Accesses a read-only reference to the element at (_row, _col).
+   *
+   * @param _row The row index (zero-based).
+   * @param _col The column index (zero-based).
+   * @return Const reference to the element.
+   */
+  const_reference At(const size_type _row, const size_type _col) const;
+
+  /**
+   * @brief Returns a raw pointer to the buffer, detaching a shared buffer
+   * first. Valid for writes until the core is copied.
+   *
+   * @return Mutable pointer to the matrix data.
+   */
+  pointer Data();
+
+  /**
+   * @brief Returns a const raw pointer to the buffer.
+   *
+   * @return Const pointer to the matrix data.
+   */
+  const_pointer Data() const;
+
+  /**
+   * @brief Returns whether no other core shares the buffer, i.e. whether
+   * writes need no copy.
+   */
+  bool Unique() const;
+
+  /**
+   * @brief Gives the core a buffer of its own for a write that replaces
+   * every element: a shared buffer is replaced by a new uninitialized one
+   * from the same allocator instead of being copied.
+   */
+  void Discard();
+
+  /// Returns a copy of the allocator.
+  allocator_type GetAllocator() const;
+
+ private:
+  using heap_type =
+      Heap<_Tp, _rows, _cols, core_traits::core_major, allocator_type>;
+
+  struct Block {
+    template <typename... _args>
+    explicit Block(_args&&... _a);
+
+    std::atomic<std::size_t> refs{1};
+    heap_type heap;
+  };
+
+  using block_allocator =
+      typename std::allocator_traits<allocator_type>::template rebind_alloc<
+          Block>;
+
+  Block* _m_block = nullptr;
+
+  template <typename... _args>
+  static Block* _m_Create(const allocator_type& _alloc, _args&&... _a);
+
+  void _m_Detach();
+  void _m_Release();
+};
+
+}  // namespace Sglty::Core
+
+#include "Impl/Shared.tpp"
+
+// Singularity/Core/Shared.hpp
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "../Fwd.hpp"
+#include "Parallel.hpp"
+
+/**
+ * @brief Multithreaded overloads of evaluation and comparison.
+ *
+ * Taking an `Exec::Par` policy, they split the outer dimension (rows for
+ * row-major, columns for column-major) of a matrix into contiguous ranges of
+ * at least `Exec::par_min_work` elements and run them with
+ * `Exec::ParallelFor()`. They live in this header, not in `Lib.hpp`, so that
+ * translation units that never evaluate in parallel do not parse the thread
+ * pool.
+ */
+
+namespace Sglty::Expr {
+
+/**
+ * @brief Evaluates an expression into an existing matrix on several threads.
+ *
+ * Each range of the destination's outer dimension is written by one thread;
+ * this matches the first-touch placement of `Mem::PagedAllocator`. Elements
+ * are computed independently, so generators such as `Matrix::Random()` give
+ * the same result as the sequential `Assign()`. Matrix products are still
+ * evaluated by `Kernel::Gemm()` on the calling thread.
+ *
+ * @tparam _core_impl The core implementation of the destination.
+ * @tparam _expr      The expression type. Must satisfy
+ * `Sglty::Traits::Expr::is_valid_v` and match the destination's shape.
+ * @param _dst    The matrix to write into.
+ * @param _e      The expression to evaluate.
+ * @param _policy The thread limit.
+ */
+template <typename _core_impl, typename _expr>
+void Assign(Types::Matrix<_core_impl>& _dst,
+            const _expr& _e,
+            Exec::Par _policy);
+
+/**
+ * @brief Evaluates a matrix expression at runtime on several threads.
+ *
+ * Same as `Evaluate(_e)`, but the result is written through
+ * `Assign(ret, _e, _policy)`, i.e. split over the result's outer dimension.
+ * Worthwhile for large elementwise expressions and generators, e.g.
+ * `Evaluate(HeapMat<float, 4096, 4096>::Random(seed), Exec::Par{})`.
+ *
+ * @tparam _expr The expression type. Must satisfy
+ * `Sglty::Traits::Expr::is_valid_v`.
+ * @param _e      The expression to evaluate.
+ * @param _policy The thread limit.
+ * @return A concrete `Matrix` representing the evaluated expression.
+ */
+template <typename _expr>
+auto Evaluate(const _expr& _e, Exec::Par _policy);
+
+}  // namespace Sglty::Expr
+
+namespace Sglty::Op::Cmp {
+
+/**
+ * @brief `IsApprox()` on several threads.
+ *
+ * The left operand's outer dimension is split as in
+ * `Expr::Assign(_dst, _e, Exec::Par)`; once one thread finds a mismatch the
+ * others stop at their next outer index. Worth it for large heap-backed
+ * matrices or expensive expressions.
+ *
+ * @param _l      Left operand.
+ * @param _r      Right operand.
+ * @param _policy The thread limit.
+ * @param _rel    Relative tolerance.
+ * @param _abs    Absolute tolerance, for elements near zero.
+ */
+template <typename _lhs, typename _rhs>
+bool IsApprox(const _lhs& _l,
+              const _rhs& _r,
+              Exec::Par _policy,
+              double _rel = 1e-5,
+              double _abs = 0.0);
+
+}  // namespace Sglty::Op::Cmp
+
+#include "Impl/Evaluate.tpp"
+
+// Singularity/Exec/Evaluate.hpp
@@ -0,0 +1,133 @@
+#pragma once
+
+#include "../Evaluate.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "../../Expr/Assign.hpp"
+#include "../../Expr/Evaluate.hpp"
+#include "../../Op/Cmp/Eql.hpp"
+#include "../../Traits/Core.hpp"
+#include "../../Traits/Expr.hpp"
+#include "../../Types/Matrix.hpp"
+
+namespace Sglty::Expr {
+
+template <typename _core_impl, typename _expr>
+void Assign(Types::Matrix<_core_impl>& _dst,
+            const _expr& _e,
+            Exec::Par _policy) {
+  static_assert(Traits::Expr::is_valid_v<_expr>,
+                "Error: `_expr` is not a valid expression type.");
+  static_assert(Types::Matrix<_core_impl>::rows == _expr::rows &&
+                    Types::Matrix<_core_impl>::cols == _expr::cols,
+                "Error: dimension mismatch.");
+
+  if constexpr (Traits::Core::is_copy_on_write_v<_core_impl>) {
+    auto view = Impl::WriteView(_dst);
+    Assign(view, _e, _policy);
+    return;
+  }
+
+  if (Impl::IsAliased(_dst, _e)) {
+    Impl::WithTemporary<_core_impl>([&](auto& _temp) {
+      Assign(_temp, _e, _policy);
+      Assign(_dst, std::as_const(_temp), _policy);
+    });
+    return;
+  }
+
+  if constexpr (Impl::has_shared_v<_expr>) {
+    if (Impl::EliminateShared(
+            _e, [&](const auto& _s) { Assign(_dst, _s, _policy); })) {
+      return;
+    }
+  }
+
+  if constexpr (!std::is_same_v<Impl::Simplified<_expr>, _expr>) {
+    Assign(_dst, Simplify(_e), _policy);
+  } else if constexpr (Impl::IsProduct<_expr>::value ||
+                       Impl::HasBulkOperand<_core_impl, _expr>() ||
+                       Impl::IsBulkPermutation<_core_impl, _expr>()) {
+    Assign(_dst, _e);
+  } else {
+    SGLTY_TRACE_SCOPE(_expr);
+
+    constexpr bool row_major =
+        Types::Matrix<_core_impl>::core_major == Core::Major::Row;
+    constexpr std::size_t outer = row_major ? _expr::rows : _expr::cols;
+    constexpr std::size_t inner = row_major ? _expr::cols : _expr::rows;
+
+    Exec::ParallelFor(
+        0,
+        outer,
+        [&](std::size_t lo, std::size_t hi) {
+          Impl::AssignOuter(_dst, _e, lo, hi);
+        },
+        _policy.threads,
+        (Exec::par_min_work + inner - 1) / inner);
+  }
+}
+
+template <typename _expr>
+auto Evaluate(const _expr& _e, Exec::Par _policy) {
+  static_assert(Traits::Expr::is_valid_v<_expr>,
+                "Error: `_expr` is not a valid expression type.");
+
+  Types::Matrix<typename _expr::core_impl> ret;
+  Assign(ret, _e, _policy);
+
+  return ret;
+}
+
+}  // namespace Sglty::Expr
+
+namespace Sglty::Op::Cmp {
+
+template <typename _lhs, typename _rhs>
+bool IsApprox(const _lhs& _l,
+              const _rhs& _r,
+              Exec::Par _policy,
+              double _rel,
+              double _abs) {
+  Impl::CheckOperands<_lhs, _rhs>();
+
+  constexpr std::size_t inner = Impl::inner_v<_lhs>;
+
+  std::atomic<bool> same{true};
+  Exec::ParallelFor(
+      0,
+      Impl::outer_v<_lhs>,
+      [&](std::size_t lo, std::size_t hi) {
+        for (std::size_t o = lo;
+             o < hi && same.load(std::memory_order_relaxed);
+             o++) {
+          bool ok;
+          if constexpr (Impl::IsFlatPair<_lhs, _rhs>::value) {
+            ok = Kernel::Approx(_l.Data() + o * inner,
+                                _r.Data() + o * inner,
+                                inner,
+                                _rel,
+                                _abs);
+          } else {
+            ok = Impl::CompareOuter(
+                _l, _r, o, o + 1, [&](const auto& a, const auto& b) {
+                  return Kernel::IsClose(a, b, _rel, _abs);
+                });
+          }
+          if (!ok) {
+            same.store(false, std::memory_order_relaxed);
+          }
+        }
+      },
+      _policy.threads,
+      (Exec::par_min_work + inner - 1) / inner);
+  return same.load(std::memory_order_relaxed);
+}
+
+}  // namespace Sglty::Op::Cmp
+
+// Singularity/Exec/Impl/Evaluate.tpp
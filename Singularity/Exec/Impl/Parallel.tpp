@@ -0,0 +1,223 @@
+#pragma once
+
+#include "../Parallel.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace Sglty::Exec {
+
+namespace Impl {
+
+/// Ranges of one `ParallelFor()` call still running or queued.
+struct Job {
+  std::mutex mutex;
+  std::condition_variable done;
+  std::size_t remaining = 0;
+};
+
+/// One range of a job; `call(ctx, index)` runs it.
+struct Task {
+  void (*call)(const void*, std::size_t);
+  const void* ctx;
+  std::size_t index;
+  Job* job;
+};
+
+/**
+ * Process-wide workers, started on first use and grown to the largest
+ * request. Threads that fail to start are simply not added: the caller runs
+ * whatever no worker picks up.
+ */
+class Pool {
+ public:
+  static Pool& Get() {
+    static Pool pool;
+    return pool;
+  }
+
+  Pool() = default;
+
+  Pool(const Pool&)            = delete;
+  Pool& operator=(const Pool&) = delete;
+
+  ~Pool() {
+    {
+      std::lock_guard<std::mutex> lock(_m_mutex);
+      _m_stop = true;
+    }
+    _m_ready.notify_all();
+    for (std::thread& worker : _m_workers) {
+      worker.join();
+    }
+  }
+
+  void Reserve(std::size_t _workers) {
+    std::lock_guard<std::mutex> lock(_m_mutex);
+    try {
+      while (_m_workers.size() < _workers) {
+        _m_workers.emplace_back([this] { _m_Work(); });
+      }
+    } catch (const std::system_error&) {
+      // Out of threads: run with the ones that started.
+    }
+  }
+
+  void Push(const Task& _task) {
+    {
+      std::lock_guard<std::mutex> lock(_m_mutex);
+      _m_tasks.push_back(_task);
+    }
+    _m_ready.notify_one();
+  }
+
+  /// Runs one queued task on the calling thread; `false` if none is queued.
+  bool RunOne() {
+    Task task{};
+    {
+      std::lock_guard<std::mutex> lock(_m_mutex);
+      if (_m_tasks.empty()) {
+        return false;
+      }
+      task = _m_tasks.front();
+      _m_tasks.pop_front();
+    }
+    Run(task);
+    return true;
+  }
+
+  static void Run(const Task& _task) {
+    _task.call(_task.ctx, _task.index);
+
+    // Notified under the lock: the waiting caller may destroy the job as
+    // soon as it can take the lock again.
+    std::lock_guard<std::mutex> lock(_task.job->mutex);
+    if (--_task.job->remaining == 0) {
+      _task.job->done.notify_all();
+    }
+  }
+
+ private:
+  std::mutex _m_mutex;
+  std::condition_variable _m_ready;
+  std::deque<Task> _m_tasks;
+  std::vector<std::thread> _m_workers;
+  bool _m_stop = false;
+
+  void _m_Work() {
+    for (;;) {
+      Task task{};
+      {
+        std::unique_lock<std::mutex> lock(_m_mutex);
+        _m_ready.wait(lock, [this] { return _m_stop || !_m_tasks.empty(); });
+        if (_m_tasks.empty()) {
+          return;
+        }
+        task = _m_tasks.front();
+        _m_tasks.pop_front();
+      }
+      Run(task);
+    }
+  }
+};
+
+}  // namespace Impl
+
+inline std::size_t HardwareThreads() {
+  const std::size_t n = std::thread::hardware_concurrency();
+  return n == 0 ? 1 : n;
+}
+
+template <typename Func>
+void ParallelFor(std::size_t _begin,
+                 std::size_t _end,
+                 Func&& _fn,
+                 std::size_t _threads,
+                 std::size_t _grain) {
+  if (_begin >= _end) {
+    return;
+  }
+
+  const std::size_t count = _end - _begin;
+  const std::size_t grain = std::max<std::size_t>(_grain, 1);
+
+  std::size_t threads = _threads == 0 ? HardwareThreads() : _threads;
+  threads = std::min(threads, (count + grain - 1) / grain);
+
+  if (threads <= 1) {
+    _fn(_begin, _end);
+    return;
+  }
+
+  std::exception_ptr error;
+  std::mutex error_mutex;
+
+  const auto run = [&](std::size_t t) {
+    try {
+      _fn(_begin + count * t / threads, _begin + count * (t + 1) / threads);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(error_mutex);
+      if (!error) {
+        error = std::current_exception();
+      }
+    }
+  };
+  using run_type = decltype(run);
+
+  Impl::Pool& pool = Impl::Pool::Get();
+  pool.Reserve(threads - 1);
+
+  Impl::Job job;
+  job.remaining = threads - 1;
+
+  std::size_t queued = 1;
+  try {
+    for (; queued < threads; queued++) {
+      pool.Push({[](const void* _ctx, std::size_t _t) {
+                   (*static_cast<const run_type*>(_ctx))(_t);
+                 },
+                 &run,
+                 queued,
+                 &job});
+    }
+  } catch (...) {
+    // Ranges that could not be queued run on the calling thread.
+    std::lock_guard<std::mutex> lock(job.mutex);
+    job.remaining -= threads - queued;
+  }
+  run(0);
+  for (std::size_t t = queued; t < threads; t++) {
+    run(t);
+  }
+
+  // Help with queued ranges (ours or those of other calls, which keeps
+  // nested calls from waiting on each other), then wait for the rest.
+  for (;;) {
+    {
+      std::lock_guard<std::mutex> lock(job.mutex);
+      if (job.remaining == 0) {
+        break;
+      }
+    }
+    if (!pool.RunOne()) {
+      std::unique_lock<std::mutex> lock(job.mutex);
+      job.done.wait(lock, [&] { return job.remaining == 0; });
+      break;
+    }
+  }
+
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+}  // namespace Sglty::Exec
+
+// Singularity/Exec/Impl/Parallel.tpp
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstddef>
+
+namespace Sglty::Exec {
+
+/**
+ * @brief Number of threads used when a caller requests `0` (automatic).
+ *
+ * Equals `std::thread::hardware_concurrency()`, or 1 if that is unknown.
+ */
+std::size_t HardwareThreads();
+
+/**
+ * @brief Execution policy requesting multithreaded evaluation.
+ *
+ * Passed to the `Expr::Evaluate()`, `Expr::Assign()` and `Op::Cmp::IsApprox()`
+ * overloads declared in `Exec/Evaluate.hpp`, e.g.
+ * `Evaluate(Mat::Random(seed), Exec::Par{})`.
+ */
+struct Par {
+  /// Maximum number of threads; `0` uses `HardwareThreads()`.
+  std::size_t threads = 0;
+};
+
+/**
+ * @brief Smallest number of elements a parallel evaluation gives to one
+ * thread.
+ *
+ * Smaller expressions are evaluated on the calling thread only.
+ */
+constexpr inline std::size_t par_min_work = 1 << 14;
+
+/**
+ * @brief Splits `[_begin, _end)` into contiguous ranges and runs them on
+ * worker threads.
+ *
+ * `_fn(lo, hi)` is called once per range; the ranges are disjoint and cover
+ * the whole interval. The other ranges are queued on a process-wide pool of
+ * worker threads, started at the first call and grown to the largest number
+ * of threads requested, so repeated calls do not start threads. The calling
+ * thread runs the first range itself and then helps with queued ranges until
+ * its own are done, which also lets `_fn` call `ParallelFor()` again. A
+ * single-threaded request never touches the pool, and if threads cannot be
+ * started the calling thread runs what no worker picks up.
+ *
+ * If any invocation throws, the first exception is rethrown after all ranges
+ * have finished.
+ *
+ * @tparam Func Callable accepting `(std::size_t lo, std::size_t hi)`.
+ * @param _begin   First index.
+ * @param _end     One past the last index.
+ * @param _fn      The work to run.
+ * @param _threads Maximum number of threads; `0` uses `HardwareThreads()`.
+ * @param _grain   Minimum number of indices per range.
+ */
+template <typename Func>
+void ParallelFor(std::size_t _begin,
+                 std::size_t _end,
+                 Func&& _fn,
+                 std::size_t _threads = 0,
+                 std::size_t _grain   = 1);
+
+}  // namespace Sglty::Exec
+
+#include "Impl/Parallel.tpp"
+
+// Singularity/Exec/Parallel.hpp
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <type_traits>
+
+#include "../Fwd.hpp"
+#include "Cost.hpp"
+
+namespace Sglty::Expr {
+
+namespace Impl {
+
+// Element-wise functions whose kernel can run in place over the destination
+// once the operand has been written there. Specialized next to the nodes,
+// in `Op/Math`, so the kernels are only parsed where the functions are used.
+template <typename _expr>
+struct IsMathFunc : std::false_type {};
+
+template <typename _core_impl, typename _expr>
+bool Overlaps(const Types::Matrix<_core_impl>& _dst, const _expr& _e);
+
+}  // namespace Impl
+
+/**
+ * @brief Evaluates an expression into an existing matrix.
+ *
+ * This is the single point through which every expression is materialized:
+ * `Evaluate()`, the `Matrix` expression and conversion constructors, and the
+ * `Matrix` assignment operators all forward here. Evaluation strategies and
+ * instrumentation hook in at this level so every entry point benefits.
+ *
+ * A costly subtree that occurs more than once over equal operands is first
+ * evaluated into a temporary and shared (see `Expr::Cached`); the
+ * expression is then rewritten by `Expr::Simplify()`. Elements are
+ * written in the destination's memory order, or in cache-sized tiles when
+ * the layouts of the destination and the operands disagree (see
+ * `Expr::Plan`). At runtime, matrix products of
+ * at least `Kernel::gemm_min_work` multiply-adds go to the `Kernel::Backend`
+ * that is selected or forced, if the operands allow it (see
+ * `Kernel::BackendMul()`), and otherwise to
+ * `Kernel::Gemm()`, which fuses lazy operand nodes such as `Cast` and
+ * `Reorder` into its packing step, or by `Kernel::QGemm()` with int32
+ * accumulation when both operands hold 8-bit integers. A converted product
+ * (`Op::Cnv::Cast<std::int32_t>(a * b)`) takes the same path, converting
+ * each accumulator as it is stored, and a product with a hoisted scalar is
+ * scaled in place afterwards. `Cast()` of a contiguous matrix into one of
+ * the same layout is a single `Kernel::Convert()` call, and `Trp()`,
+ * `Reorder()` or a plain copy of a contiguous matrix either copies its
+ * storage or runs `Kernel::Transpose()` on it.
+ * Element-wise functions (`Op::Math`) assigned to a contiguous `float` or
+ * `double` matrix write their operand first and then run their SIMD kernel
+ * over it in place, a block of rows at a time.
+ * A copy-on-write destination (`Traits::Core::is_copy_on_write_v`) is
+ * detached once and written through a `Core::Map` over its storage.
+ * At runtime, an expression with a matrix operand whose storage overlaps
+ * the destination is evaluated into a heap temporary and copied over,
+ * unless the operand is laid out exactly like the destination and only
+ * read element-wise (`m = m * 2.0f + m`), which is safe in place.
+ *
+ * @tparam _core_impl The core implementation of the destination.
+ * @tparam _expr      The expression type. Must satisfy
+ * `Sglty::Traits::Expr::is_valid_v` and match the destination's shape.
+ * @param _dst The matrix to write into.
+ * @param _e   The expression to evaluate.
+ */
+template <typename _core_impl, typename _expr>
+constexpr void Assign(Types::Matrix<_core_impl>& _dst, const _expr& _e);
+
+/**
+ * @brief Adds an expression into an existing matrix.
+ *
+ * Backs `Matrix::operator+=` and `Matrix::operator-=`. Expressions known to
+ * be zero off the diagonal (an `Identity` generator, possibly scaled,
+ * negated or cast) only update the diagonal.
+ *
+ * @tparam _core_impl The core implementation of the destination.
+ * @tparam _expr      The expression type. Must satisfy
+ * `Sglty::Traits::Expr::is_valid_v` and match the destination's shape.
+ * @param _dst The matrix to add into.
+ * @param _e   The expression to add.
+ */
+template <typename _core_impl, typename _expr>
+constexpr void AddAssign(Types::Matrix<_core_impl>& _dst, const _expr& _e);
+
+/**
+ * @brief Estimates what `Assign()` of `_expr` costs, temporaries included.
+ *
+ * This is `_expr::cost()`, except that every subtree `Assign()` shares (see
+ * `Expr::Cached`) is evaluated once into a temporary, counted in
+ * `Cost::temporaries`, and read back from it. Whether the occurrences hold
+ * equal leaves is only known at runtime; the estimate assumes they do.
+ *
+ * @tparam _expr The expression type. Must satisfy
+ * `Sglty::Traits::Expr::is_valid_v`.
+ * @return The compile-time cost descriptor.
+ */
+template <typename _expr>
+constexpr Cost AssignCost();
+
+/**
+ * @brief Estimates what `Assign(_dst, _e)` costs, temporaries included.
+ *
+ * `AssignCost<_expr>()`, plus the temporary and the copy into `_dst` when
+ * `_e` reads the storage of `_dst` in a way that cannot be evaluated in
+ * place.
+ *
+ * @tparam _core_impl The core implementation of the destination.
+ * @tparam _expr      The expression type. Must satisfy
+ * `Sglty::Traits::Expr::is_valid_v` and match the destination's shape.
+ * @param _dst The matrix that would be written.
+ * @param _e   The expression that would be evaluated.
+ * @return The cost descriptor.
+ */
+template <typename _core_impl, typename _expr>
+Cost AssignCost(const Types::Matrix<_core_impl>& _dst, const _expr& _e);
+
+}  // namespace Sglty::Expr
+
+#include "Impl/Assign.tpp"
+
+// Singularity/Expr/Assign.hpp
@@ -1,7 +1,10 @@
 #pragma once
 
 #include <cstddef>
+#include <type_traits>
 
+#include "Cost.hpp"
+#include "Operand.hpp"
 #include "Tag.hpp"
 #include "../Traits/Expr.hpp"
 #include "../Traits/Op.hpp"
@@ -42,8 +45,9 @@ struct Binary : Tag {
 
   static_assert(Traits::Expr::is_valid_v<lhs_type>,
                 "Error: `_lhs` is not a valid expression type.");
-  static_assert(Traits::Expr::is_valid_v<rhs_type>,
-                "Error: `_rhs` is not a valid expression type.");
+  static_assert(Traits::Expr::is_valid_v<rhs_type> ||
+                    std::is_arithmetic_v<rhs_type>,
+                "Error: `_rhs` is neither a valid expression nor a scalar.");
 
   /**
    * @brief The operation tag describing evaluation logic.
@@ -78,6 +82,17 @@ struct Binary : Tag {
   constexpr static std::size_t cols =
       op_type::template cols<lhs_type, rhs_type>;
 
+  /**
+   * @brief Estimates the cost of evaluating this expression.
+   *
+   * Uses `op_type::cost` when the operation provides one, otherwise assumes
+   * one flop per element plus one read of each operand. The write-back of the
+   * result and `sizeof(Binary)` are added on top.
+   *
+   * @return The compile-time cost descriptor.
+   */
+  constexpr static Cost cost();
+
   /**
    * @brief Constructs a Binary expression from two operands.
    *
@@ -99,11 +114,11 @@ struct Binary : Tag {
    */
   constexpr auto operator()(std::size_t i, std::size_t j) const;
 
-  /// Left-hand operand (stored by value).
-  const lhs_type _l;
+  /// Left-hand operand; see `operand_t`.
+  operand_t<lhs_type> _l;
 
-  /// Right-hand operand (stored by value).
-  const rhs_type _r;
+  /// Right-hand operand; see `operand_t`.
+  operand_t<rhs_type> _r;
 };
 
 }  // namespace Sglty::Expr
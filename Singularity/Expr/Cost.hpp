@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstddef>
+
+namespace Sglty::Expr {
+
+/**
+ * @brief Compile-time estimate of what evaluating an expression costs.
+ *
+ * Every expression node exposes `static constexpr Cost cost()`, describing a
+ * full evaluation of the node into a `Matrix<core_impl>` with the default
+ * element-by-element evaluator. Operations contribute their share through an
+ * optional `cost` member next to `rows`, `cols` and `core_impl`; see
+ * `Sglty::Traits::Op::has_cost_v`.
+ *
+ * Example Usage:
+ * ```
+ * constexpr auto c = decltype(a * b + c)::cost();
+ * static_assert(c.flops <= 1'000'000);
+ * ```
+ *
+ * All quantities are estimates for capacity planning and evaluator decisions.
+ * They count what the lazy evaluator does, so an operand that is re-read by a
+ * product is counted once per read. Buffers that `Expr::Assign()` allocates
+ * for its kernels (e.g. `Kernel::Gemm()` packing) are not part of the cost;
+ * the intermediate matrices it materializes are, through
+ * `Expr::AssignCost()`. The cost is informational: no evaluation strategy
+ * is chosen from it.
+ */
+struct Cost {
+  /// Arithmetic operations performed.
+  std::size_t flops = 0;
+
+  /// Bytes loaded from matrix storage.
+  std::size_t bytes_read = 0;
+
+  /// Bytes stored into the result matrix.
+  std::size_t bytes_written = 0;
+
+  /// Intermediate matrices materialized during evaluation. Always zero in a
+  /// node's `cost()`; see `Expr::AssignCost()`.
+  std::size_t temporaries = 0;
+
+  /// `sizeof` of the expression object itself.
+  std::size_t expr_size = 0;
+
+  /**
+   * @brief Combines two costs incurred one after another.
+   *
+   * All counters are summed, except `expr_size` which keeps the larger value
+   * (an expression's size already includes the size of its operands).
+   */
+  constexpr Cost operator+(const Cost& _other) const;
+
+  /**
+   * @brief Scales a cost incurred `_times` times.
+   *
+   * `expr_size` is left unchanged.
+   */
+  constexpr Cost operator*(std::size_t _times) const;
+};
+
+/**
+ * @brief Cost of reading every element of an operand once inside a larger
+ * expression.
+ *
+ * This is `_expr::cost()` without the result write-back and without the
+ * object size, which is what an operation adds when it consumes `_expr`.
+ * Non-expression operands (e.g. the scalar of `MulScalar`) cost nothing.
+ *
+ * @tparam _expr The operand type.
+ */
+template <typename _expr>
+constexpr Cost OperandCost();
+
+}  // namespace Sglty::Expr
+
+#include "Impl/Cost.tpp"
+
+// Singularity/Expr/Cost.hpp
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstddef>
+
+#include "../Fwd.hpp"
+#include "Cost.hpp"
+#include "Tag.hpp"
+
+namespace Sglty::Expr {
+
+/**
+ * @brief Leaf expression reading an already evaluated subexpression.
+ *
+ * `Expr::Assign()` eliminates common subexpressions before evaluating an
+ * expression: when the same expensive subtree appears more than once, as the
+ * product in `(a * b) + Trp(a * b)` or `Exp(x) * (a * b) - (a * b)`, it is
+ * evaluated once into a temporary that lives for the rest of the assignment,
+ * and every occurrence is replaced by a `Cached` node pointing at it.
+ *
+ * A subtree is shared if its type repeats and every occurrence holds equal
+ * leaves. Leaf matrices are compared by address, then by content, since
+ * `Dense` leaves are held by value (`Kernel::Equal()` for contiguous
+ * arithmetic storage), scalars with `==`, and generators only match when they carry no
+ * state. Only subtrees worth a temporary take part: matrix products and
+ * element-wise functions (`Op::Math`), not views such as `Trp()` or single
+ * additions, which are cheaper to recompute than to store and read back.
+ *
+ * `Cached` is created by `Assign()` and never outlives it; it does not own
+ * the matrix it reads.
+ *
+ * @tparam _expr The replaced subexpression type.
+ */
+template <typename _expr>
+struct Cached : Tag {
+  /**
+   * @brief The core implementation of the cached result.
+   */
+  using core_impl = typename _expr::core_impl;
+
+  /**
+   * @brief The matrix holding the cached result.
+   */
+  using matrix_type = Types::Matrix<core_impl>;
+
+  /**
+   * @brief Number of rows in the cached result.
+   */
+  constexpr static std::size_t rows = _expr::rows;
+
+  /**
+   * @brief Number of columns in the cached result.
+   */
+  constexpr static std::size_t cols = _expr::cols;
+
+  /**
+   * @brief Estimates the cost of reading the cached result.
+   *
+   * Every element is read once, with no arithmetic, like a `Matrix` leaf.
+   *
+   * @return The compile-time cost descriptor.
+   */
+  constexpr static Cost cost();
+
+  /**
+   * @brief Constructs a node reading `_m`.
+   *
+   * @param _m The evaluated subexpression. Must outlive the node.
+   */
+  constexpr explicit Cached(const matrix_type& _m);
+
+  /**
+   * @brief Reads the cached element at (i, j).
+   *
+   * @param i The row index.
+   * @param j The column index.
+   * @return The element at position (i, j).
+   */
+  constexpr auto operator()(std::size_t i, std::size_t j) const;
+
+  /// The evaluated subexpression (not owned).
+  const matrix_type* _m;
+};
+
+}  // namespace Sglty::Expr
+
+#include "Impl/Cse.tpp"
+
+// Singularity/Expr/Cse.hpp
@@ -2,6 +2,7 @@
 
 #include <cstddef>
 
+#include "Cost.hpp"
 #include "Tag.hpp"
 #include "../Core/Dummy.hpp"
 
@@ -33,6 +34,11 @@ struct Dummy : Tag {
    */
   using core_impl = Core::Dummy;
 
+  /**
+   * @brief Cost of the dummy expression (always zero).
+   */
+  constexpr static Cost cost();
+
   /**
    * @brief Trivial evaluation of the dummy expression.
    *
@@ -44,6 +50,16 @@ struct Dummy : Tag {
    * @return Dummy int value (reference to internal dummy state).
    */
   constexpr auto operator()(std::size_t i, std::size_t j) const;
+
+  /**
+   * @brief Converts to a dummy scalar.
+   *
+   * Lets operations taking a scalar operand (e.g. `MulScalar`) be probed with
+   * `Dummy` in place of the scalar.
+   *
+   * @return Always `0`.
+   */
+  constexpr operator int() const;
 };
 
 }  // namespace Sglty::Expr
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "../Fwd.hpp"
+
 namespace Sglty::Expr {
 
 /**
@@ -12,7 +14,8 @@ namespace Sglty::Expr {
  * the result using the associated `core_impl` of the expression.
  *
  * The returned type is always a concrete `Matrix<core_impl>`, with all values
- * computed according to the expression logic.
+ * computed according to the expression logic. The tree is first rewritten by
+ * `Simplify()`, e.g. `Trp(Trp(a))` evaluates as `a`.
  *
  * @tparam _expr The expression type. Must satisfy
  * `Sglty::Traits::Expr::is_valid_v`.
@@ -0,0 +1,674 @@
+#pragma once
+
+#include "../Assign.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "../../Config.hpp"
+#include "../../Core/Map.hpp"
+#include "../../Instr/Trace.hpp"
+#include "../../Kernel/Convert.hpp"
+#include "../../Kernel/Gemm.hpp"
+#include "../../Kernel/Isa.hpp"
+#include "../../Kernel/QGemm.hpp"
+#include "../../Kernel/Route.hpp"
+#include "../../Kernel/Transpose.hpp"
+#include "../../Traits/Core.hpp"
+#include "../../Traits/Expr.hpp"
+#include "../../Types/Matrix.hpp"
+#include "../Cse.hpp"
+#include "../Plan.hpp"
+#include "../Simplify.hpp"
+
+namespace Sglty::Expr {
+
+namespace Impl {
+
+template <typename _expr>
+struct IsProduct : std::false_type {};
+
+template <typename _lhs, typename _rhs>
+struct IsProduct<Binary<_lhs, _rhs, MulMatrix>> : std::true_type {
+  constexpr static const Binary<_lhs, _rhs, MulMatrix>& Get(
+      const Binary<_lhs, _rhs, MulMatrix>& _e) {
+    return _e;
+  }
+};
+
+// A converted product (e.g. int8 operands into an int32 result) runs through
+// the product kernels, converting each accumulator as it is stored.
+template <typename _lhs, typename _rhs, typename _Up>
+struct IsProduct<Unary<Binary<_lhs, _rhs, MulMatrix>, Cast<_Up>>>
+    : std::true_type {
+  constexpr static const Binary<_lhs, _rhs, MulMatrix>& Get(
+      const Unary<Binary<_lhs, _rhs, MulMatrix>, Cast<_Up>>& _e) {
+    return _e._o;
+  }
+};
+
+// A product with a scalar hoisted out of it by `Simplify()` runs through the
+// product kernels and is then scaled in place.
+template <typename _lhs, typename _rhs, typename _scalar>
+struct IsProduct<Binary<Binary<_lhs, _rhs, MulMatrix>, _scalar, MulScalar>>
+    : std::true_type {
+  constexpr static const Binary<_lhs, _rhs, MulMatrix>& Get(
+      const Binary<Binary<_lhs, _rhs, MulMatrix>, _scalar, MulScalar>& _e) {
+    return _e._l;
+  }
+};
+
+template <typename _expr>
+struct IsConversion : std::false_type {};
+
+template <typename _core_impl, typename _Up>
+struct IsConversion<Unary<Types::Matrix<_core_impl>, Cast<_Up>>>
+    : std::true_type {};
+
+// A matrix read through `Trp` or in another layout: a pure permutation of
+// its storage. `transposed` is true if the logical indices are swapped.
+template <typename _expr>
+struct IsPermutation : std::false_type {};
+
+template <typename _core_impl>
+struct IsPermutation<Types::Matrix<_core_impl>> : std::true_type {
+  constexpr static bool transposed = false;
+};
+
+template <typename _core_impl>
+struct IsPermutation<Unary<Types::Matrix<_core_impl>, Trp>> : std::true_type {
+  constexpr static bool transposed = true;
+};
+
+template <typename _core_impl, Core::Major _major>
+struct IsPermutation<Unary<Types::Matrix<_core_impl>, Reorder<_major>>>
+    : std::true_type {
+  constexpr static bool transposed = false;
+};
+
+// The contiguous matrix a permutation reads.
+template <typename _core_impl>
+constexpr const Types::Matrix<_core_impl>& PermutedMatrix(
+    const Types::Matrix<_core_impl>& _m) {
+  return _m;
+}
+
+template <typename _operand, typename _op>
+constexpr const _operand& PermutedMatrix(const Unary<_operand, _op>& _e) {
+  return _e._o;
+}
+
+// True if `_expr` permutes a matrix with contiguous (possibly padded) rows or
+// columns into `_core_impl` with the same value type and line layout, so it
+// can be copied or transposed line by line.
+template <typename _core_impl, typename _expr>
+constexpr bool IsBulkPermutation() {
+  if constexpr (IsPermutation<_expr>::value) {
+    using src_type = std::decay_t<decltype(PermutedMatrix(
+        std::declval<const _expr&>()))>;
+    return Traits::Core::is_inner_contiguous_v<_core_impl> &&
+           Traits::Core::is_inner_contiguous_v<
+               typename src_type::core_impl> &&
+           std::is_same_v<typename Types::Matrix<_core_impl>::value_type,
+                          typename src_type::value_type>;
+  } else {
+    return false;
+  }
+}
+
+template <typename _expr>
+struct IsDiagonal : std::false_type {};
+
+template <typename _matrix, typename _value>
+struct IsDiagonal<Nullary<_matrix, Identity<_value>>> : std::true_type {};
+
+template <typename _lhs, typename _rhs>
+struct IsDiagonal<Binary<_lhs, _rhs, MulScalar>> : IsDiagonal<_lhs> {};
+
+template <typename _operand>
+struct IsDiagonal<Unary<_operand, Neg>> : IsDiagonal<_operand> {};
+
+template <typename _operand, typename _Up>
+struct IsDiagonal<Unary<_operand, Cast<_Up>>> : IsDiagonal<_operand> {};
+
+// True if `_expr` is an element-wise function whose kernel can run over the
+// contiguous `float` or `double` storage of `_core_impl`.
+template <typename _core_impl, typename _expr>
+constexpr bool IsBulkMath() {
+  if constexpr (IsMathFunc<_expr>::value) {
+    using value_type = typename Types::Matrix<_core_impl>::value_type;
+    return Traits::Core::is_contiguous_v<_core_impl> &&
+           IsMathFunc<_expr>::template is_lane_v<value_type> &&
+           std::is_same_v<value_type, typename _expr::core_impl::value_type>;
+  } else {
+    return false;
+  }
+}
+
+// True if the operand of a bulk function has a kernel of its own (a product,
+// a conversion or another bulk function) and is best assigned whole.
+template <typename _core_impl, typename _expr>
+constexpr bool HasBulkOperand() {
+  if constexpr (IsBulkMath<_core_impl, _expr>()) {
+    using operand = std::decay_t<decltype(IsMathFunc<_expr>::Operand(
+        std::declval<const _expr&>()))>;
+    return IsProduct<operand>::value || IsConversion<operand>::value ||
+           IsBulkMath<_core_impl, operand>();
+  } else {
+    return false;
+  }
+}
+
+// Elements per block of a blocked bulk function: small enough for the block
+// to still be in L1 when the kernel reads it back.
+constexpr inline std::size_t math_block = 4096;
+
+// A `Map` over the storage of a copy-on-write destination. Taking `Data()`
+// detaches it once, instead of checking the count at every element write.
+template <typename _core_impl>
+auto WriteView(Types::Matrix<_core_impl>& _dst) {
+  using dst_type = Types::Matrix<_core_impl>;
+  using map_type = Core::Map<typename dst_type::value_type,
+                             dst_type::rows,
+                             dst_type::cols,
+                             dst_type::core_major>;
+
+  return Types::Matrix<map_type>(_dst.Data());
+}
+
+// Calls `_traverse`, an element-wise loop writing `_dst`, in the
+// `ActiveIsa()` variant when that is worth three copies of it: arithmetic
+// elements, at least `Kernel::isa_min_work` of them.
+template <typename _core_impl, typename _fn>
+void TraverseIsa(_fn&& _traverse) {
+  using matrix = Types::Matrix<_core_impl>;
+
+  if constexpr (std::is_arithmetic_v<typename matrix::value_type> &&
+                matrix::rows * matrix::cols >= Kernel::isa_min_work) {
+    Kernel::IsaDispatch(_traverse);
+  } else {
+    _traverse(Kernel::IsaTag<Kernel::Isa::Baseline>{});
+  }
+}
+
+// Writes the outer indices [_lo, _hi) of `_dst` in the order chosen by
+// `Plan`. A bulk function writes its operand first and then runs its kernel
+// in place.
+template <typename _core_impl, typename _expr>
+void AssignOuter(Types::Matrix<_core_impl>& _dst,
+                 const _expr& _e,
+                 std::size_t _lo,
+                 std::size_t _hi) {
+  constexpr bool row_major =
+      Types::Matrix<_core_impl>::core_major == Core::Major::Row;
+
+  if constexpr (IsBulkMath<_core_impl, _expr>()) {
+    constexpr std::size_t inner = row_major ? _expr::cols : _expr::rows;
+
+    AssignOuter(_dst, IsMathFunc<_expr>::Operand(_e), _lo, _hi);
+    IsMathFunc<_expr>::Apply(
+        _e, _dst.Data() + _lo * inner, (_hi - _lo) * inner);
+  } else {
+    TraverseIsa<_core_impl>([&](auto) {
+      Plan<_core_impl, _expr>::Traverse(
+          _lo, _hi, [&](std::size_t i, std::size_t j) {
+            _dst(i, j) = _e(i, j);
+          });
+    });
+  }
+}
+
+// True if `_op` reads element (i, j) of its operands to produce element
+// (i, j), so an operand stored exactly where the result goes may be
+// overwritten while it is read.
+template <typename _op>
+struct IsInPlace : std::false_type {};
+
+template <>
+struct IsInPlace<Add> : std::true_type {};
+
+template <>
+struct IsInPlace<Sub> : std::true_type {};
+
+template <>
+struct IsInPlace<Neg> : std::true_type {};
+
+template <>
+struct IsInPlace<MulScalar> : std::true_type {};
+
+template <>
+struct IsInPlace<PowScalar> : std::true_type {};
+
+template <typename _fn>
+struct IsInPlace<Cwise<_fn>> : std::true_type {};
+
+template <typename _fn>
+struct IsInPlace<Func<_fn>> : std::true_type {};
+
+template <typename _Up>
+struct IsInPlace<Cast<_Up>> : std::true_type {};
+
+template <Core::Major _major>
+struct IsInPlace<Reorder<_major>> : std::true_type {};
+
+// First and one-past-last byte of the elements of `_m`.
+template <typename _core_impl>
+std::pair<std::uintptr_t, std::uintptr_t> Extent(
+    const Types::Matrix<_core_impl>& _m) {
+  using matrix = Types::Matrix<_core_impl>;
+
+  constexpr std::size_t last =
+      (matrix::rows - 1) * Traits::Core::row_stride_v<_core_impl> +
+      (matrix::cols - 1) * Traits::Core::col_stride_v<_core_impl>;
+
+  const auto first = reinterpret_cast<std::uintptr_t>(_m.Data());
+  return {first, first + (last + 1) * sizeof(typename matrix::value_type)};
+}
+
+// Whether writing `_dst` element by element can change what `_e` reads
+// before it is read. `_in_place` is true while every node above `_e` is
+// element-wise (`IsInPlace`): a leaf laid out exactly like `_dst` is then
+// read at (i, j) just before (i, j) is written, which is safe. Any other
+// overlap of a leaf with `_dst`, such as `m = Trp(m)`, `m = m * m` or a
+// `Core::Map` over part of `m`, is not.
+template <typename _expr>
+struct Aliases {
+  // Scalars, generators and `Cached` read no destination storage.
+  template <typename _core_impl>
+  static bool Apply(const Types::Matrix<_core_impl>&, const _expr&, bool) {
+    return false;
+  }
+};
+
+template <typename _core_src>
+struct Aliases<Types::Matrix<_core_src>> {
+  template <typename _core_impl>
+  static bool Apply(const Types::Matrix<_core_impl>& _dst,
+                    const Types::Matrix<_core_src>& _src,
+                    bool _in_place) {
+    if constexpr (_core_src::core_traits::core_type != Core::Type::Dense ||
+                  _core_impl::core_traits::core_type != Core::Type::Dense) {
+      return static_cast<const void*>(&_src) ==
+             static_cast<const void*>(&_dst);
+    } else {
+      const auto src = Extent(_src);
+      const auto dst = Extent(_dst);
+      if (src.second <= dst.first || dst.second <= src.first) {
+        return false;
+      }
+
+      constexpr bool same_layout =
+          std::is_same_v<typename Types::Matrix<_core_src>::value_type,
+                         typename Types::Matrix<_core_impl>::value_type> &&
+          Traits::Core::row_stride_v<_core_src> ==
+              Traits::Core::row_stride_v<_core_impl> &&
+          Traits::Core::col_stride_v<_core_src> ==
+              Traits::Core::col_stride_v<_core_impl>;
+      return !(_in_place && same_layout && src.first == dst.first);
+    }
+  }
+};
+
+template <typename _operand, typename _op>
+struct Aliases<Unary<_operand, _op>> {
+  template <typename _core_impl>
+  static bool Apply(const Types::Matrix<_core_impl>& _dst,
+                    const Unary<_operand, _op>& _e,
+                    bool _in_place) {
+    return Aliases<_operand>::Apply(
+        _dst, _e._o, _in_place && IsInPlace<_op>::value);
+  }
+};
+
+template <typename _lhs, typename _rhs, typename _op>
+struct Aliases<Binary<_lhs, _rhs, _op>> {
+  template <typename _core_impl>
+  static bool Apply(const Types::Matrix<_core_impl>& _dst,
+                    const Binary<_lhs, _rhs, _op>& _e,
+                    bool _in_place) {
+    _in_place = _in_place && IsInPlace<_op>::value;
+    return Aliases<_lhs>::Apply(_dst, _e._l, _in_place) ||
+           Aliases<_rhs>::Apply(_dst, _e._r, _in_place);
+  }
+};
+
+// Whether `_e` must be evaluated into a temporary before `_dst` is written.
+template <typename _core_impl, typename _expr>
+bool IsAliased(const Types::Matrix<_core_impl>& _dst, const _expr& _e) {
+  return Aliases<_expr>::Apply(_dst, _e, true);
+}
+
+// Whether `_e` reads the storage of `_dst` at all.
+template <typename _core_impl, typename _expr>
+bool Overlaps(const Types::Matrix<_core_impl>& _dst, const _expr& _e) {
+  return Aliases<_expr>::Apply(_dst, _e, false);
+}
+
+// Owns the elements of the temporary for a core without an allocator. They
+// are allocated rather than kept on the stack, since `Map` and `Mapped`
+// destinations may be arbitrarily large.
+template <typename _Tp>
+class TemporaryBuffer {
+ public:
+  explicit TemporaryBuffer(std::size_t _size) : _m_data(new _Tp[_size]) {}
+
+  TemporaryBuffer(const TemporaryBuffer&)            = delete;
+  TemporaryBuffer& operator=(const TemporaryBuffer&) = delete;
+
+  ~TemporaryBuffer() { delete[] _m_data; }
+
+  _Tp* Data() const { return _m_data; }
+
+ private:
+  _Tp* _m_data;
+};
+
+template <typename _core_impl, typename = void>
+struct HasAllocator : std::false_type {};
+
+template <typename _core_impl>
+struct HasAllocator<_core_impl,
+                    std::void_t<typename _core_impl::allocator_type>>
+    : std::true_type {};
+
+// Passes `_use` a matrix shaped like `_dst`, to evaluate an aliased
+// expression into: another matrix of the same core if it allocates its
+// storage (`Core::Heap`), otherwise a `Core::Map` over a `TemporaryBuffer`.
+template <typename _core_impl, typename _fn>
+void WithTemporary(_fn&& _use) {
+  using matrix = Types::Matrix<_core_impl>;
+
+  if constexpr (HasAllocator<_core_impl>::value) {
+    matrix temp;
+    _use(temp);
+  } else {
+    using map_type = Core::Map<typename matrix::value_type,
+                               matrix::rows,
+                               matrix::cols,
+                               matrix::core_major>;
+
+    TemporaryBuffer<typename matrix::value_type> buffer(matrix::rows *
+                                                        matrix::cols);
+    Types::Matrix<map_type> temp(buffer.Data());
+    _use(temp);
+  }
+}
+
+// Evaluates `_e` into a temporary (see `WithTemporary`) and passes it to
+// `_write`.
+template <typename _core_impl, typename _expr, typename _fn>
+void ThroughTemporary(const _expr& _e, _fn&& _write) {
+  WithTemporary<_core_impl>([&](auto& _temp) {
+    Assign(_temp, _e);
+    _write(std::as_const(_temp));
+  });
+}
+
+// Evaluates the shared subtree of `_e` (see `Cached`) into a temporary and
+// passes `_e`, with every occurrence replaced, to `_eval`. Returns false,
+// without calling `_eval`, if the occurrences hold different leaves.
+template <typename _expr, typename _fn>
+bool EliminateShared(const _expr& _e, _fn&& _eval) {
+  using shared = shared_t<_expr>;
+
+  const shared* first = nullptr;
+  const bool    same  = ForEach<shared>(_e, [&](const shared& _s) {
+    if (first == nullptr) {
+      first = &_s;
+      return true;
+    }
+    return SameTree<shared>::Apply(*first, _s);
+  });
+  if (!same) {
+    return false;
+  }
+
+  Types::Matrix<typename shared::core_impl> temp;
+  Assign(temp, *first);
+  _eval(Substitute<shared>(_e, Cached<shared>(temp)));
+  return true;
+}
+
+// `_expr` with its shared subtree replaced, as `EliminateShared` evaluates
+// it.
+template <typename _expr>
+using without_shared_t = std::decay_t<decltype(Substitute<shared_t<_expr>>(
+    std::declval<const _expr&>(),
+    std::declval<const Cached<shared_t<_expr>>&>()))>;
+
+// Evaluates `_e` into `_dst` once `Assign()` has dealt with aliasing, shared
+// subtrees and simplification: through a kernel where one applies, otherwise
+// element by element.
+template <typename _core_impl, typename _expr>
+constexpr void AssignNode(Types::Matrix<_core_impl>& _dst, const _expr& _e) {
+  if constexpr (IsProduct<_expr>::value) {
+    const auto& p = IsProduct<_expr>::Get(_e);
+
+    using lhs_type  = typename std::decay_t<decltype(p)>::lhs_type;
+    using lhs_value = std::decay_t<decltype(p._l(0, 0))>;
+    using rhs_value = std::decay_t<decltype(p._r(0, 0))>;
+    using dst_value = typename Types::Matrix<_core_impl>::value_type;
+
+    // A scaled product is stored, then scaled; integers would truncate first.
+    constexpr bool scaled = IsBinaryOf<_expr, MulScalar>::value;
+    constexpr bool kernel = !(scaled && std::is_integral_v<dst_value>);
+
+    constexpr std::size_t work = _expr::rows * _expr::cols * lhs_type::cols;
+    if (kernel && work >= Kernel::gemm_min_work &&
+        !SGLTY_IS_CONSTANT_EVALUATED()) {
+      if constexpr (Kernel::is_quantized_v<lhs_value> &&
+                    Kernel::is_quantized_v<rhs_value>) {
+        Kernel::QGemm(_dst, p._l, p._r);
+      } else if (!Kernel::BackendMul(_dst, p._l, p._r)) {
+        Kernel::Gemm(_dst, p._l, p._r);
+      }
+      if constexpr (scaled) {
+        Types::Traverse(_dst, [&](std::size_t i, std::size_t j) {
+          _dst(i, j) = _dst(i, j) * _e._r;
+        });
+      }
+      return;
+    }
+  } else if constexpr (IsBulkMath<_core_impl, _expr>()) {
+    using math = IsMathFunc<_expr>;
+
+    if (!SGLTY_IS_CONSTANT_EVALUATED()) {
+      if constexpr (HasBulkOperand<_core_impl, _expr>()) {
+        Assign(_dst, math::Operand(_e));
+        math::Apply(_e, _dst.Data(), _expr::rows * _expr::cols);
+      } else {
+        constexpr bool row_major =
+            Types::Matrix<_core_impl>::core_major == Core::Major::Row;
+        constexpr std::size_t outer = row_major ? _expr::rows : _expr::cols;
+        constexpr std::size_t inner = row_major ? _expr::cols : _expr::rows;
+        constexpr std::size_t block = (math_block + inner - 1) / inner;
+
+        for (std::size_t lo = 0; lo < outer; lo += block) {
+          const std::size_t hi = lo + block < outer ? lo + block : outer;
+          AssignOuter(_dst, _e, lo, hi);
+        }
+      }
+      return;
+    }
+  } else if constexpr (IsBulkPermutation<_core_impl, _expr>()) {
+    const auto& src = PermutedMatrix(_e);
+
+    using src_type = std::decay_t<decltype(src)>;
+    using dst_type = Types::Matrix<_core_impl>;
+
+    // Storage order is unchanged when exactly one of a transpose and a
+    // change of major applies; otherwise the storage is transposed.
+    constexpr bool swap = (src_type::core_major != dst_type::core_major) !=
+                          IsPermutation<_expr>::transposed;
+    constexpr bool src_row = src_type::core_major == Core::Major::Row;
+    constexpr std::size_t outer = src_row ? src_type::rows : src_type::cols;
+    constexpr std::size_t inner = src_row ? src_type::cols : src_type::rows;
+
+    constexpr std::size_t src_ld = src_type::OuterStride();
+    constexpr std::size_t dst_ld = dst_type::OuterStride();
+
+    if (!SGLTY_IS_CONSTANT_EVALUATED()) {
+      if constexpr (swap) {
+        Kernel::Transpose(
+            src.Data(), src_ld, _dst.Data(), dst_ld, outer, inner);
+      } else if constexpr (src_ld == inner && dst_ld == inner) {
+        Kernel::Convert(src.Data(), _dst.Data(), outer * inner);
+      } else {
+        for (std::size_t o = 0; o < outer; o++) {
+          Kernel::Convert(
+              src.Data() + o * src_ld, _dst.Data() + o * dst_ld, inner);
+        }
+      }
+      return;
+    }
+  } else if constexpr (IsConversion<_expr>::value) {
+    using src_core = typename _expr::operand_type::core_impl;
+    using dst_type = Types::Matrix<_core_impl>;
+
+    // Same layout on both sides: one bulk conversion over `Data()`.
+    if constexpr (Traits::Core::is_contiguous_v<src_core> &&
+                  Traits::Core::is_contiguous_v<_core_impl> &&
+                  src_core::core_traits::core_major == dst_type::core_major &&
+                  std::is_same_v<typename dst_type::value_type,
+                                 typename _expr::core_impl::value_type>) {
+      if (!SGLTY_IS_CONSTANT_EVALUATED()) {
+        Kernel::Convert(_e._o.Data(), _dst.Data(), _expr::rows * _expr::cols);
+        return;
+      }
+    }
+  }
+
+  auto traverse = [&](auto) {
+    Plan<_core_impl, _expr>::Traverse(
+        [&](std::size_t i, std::size_t j) { _dst(i, j) = _e(i, j); });
+  };
+  if (!SGLTY_IS_CONSTANT_EVALUATED()) {
+    TraverseIsa<_core_impl>(traverse);
+  } else {
+    traverse(Kernel::IsaTag<Kernel::Isa::Baseline>{});
+  }
+}
+
+// The `AddAssign()` counterpart of `AssignNode`.
+template <typename _core_impl, typename _expr>
+constexpr void AddAssignNode(Types::Matrix<_core_impl>& _dst,
+                             const _expr& _e) {
+  if constexpr (IsDiagonal<_expr>::value) {
+    for (std::size_t k = 0; k < _expr::rows; k++) {
+      _dst(k, k) += _e(k, k);
+    }
+  } else {
+    Plan<_core_impl, _expr>::Traverse(
+        [&](std::size_t i, std::size_t j) { _dst(i, j) += _e(i, j); });
+  }
+}
+
+}  // namespace Impl
+
+template <typename _core_impl, typename _expr>
+constexpr void Assign(Types::Matrix<_core_impl>& _dst, const _expr& _e) {
+  static_assert(Traits::Expr::is_valid_v<_expr>,
+                "Error: `_expr` is not a valid expression type.");
+  static_assert(Types::Matrix<_core_impl>::rows == _expr::rows &&
+                    Types::Matrix<_core_impl>::cols == _expr::cols,
+                "Error: dimension mismatch.");
+
+  if constexpr (Traits::Core::is_copy_on_write_v<_core_impl>) {
+    auto view = Impl::WriteView(_dst);
+    Assign(view, _e);
+    return;
+  }
+
+  if (!SGLTY_IS_CONSTANT_EVALUATED() && Impl::IsAliased(_dst, _e)) {
+    Impl::ThroughTemporary<_core_impl>(
+        _e, [&](const auto& _t) { Assign(_dst, _t); });
+    return;
+  }
+
+  if constexpr (Impl::has_shared_v<_expr>) {
+    if (!SGLTY_IS_CONSTANT_EVALUATED() &&
+        Impl::EliminateShared(_e, [&](const auto& _s) { Assign(_dst, _s); })) {
+      return;
+    }
+  }
+
+  if constexpr (!std::is_same_v<Impl::Simplified<_expr>, _expr>) {
+    Assign(_dst, Simplify(_e));
+    return;
+  }
+
+  SGLTY_TRACE_CALL(_expr, Impl::AssignNode(_dst, _e));
+}
+
+template <typename _core_impl, typename _expr>
+constexpr void AddAssign(Types::Matrix<_core_impl>& _dst, const _expr& _e) {
+  static_assert(Traits::Expr::is_valid_v<_expr>,
+                "Error: `_expr` is not a valid expression type.");
+  static_assert(Types::Matrix<_core_impl>::rows == _expr::rows &&
+                    Types::Matrix<_core_impl>::cols == _expr::cols,
+                "Error: dimension mismatch.");
+
+  if constexpr (Traits::Core::is_copy_on_write_v<_core_impl>) {
+    auto view = Impl::WriteView(_dst);
+    AddAssign(view, _e);
+    return;
+  }
+
+  if (!SGLTY_IS_CONSTANT_EVALUATED() && Impl::IsAliased(_dst, _e)) {
+    Impl::ThroughTemporary<_core_impl>(
+        _e, [&](const auto& _t) { AddAssign(_dst, _t); });
+    return;
+  }
+
+  if constexpr (Impl::has_shared_v<_expr>) {
+    if (!SGLTY_IS_CONSTANT_EVALUATED() &&
+        Impl::EliminateShared(_e,
+                              [&](const auto& _s) { AddAssign(_dst, _s); })) {
+      return;
+    }
+  }
+
+  if constexpr (!std::is_same_v<Impl::Simplified<_expr>, _expr>) {
+    AddAssign(_dst, Simplify(_e));
+    return;
+  }
+
+  SGLTY_TRACE_CALL(_expr, Impl::AddAssignNode(_dst, _e));
+}
+
+template <typename _expr>
+constexpr Cost AssignCost() {
+  static_assert(Traits::Expr::is_valid_v<_expr>,
+                "Error: `_expr` is not a valid expression type.");
+
+  if constexpr (Impl::has_shared_v<_expr>) {
+    Cost temp        = AssignCost<Impl::shared_t<_expr>>();
+    temp.temporaries = temp.temporaries + 1;
+    return temp + AssignCost<Impl::without_shared_t<_expr>>();
+  } else {
+    return _expr::cost();
+  }
+}
+
+template <typename _core_impl, typename _expr>
+Cost AssignCost(const Types::Matrix<_core_impl>& _dst, const _expr& _e) {
+  static_assert(Types::Matrix<_core_impl>::rows == _expr::rows &&
+                    Types::Matrix<_core_impl>::cols == _expr::cols,
+                "Error: dimension mismatch.");
+
+  Cost ret = AssignCost<_expr>();
+  if (Impl::IsAliased(_dst, _e)) {
+    // The temporary is read back and copied into `_dst`.
+    Cost copy        = Types::Matrix<_core_impl>::cost();
+    copy.temporaries = 1;
+    copy.expr_size   = 0;
+    ret              = ret + copy;
+  }
+  return ret;
+}
+
+}  // namespace Sglty::Expr
+
+// Singularity/Expr/Impl/Assign.tpp
@@ -2,6 +2,8 @@
 
 #include "../Binary.hpp"
 
+#include "../../Traits/Op.hpp"
+
 namespace Sglty::Expr {
 
 template <typename _lhs, typename _rhs, typename _op>
@@ -9,6 +11,21 @@ constexpr Binary<_lhs, _rhs, _op>::Binary(const lhs_type& _l,
                                           const rhs_type& _r)
     : _l(_l), _r(_r) {}
 
+template <typename _lhs, typename _rhs, typename _op>
+constexpr Cost Binary<_lhs, _rhs, _op>::cost() {
+  Cost ret;
+  if constexpr (Traits::Op::has_cost_v<op_type, lhs_type, rhs_type>) {
+    ret = op_type::template cost<lhs_type, rhs_type>;
+  } else {
+    ret = OperandCost<lhs_type>() + OperandCost<rhs_type>() +
+          Cost{rows * cols};
+  }
+  ret.bytes_written =
+      rows * cols * sizeof(typename core_impl::type_traits::value_type);
+  ret.expr_size = sizeof(Binary);
+  return ret;
+}
+
 template <typename _lhs, typename _rhs, typename _op>
 constexpr auto Binary<_lhs, _rhs, _op>::operator()(std::size_t i,
                                                    std::size_t j) const {
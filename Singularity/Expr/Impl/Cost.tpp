@@ -0,0 +1,45 @@
+#pragma once
+
+#include "../Cost.hpp"
+
+#include <cstddef>
+
+#include "../../Traits/Expr.hpp"
+
+namespace Sglty::Expr {
+
+constexpr Cost Cost::operator+(const Cost& _other) const {
+  Cost ret;
+  ret.flops         = flops + _other.flops;
+  ret.bytes_read    = bytes_read + _other.bytes_read;
+  ret.bytes_written = bytes_written + _other.bytes_written;
+  ret.temporaries   = temporaries + _other.temporaries;
+  ret.expr_size = expr_size > _other.expr_size ? expr_size : _other.expr_size;
+  return ret;
+}
+
+constexpr Cost Cost::operator*(std::size_t _times) const {
+  Cost ret;
+  ret.flops         = flops * _times;
+  ret.bytes_read    = bytes_read * _times;
+  ret.bytes_written = bytes_written * _times;
+  ret.temporaries   = temporaries * _times;
+  ret.expr_size     = expr_size;
+  return ret;
+}
+
+template <typename _expr>
+constexpr Cost OperandCost() {
+  if constexpr (Traits::Expr::is_valid_v<_expr>) {
+    Cost ret          = _expr::cost();
+    ret.bytes_written = 0;
+    ret.expr_size     = 0;
+    return ret;
+  } else {
+    return Cost{};
+  }
+}
+
+}  // namespace Sglty::Expr
+
+// Singularity/Expr/Impl/Cost.tpp
@@ -0,0 +1,252 @@
+#pragma once
+
+#include "../Cse.hpp"
+
+#include <cstddef>
+#include <type_traits>
+
+#include "../Binary.hpp"
+#include "../Nullary.hpp"
+#include "../Unary.hpp"
+#include "../../Kernel/Compare.hpp"
+#include "../../Traits/Core.hpp"
+
+namespace Sglty::Expr {
+
+template <typename _expr>
+constexpr Cached<_expr>::Cached(const matrix_type& _m) : _m(&_m) {}
+
+template <typename _expr>
+constexpr Cost Cached<_expr>::cost() {
+  Cost ret;
+  ret.bytes_read =
+      rows * cols * sizeof(typename core_impl::type_traits::value_type);
+  ret.expr_size = sizeof(Cached);
+  return ret;
+}
+
+template <typename _expr>
+constexpr auto Cached<_expr>::operator()(std::size_t i, std::size_t j) const {
+  return (*_m)(i, j);
+}
+
+namespace Impl {
+
+template <typename... _exprs>
+struct TypeList {};
+
+template <typename _expr>
+struct TypeOf {
+  using type = _expr;
+};
+
+template <typename _expr>
+struct IsUnaryNode : std::false_type {};
+
+template <typename _operand, typename _op>
+struct IsUnaryNode<Unary<_operand, _op>> : std::true_type {};
+
+template <typename... _lists>
+struct Concat;
+
+template <>
+struct Concat<> {
+  using type = TypeList<>;
+};
+
+template <typename... _as>
+struct Concat<TypeList<_as...>> {
+  using type = TypeList<_as...>;
+};
+
+template <typename... _as, typename... _bs, typename... _rest>
+struct Concat<TypeList<_as...>, TypeList<_bs...>, _rest...>
+    : Concat<TypeList<_as..., _bs...>, _rest...> {};
+
+// Subtrees worth a temporary: products and element-wise functions. Views
+// and single arithmetic steps are cheaper to recompute than to store.
+template <typename _expr>
+struct IsCandidate : std::false_type {};
+
+template <typename _lhs, typename _rhs>
+struct IsCandidate<Binary<_lhs, _rhs, MulMatrix>> : std::true_type {};
+
+template <typename _operand, typename _fn>
+struct IsCandidate<Unary<_operand, Func<_fn>>> : std::true_type {};
+
+template <typename _lhs, typename _rhs>
+struct IsCandidate<Binary<_lhs, _rhs, PowScalar>> : std::true_type {};
+
+// Every candidate subtree of `_expr`, outermost first.
+template <typename _expr>
+struct Candidates {
+  using type = TypeList<>;
+};
+
+template <typename _operand, typename _op>
+struct Candidates<Unary<_operand, _op>> {
+  using self = std::conditional_t<IsCandidate<Unary<_operand, _op>>::value,
+                                  TypeList<Unary<_operand, _op>>,
+                                  TypeList<>>;
+  using type = typename Concat<self, typename Candidates<_operand>::type>::type;
+};
+
+template <typename _lhs, typename _rhs, typename _op>
+struct Candidates<Binary<_lhs, _rhs, _op>> {
+  using self = std::conditional_t<IsCandidate<Binary<_lhs, _rhs, _op>>::value,
+                                  TypeList<Binary<_lhs, _rhs, _op>>,
+                                  TypeList<>>;
+  using type = typename Concat<self,
+                               typename Candidates<_lhs>::type,
+                               typename Candidates<_rhs>::type>::type;
+};
+
+template <typename _target, typename _list>
+struct Count;
+
+template <typename _target, typename... _exprs>
+struct Count<_target, TypeList<_exprs...>>
+    : std::integral_constant<std::size_t,
+                             (std::size_t{0} + ... +
+                              std::is_same_v<_target, _exprs>)> {};
+
+// Number of occurrences of the candidate `_target` inside `_expr`.
+template <typename _target, typename _expr>
+constexpr inline std::size_t count_v =
+    Count<_target, typename Candidates<_expr>::type>::value;
+
+// The first type in `_list` that occurs again after it, or void.
+template <typename _list>
+struct FirstRepeated {
+  using type = void;
+};
+
+template <typename _head, typename... _tail>
+struct FirstRepeated<TypeList<_head, _tail...>>
+    : std::conditional_t<(std::is_same_v<_head, _tail> || ...),
+                         TypeOf<_head>,
+                         FirstRepeated<TypeList<_tail...>>> {};
+
+// The outermost candidate type occurring more than once in `_expr`, or void.
+template <typename _expr>
+using shared_t = typename FirstRepeated<typename Candidates<_expr>::type>::type;
+
+template <typename _expr>
+constexpr inline bool has_shared_v = !std::is_void_v<shared_t<_expr>>;
+
+// Leaves compare by address, then by storage (copies of a `SharedMat`, maps
+// of one buffer), then by value: nodes hold `Dense` leaves by value, so
+// equal ones rarely share an address.
+template <typename _core_impl>
+bool SameLeaf(const Types::Matrix<_core_impl>& _x,
+              const Types::Matrix<_core_impl>& _y) {
+  using value_type = typename Types::Matrix<_core_impl>::value_type;
+
+  if (&_x == &_y) {
+    return true;
+  }
+  if constexpr (_core_impl::core_traits::core_type == Core::Type::Dense) {
+    if (_x.Data() == _y.Data()) {
+      return true;
+    }
+  }
+  if constexpr (Traits::Core::is_contiguous_v<_core_impl> &&
+                std::is_arithmetic_v<value_type>) {
+    return Kernel::Equal(_x.Data(), _y.Data(), _x.rows * _x.cols);
+  } else {
+    for (std::size_t i = 0; i < _x.rows; i++) {
+      for (std::size_t j = 0; j < _x.cols; j++) {
+        if (!(_x(i, j) == _y(i, j))) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+}
+
+// Whether two expressions of the same type hold equal leaves.
+template <typename _expr>
+struct SameTree {
+  static bool Apply(const _expr& _x, const _expr& _y) {
+    if constexpr (std::is_arithmetic_v<_expr>) {
+      return _x == _y;
+    } else {
+      return SameLeaf(_x, _y);
+    }
+  }
+};
+
+// Generators are only known to match when they carry no state.
+template <typename _matrix, typename _op>
+struct SameTree<Nullary<_matrix, _op>> {
+  static bool Apply(const Nullary<_matrix, _op>&,
+                    const Nullary<_matrix, _op>&) {
+    return std::is_empty_v<_op>;
+  }
+};
+
+template <typename _operand, typename _op>
+struct SameTree<Unary<_operand, _op>> {
+  static bool Apply(const Unary<_operand, _op>& _x,
+                    const Unary<_operand, _op>& _y) {
+    return SameTree<_operand>::Apply(_x._o, _y._o);
+  }
+};
+
+template <typename _lhs, typename _rhs, typename _op>
+struct SameTree<Binary<_lhs, _rhs, _op>> {
+  static bool Apply(const Binary<_lhs, _rhs, _op>& _x,
+                    const Binary<_lhs, _rhs, _op>& _y) {
+    return SameTree<_lhs>::Apply(_x._l, _y._l) &&
+           SameTree<_rhs>::Apply(_x._r, _y._r);
+  }
+};
+
+template <typename _inner>
+struct SameTree<Cached<_inner>> {
+  static bool Apply(const Cached<_inner>& _x, const Cached<_inner>& _y) {
+    return _x._m == _y._m;
+  }
+};
+
+// Calls `_fn` on every occurrence of `_target` in `_e`, left to right, until
+// it returns false. Returns false if it was stopped.
+template <typename _target, typename _expr, typename _fn>
+bool ForEach(const _expr& _e, _fn&& _f) {
+  if constexpr (std::is_same_v<_expr, _target>) {
+    return _f(_e);
+  } else if constexpr (count_v<_target, _expr> == 0) {
+    return true;
+  } else if constexpr (IsUnaryNode<_expr>::value) {
+    return ForEach<_target>(_e._o, _f);
+  } else {
+    return ForEach<_target>(_e._l, _f) && ForEach<_target>(_e._r, _f);
+  }
+}
+
+// Replaces every occurrence of `_target` in `_e` with `_c`. Subtrees without
+// one are returned by reference.
+template <typename _target, typename _expr>
+decltype(auto) Substitute(const _expr& _e, const Cached<_target>& _c) {
+  if constexpr (std::is_same_v<_expr, _target>) {
+    return Cached<_target>(_c);
+  } else if constexpr (count_v<_target, _expr> == 0) {
+    return (_e);
+  } else if constexpr (IsUnaryNode<_expr>::value) {
+    decltype(auto) o = Substitute<_target>(_e._o, _c);
+    return Unary<std::decay_t<decltype(o)>, typename _expr::op_type>(o);
+  } else {
+    decltype(auto) l = Substitute<_target>(_e._l, _c);
+    decltype(auto) r = Substitute<_target>(_e._r, _c);
+    return Binary<std::decay_t<decltype(l)>,
+                  std::decay_t<decltype(r)>,
+                  typename _expr::op_type>(l, r);
+  }
+}
+
+}  // namespace Impl
+
+}  // namespace Sglty::Expr
+
+// Singularity/Expr/Impl/Cse.tpp
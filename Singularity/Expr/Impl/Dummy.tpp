@@ -8,10 +8,18 @@
 
 namespace Sglty::Expr {
 
+constexpr Cost Dummy::cost() {
+  return Cost{};
+}
+
 constexpr auto Dummy::operator()(std::size_t i, std::size_t j) const {
   return Op::Dummy{}(Dummy{}, Dummy{}, i, j);
 }
 
+constexpr Dummy::operator int() const {
+  return 0;
+}
+
 }  // namespace Sglty::Expr
 
 // Singularity/Expr/Impl/Dummy.tpp
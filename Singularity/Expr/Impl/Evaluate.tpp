@@ -2,6 +2,7 @@
 
 #include "../Evaluate.hpp"
 
+#include "../Assign.hpp"
 #include "../../Traits/Expr.hpp"
 #include "../../Types/Matrix.hpp"
 
@@ -13,7 +14,7 @@ constexpr auto Evaluate(const _expr& _e) {
                 "Error: `_expr` is not a valid expression type.");
 
   Types::Matrix<typename _expr::core_impl> ret;
-  Traverse(ret, [&](std::size_t i, std::size_t j) { ret(i, j) = _e(i, j); });
+  Assign(ret, _e);
 
   return ret;
 }
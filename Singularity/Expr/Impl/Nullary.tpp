@@ -0,0 +1,34 @@
+#pragma once
+
+#include "../Nullary.hpp"
+
+#include "../../Traits/Op.hpp"
+
+namespace Sglty::Expr {
+
+template <typename _matrix, typename _op>
+constexpr Nullary<_matrix, _op>::Nullary(const op_type& _g) : _g(_g) {}
+
+template <typename _matrix, typename _op>
+constexpr Cost Nullary<_matrix, _op>::cost() {
+  Cost ret;
+  if constexpr (Traits::Op::has_cost_v<op_type, core_impl>) {
+    ret = op_type::template cost<core_impl>;
+  } else {
+    ret = Cost{rows * cols};
+  }
+  ret.bytes_written =
+      rows * cols * sizeof(typename core_impl::type_traits::value_type);
+  ret.expr_size = sizeof(Nullary);
+  return ret;
+}
+
+template <typename _matrix, typename _op>
+constexpr auto Nullary<_matrix, _op>::operator()(std::size_t i,
+                                                    std::size_t j) const {
+  return _g(i, j);
+}
+
+}  // namespace Sglty::Expr
+
+// Singularity/Expr/Impl/Nullary.tpp
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "../Operand.hpp"
+
+#include <type_traits>
+
+#include "../../Traits/Core.hpp"
+
+namespace Sglty::Expr::Impl {
+
+template <typename _Tp>
+struct Operand {
+  using type = const _Tp;
+};
+
+template <typename _core_impl>
+struct Operand<Types::Matrix<_core_impl>> {
+  using type =
+      std::conditional_t<Traits::Core::is_held_by_reference_v<_core_impl>,
+                         const Types::Matrix<_core_impl>&,
+                         const Types::Matrix<_core_impl>>;
+};
+
+}  // namespace Sglty::Expr::Impl
+
+// Singularity/Expr/Impl/Operand.tpp
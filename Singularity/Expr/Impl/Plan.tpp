@@ -0,0 +1,132 @@
+#pragma once
+
+#include "../Plan.hpp"
+
+#include <cstddef>
+
+#include "../../Core/Enums.hpp"
+
+namespace Sglty::Expr {
+
+namespace Impl {
+
+// Leaves that are not stored matrices (scalars, generators) read no memory.
+template <typename _expr, bool _transposed>
+struct Accesses {
+  constexpr static std::size_t row = 0;
+  constexpr static std::size_t col = 0;
+};
+
+// Vectors are contiguous in both directions and never count.
+template <typename _core_impl, bool _transposed>
+struct CoreAccesses {
+  constexpr static bool is_vector =
+      _core_impl::size_traits::rows == 1 || _core_impl::size_traits::cols == 1;
+  constexpr static bool along_row =
+      (_core_impl::core_traits::core_major == Core::Major::Row) !=
+      _transposed;
+
+  constexpr static std::size_t row = !is_vector && along_row;
+  constexpr static std::size_t col = !is_vector && !along_row;
+};
+
+template <typename _core_impl, bool _transposed>
+struct Accesses<Types::Matrix<_core_impl>, _transposed>
+    : CoreAccesses<_core_impl, _transposed> {};
+
+template <typename _target, bool _transposed>
+struct Accesses<Cached<_target>, _transposed>
+    : CoreAccesses<typename _target::core_impl, _transposed> {};
+
+template <typename _operand, typename _op, bool _transposed>
+struct Accesses<Unary<_operand, _op>, _transposed>
+    : Accesses<_operand, _transposed> {};
+
+template <typename _operand, bool _transposed>
+struct Accesses<Unary<_operand, Trp>, _transposed>
+    : Accesses<_operand, !_transposed> {};
+
+template <typename _lhs, typename _rhs, typename _op, bool _transposed>
+struct Accesses<Binary<_lhs, _rhs, _op>, _transposed> {
+  constexpr static std::size_t row = Accesses<_lhs, _transposed>::row +
+                                     Accesses<_rhs, _transposed>::row;
+  constexpr static std::size_t col = Accesses<_lhs, _transposed>::col +
+                                     Accesses<_rhs, _transposed>::col;
+};
+
+// A product element reads a row of one operand and a column of the other.
+template <typename _lhs, typename _rhs, bool _transposed>
+struct Accesses<Binary<_lhs, _rhs, MulMatrix>, _transposed> {
+  constexpr static std::size_t row = 0;
+  constexpr static std::size_t col = 0;
+};
+
+// The largest power of two from 8 to 256 whose square tile of every stream
+// fits in `plan_l1_bytes`.
+constexpr std::size_t TileSize(std::size_t _bytes_per_element) {
+  std::size_t tile = 8;
+  while (tile < 256 &&
+         4 * tile * tile * _bytes_per_element <= plan_l1_bytes) {
+    tile *= 2;
+  }
+  return tile;
+}
+
+}  // namespace Impl
+
+template <typename _core_impl, typename _expr>
+template <typename _fn>
+constexpr void Plan<_core_impl, _expr>::Traverse(std::size_t _lo,
+                                                 std::size_t _hi,
+                                                 _fn&& _f) {
+  constexpr bool        row_major = major == Core::Major::Row;
+  constexpr std::size_t inner     = row_major ? _expr::cols : _expr::rows;
+
+  if constexpr (!tiled) {
+    for (std::size_t o = _lo; o < _hi; o++) {
+      for (std::size_t n = 0; n < inner; n++) {
+        if constexpr (row_major) {
+          _f(o, n);
+        } else {
+          _f(n, o);
+        }
+      }
+    }
+  } else {
+    for (std::size_t o = _lo; o < _hi; o += tile) {
+      for (std::size_t n = 0; n < inner; n += tile) {
+        const std::size_t o_end = o + tile < _hi ? o + tile : _hi;
+        const std::size_t n_end = n + tile < inner ? n + tile : inner;
+
+        const std::size_t i     = row_major ? o : n;
+        const std::size_t i_end = row_major ? o_end : n_end;
+        const std::size_t j     = row_major ? n : o;
+        const std::size_t j_end = row_major ? n_end : o_end;
+
+        if constexpr (order == Core::Major::Row) {
+          for (std::size_t ii = i; ii < i_end; ii++) {
+            for (std::size_t jj = j; jj < j_end; jj++) {
+              _f(ii, jj);
+            }
+          }
+        } else {
+          for (std::size_t jj = j; jj < j_end; jj++) {
+            for (std::size_t ii = i; ii < i_end; ii++) {
+              _f(ii, jj);
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+template <typename _core_impl, typename _expr>
+template <typename _fn>
+constexpr void Plan<_core_impl, _expr>::Traverse(_fn&& _f) {
+  Traverse(0, major == Core::Major::Row ? _expr::rows : _expr::cols, _f);
+}
+
+}  // namespace Sglty::Expr
+
+// Singularity/Expr/Impl/Plan.tpp
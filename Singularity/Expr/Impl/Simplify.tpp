@@ -0,0 +1,133 @@
+#pragma once
+
+#include "../Simplify.hpp"
+
+#include <type_traits>
+#include <utility>
+
+#include "../Binary.hpp"
+#include "../Unary.hpp"
+#include "../../Op/Alg/Trp.hpp"
+#include "../../Op/Arthm/Mul.hpp"
+#include "../../Op/Arthm/Neg.hpp"
+
+namespace Sglty::Expr {
+
+namespace Impl {
+
+template <typename _expr, typename _op>
+struct IsUnaryOf : std::false_type {};
+
+template <typename _operand, typename _op>
+struct IsUnaryOf<Unary<_operand, _op>, _op> : std::true_type {};
+
+template <typename _expr, typename _op>
+struct IsBinaryOf : std::false_type {};
+
+template <typename _lhs, typename _rhs, typename _op>
+struct IsBinaryOf<Binary<_lhs, _rhs, _op>, _op> : std::true_type {};
+
+// No rule applies: the expression is its own simplest form.
+template <typename _expr>
+struct Simplifier {
+  constexpr static const _expr& Apply(const _expr& _e) { return _e; }
+};
+
+template <typename _operand, typename _op>
+struct Simplifier<Unary<_operand, _op>> {
+  constexpr static decltype(auto) Apply(const Unary<_operand, _op>& _e) {
+    decltype(auto) o = Simplify(_e._o);
+    using operand    = std::decay_t<decltype(o)>;
+
+    if constexpr ((std::is_same_v<_op, Trp> || std::is_same_v<_op, Neg>) &&
+                  IsUnaryOf<operand, _op>::value) {
+      // Trp(Trp(a)) == a and -(-a) == a. Returns a reference when `o` still
+      // refers into `_e` or holds `a` by reference.
+      if constexpr (std::is_reference_v<decltype(o)> ||
+                    std::is_reference_v<decltype(operand::_o)>) {
+        return (o._o);
+      } else {
+        return typename operand::operand_type(o._o);
+      }
+    } else if constexpr (std::is_same_v<_op, Trp> &&
+                         IsBinaryOf<operand, MulMatrix>::value) {
+      // Trp(a * b) == Trp(b) * Trp(a); the new transposes may cancel.
+      const Unary<typename operand::rhs_type, Trp> trp_r(o._r);
+      const Unary<typename operand::lhs_type, Trp> trp_l(o._l);
+
+      auto l = Simplify(trp_r);
+      auto r = Simplify(trp_l);
+      return Binary<decltype(l), decltype(r), MulMatrix>(l, r);
+    } else if constexpr (std::is_same_v<operand, _operand>) {
+      return (_e);
+    } else {
+      return Unary<operand, _op>(o);
+    }
+  }
+};
+
+template <typename _lhs, typename _rhs, typename _op>
+struct Simplifier<Binary<_lhs, _rhs, _op>> {
+  constexpr static decltype(auto) Apply(const Binary<_lhs, _rhs, _op>& _e) {
+    decltype(auto) l = Simplify(_e._l);
+    decltype(auto) r = Simplify(_e._r);
+    using lhs        = std::decay_t<decltype(l)>;
+    using rhs        = std::decay_t<decltype(r)>;
+
+    if constexpr (std::is_same_v<_op, MulScalar> &&
+                  IsBinaryOf<lhs, MulScalar>::value) {
+      // (a * s1) * s2 == a * (s1 * s2)
+      return Binary<typename lhs::lhs_type, decltype(l._r * r), MulScalar>(
+          l._l, l._r * r);
+    } else if constexpr (std::is_same_v<_op, MulMatrix>) {
+      using value_type = decltype(l(0, 0) * r(0, 0));
+
+      constexpr bool scaled_l = IsBinaryOf<lhs, MulScalar>::value;
+      constexpr bool scaled_r = IsBinaryOf<rhs, MulScalar>::value;
+
+      // (a * s1) * (b * s2) == (a * b) * (s1 * s2). Integer products keep
+      // their scalars inside so `Kernel::QGemm()` still sees them.
+      if constexpr (std::is_floating_point_v<value_type> && scaled_l &&
+                    scaled_r) {
+        using product = Binary<typename lhs::lhs_type,
+                               typename rhs::lhs_type,
+                               MulMatrix>;
+        return Binary<product, decltype(l._r * r._r), MulScalar>(
+            product(l._l, r._l), l._r * r._r);
+      } else if constexpr (std::is_floating_point_v<value_type> && scaled_l) {
+        using product = Binary<typename lhs::lhs_type, rhs, MulMatrix>;
+        return Binary<product, typename lhs::rhs_type, MulScalar>(
+            product(l._l, r), l._r);
+      } else if constexpr (std::is_floating_point_v<value_type> && scaled_r) {
+        using product = Binary<lhs, typename rhs::lhs_type, MulMatrix>;
+        return Binary<product, typename rhs::rhs_type, MulScalar>(
+            product(l, r._l), r._r);
+      } else if constexpr (std::is_same_v<lhs, _lhs> &&
+                           std::is_same_v<rhs, _rhs>) {
+        return (_e);
+      } else {
+        return Binary<lhs, rhs, _op>(l, r);
+      }
+    } else if constexpr (std::is_same_v<lhs, _lhs> &&
+                         std::is_same_v<rhs, _rhs>) {
+      return (_e);
+    } else {
+      return Binary<lhs, rhs, _op>(l, r);
+    }
+  }
+};
+
+template <typename _expr>
+using Simplified =
+    std::decay_t<decltype(Simplify(std::declval<const _expr&>()))>;
+
+}  // namespace Impl
+
+template <typename _expr>
+constexpr decltype(auto) Simplify(const _expr& _e) {
+  return Impl::Simplifier<_expr>::Apply(_e);
+}
+
+}  // namespace Sglty::Expr
+
+// Singularity/Expr/Impl/Simplify.tpp
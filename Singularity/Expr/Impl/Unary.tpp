@@ -2,11 +2,27 @@
 
 #include "../Unary.hpp"
 
+#include "../../Traits/Op.hpp"
+
 namespace Sglty::Expr {
 
 template <typename _operand, typename _op>
 constexpr Unary<_operand, _op>::Unary(const operand_type& _o) : _o(_o) {}
 
+template <typename _operand, typename _op>
+constexpr Cost Unary<_operand, _op>::cost() {
+  Cost ret;
+  if constexpr (Traits::Op::has_cost_v<op_type, operand_type>) {
+    ret = op_type::template cost<operand_type>;
+  } else {
+    ret = OperandCost<operand_type>() + Cost{rows * cols};
+  }
+  ret.bytes_written =
+      rows * cols * sizeof(typename core_impl::type_traits::value_type);
+  ret.expr_size = sizeof(Unary);
+  return ret;
+}
+
 template <typename _operand, typename _op>
 constexpr auto Unary<_operand, _op>::operator()(std::size_t i,
                                                 std::size_t j) const {
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <cstddef>
+
+#include "../Traits/Core.hpp"
+#include "../Traits/Expr.hpp"
+#include "../Traits/Op.hpp"
+#include "Cost.hpp"
+#include "Tag.hpp"
+
+namespace Sglty::Expr {
+
+/**
+ * @brief Represents a nullary (generator) matrix expression.
+ *
+ * `Nullary` models matrix expressions with no operand, such as a constant
+ * fill, the identity or a random matrix. Every element is produced on access
+ * by the `op_type`, so a generator used inside a larger expression (as in
+ * `a + Identity()`) never materializes a matrix of its own.
+ *
+ * The shape and core are taken from the matrix type `_matrix`; the operation
+ * only supplies the values and may carry state (a fill value, a seed). Naming
+ * the matrix rather than its core also brings the `Types` operators into
+ * argument-dependent lookup, as for expressions over matrices.
+ *
+ * Used in expression trees and evaluated when passed into a `Matrix`.
+ *
+ * @tparam _matrix The `Types::Matrix` whose shape (and value type) is
+ * generated.
+ * @tparam _op The generator defining the values.
+ */
+template <typename _matrix, typename _op>
+struct Nullary : Tag {
+  /**
+   * @brief The generator producing the elements.
+   *
+   * Must satisfy `Sglty::Traits::Op::is_nullary_v`.
+   */
+  using op_type = _op;
+
+  static_assert(Traits::Op::is_nullary_v<op_type>,
+                "Error: `_op` is not a valid nullary operation type.");
+
+  static_assert(
+      op_type::template is_valid_core_impl<typename _matrix::core_impl>,
+      "Error: `_op` cannot generate values for `_matrix`.");
+
+  static_assert(
+      op_type::template is_valid_dimension<typename _matrix::core_impl>,
+      "Error: `_op` is not defined for this shape.");
+
+  /**
+   * @brief Number of rows in the resulting expression.
+   */
+  constexpr static std::size_t rows = _matrix::rows;
+
+  /**
+   * @brief Number of columns in the resulting expression.
+   */
+  constexpr static std::size_t cols = _matrix::cols;
+
+  /**
+   * @brief The resulting core implementation of the expression.
+   *
+   * The matrix's core rebound to its own shape, so non-owning cores produce
+   * an owning result.
+   */
+  using core_impl =
+      typename _matrix::core_impl::template core_rebind_size<rows, cols>;
+
+  static_assert(Traits::Core::is_valid_v<core_impl>,
+                "Error: `_matrix` produces invalid core_impl type.");
+
+  /**
+   * @brief Estimates the cost of evaluating this expression.
+   *
+   * Uses `op_type::cost` when the operation provides one, otherwise assumes
+   * one flop per element. Nothing is read; the write-back of the result and
+   * `sizeof(Nullary)` are added on top.
+   *
+   * @return The compile-time cost descriptor.
+   */
+  constexpr static Cost cost();
+
+  /**
+   * @brief Constructs a nullary expression node.
+   *
+   * @param _g The generator, including any state it carries.
+   */
+  constexpr Nullary(const op_type& _g = op_type{});
+
+  /**
+   * @brief Evaluates the expression at a given coordinate.
+   *
+   * Actual logic is implemented by the `op_type`.
+   *
+   * @param i The row index.
+   * @param j The column index.
+   * @return The generated value at position (i, j).
+   */
+  constexpr auto operator()(std::size_t i, std::size_t j) const;
+
+  /// Stored generator (by value).
+  const op_type _g;
+};
+
+}  // namespace Sglty::Expr
+
+#include "Impl/Nullary.tpp"
+
+// Singularity/Expr/Nullary.hpp
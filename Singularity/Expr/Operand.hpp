@@ -0,0 +1,39 @@
+#pragma once
+
+#include "../Fwd.hpp"
+
+namespace Sglty::Expr {
+
+namespace Impl {
+
+template <typename _Tp>
+struct Operand;
+
+}  // namespace Impl
+
+/**
+ * @brief The member type an expression node stores an operand of type
+ * `_Tp` in.
+ *
+ * Matrices whose core sets `Traits::Core::is_held_by_reference_v` (e.g.
+ * `HeapMat`) are held by `const` reference, so building `a + b` copies no
+ * elements; such a matrix must outlive every expression referring to it:
+ * ```
+ * HeapMat<float, 512, 512> a, b;
+ * auto e = a + b;                  // refers to `a` and `b`
+ * auto d = Evaluate(a) + b;        // dangles: the temporary dies here
+ * ```
+ * Everything else, i.e. `Core::Dense` and `Core::Map` matrices, nested
+ * expressions and scalars, is held by `const` value, which keeps expressions
+ * over `DenseMat` usable in constant expressions.
+ *
+ * @tparam _Tp The operand type.
+ */
+template <typename _Tp>
+using operand_t = typename Impl::Operand<_Tp>::type;
+
+}  // namespace Sglty::Expr
+
+#include "Impl/Operand.tpp"
+
+// Singularity/Expr/Operand.hpp
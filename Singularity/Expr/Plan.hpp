@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstddef>
+
+#include "../Core/Enums.hpp"
+#include "../Fwd.hpp"
+
+namespace Sglty::Expr {
+
+namespace Impl {
+
+template <typename _expr, bool _transposed>
+struct Accesses;
+
+constexpr std::size_t TileSize(std::size_t _bytes_per_element);
+
+}  // namespace Impl
+
+/**
+ * @brief L1 data cache size, in bytes, that `Plan` sizes its tiles for.
+ */
+constexpr inline std::size_t plan_l1_bytes = 32 * 1024;
+
+/**
+ * @brief Loop structure used to write `_expr` into a `Matrix<_core_impl>`.
+ *
+ * The destination and every matrix leaf of the expression are classified by
+ * the direction in which consecutive elements are adjacent in memory: along
+ * a row for row-major storage, down a column for column-major storage. `Trp`
+ * swaps the direction of everything beneath it; vectors, generators and the
+ * operands of matrix products (read along both directions) do not count.
+ *
+ * When every access runs the same way, the destination's outer dimension is
+ * the outer loop, as before. When they conflict, as in
+ * `row_major = col_major_a + row_major_b` or `b = Trp(a)`, the destination
+ * is written in square tiles of `tile` × `tile` elements, small enough for
+ * one tile of every operand to stay in L1 while it is read; inside a tile
+ * the loop runs in the direction most accesses prefer.
+ *
+ * @tparam _core_impl The core implementation of the destination.
+ * @tparam _expr The expression written into it.
+ */
+template <typename _core_impl, typename _expr>
+struct Plan {
+  /// The destination's layout.
+  constexpr static Core::Major major = _core_impl::core_traits::core_major;
+
+  /// Accesses, including the destination, contiguous along a row.
+  constexpr static std::size_t row_accesses =
+      Impl::Accesses<_expr, false>::row + (major == Core::Major::Row);
+
+  /// Accesses, including the destination, contiguous down a column.
+  constexpr static std::size_t col_accesses =
+      Impl::Accesses<_expr, false>::col + (major == Core::Major::Col);
+
+  /// Side length of a tile.
+  constexpr static std::size_t tile = Impl::TileSize(
+      (row_accesses + col_accesses) *
+      sizeof(typename _core_impl::type_traits::value_type));
+
+  /// Whether the destination is written tile by tile.
+  constexpr static bool tiled = row_accesses != 0 && col_accesses != 0 &&
+                                _expr::rows > tile && _expr::cols > tile;
+
+  /// Direction of the innermost loop (`Row`: column index innermost).
+  constexpr static Core::Major order =
+      row_accesses == col_accesses ? major
+      : row_accesses > col_accesses ? Core::Major::Row
+                                    : Core::Major::Col;
+
+  /**
+   * @brief Calls `_f(i, j)` for every element in the outer index range
+   * [_lo, _hi) of the destination (rows if it is row-major, columns
+   * otherwise).
+   *
+   * @param _lo First outer index.
+   * @param _hi One past the last outer index.
+   * @param _f  The callable invoked with each (row, column) pair.
+   */
+  template <typename _fn>
+  constexpr static void Traverse(std::size_t _lo, std::size_t _hi, _fn&& _f);
+
+  /**
+   * @brief Calls `_f(i, j)` for every element of the destination.
+   *
+   * @param _f The callable invoked with each (row, column) pair.
+   */
+  template <typename _fn>
+  constexpr static void Traverse(_fn&& _f);
+};
+
+}  // namespace Sglty::Expr
+
+#include "Impl/Plan.tpp"
+
+// Singularity/Expr/Plan.hpp
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "../Fwd.hpp"
+
+namespace Sglty::Expr {
+
+/**
+ * @brief Rewrites an expression tree into a cheaper equivalent.
+ *
+ * The rewrite is decided entirely from the expression's type and applied
+ * bottom-up, so every rule sees already simplified operands:
+ *
+ * - `Trp(Trp(a))` and `-(-a)` cancel to `a`.
+ * - Scalar chains fold: `(a * s1) * s2` becomes `a * (s1 * s2)`.
+ * - Scalars are hoisted out of floating-point matrix products:
+ *   `(s * a) * b` becomes `(a * b) * s`, so the scaling happens once per
+ *   result element instead of inside every dot product.
+ * - `Trp(a * b)` becomes `Trp(b) * Trp(a)`, a plain product that
+ *   `Expr::Assign()` hands to `Kernel::Gemm()`, which transposes while
+ *   packing. Both forms sum in the same order, so results are identical.
+ *
+ * `Expr::Assign()`, and through it `Evaluate()` and the `Matrix` expression
+ * constructor and assignment operators, simplifies every expression before
+ * evaluating it.
+ *
+ * Unchanged subtrees are returned by reference to `_e`; rewritten nodes are
+ * new expressions holding copies of their operands like any other node.
+ * Floating-point results may differ in the last bit where scalars are
+ * folded or moved.
+ *
+ * @tparam _expr The expression type. Must satisfy
+ * `Sglty::Traits::Expr::is_valid_v`.
+ * @param _e The expression to simplify.
+ * @return `_e` itself (as a reference) or an equivalent expression.
+ */
+template <typename _expr>
+constexpr decltype(auto) Simplify(const _expr& _e);
+
+}  // namespace Sglty::Expr
+
+#include "Impl/Simplify.tpp"
+
+// Singularity/Expr/Simplify.hpp
@@ -5,6 +5,8 @@
 #include "../Traits/Core.hpp"
 #include "../Traits/Expr.hpp"
 #include "../Traits/Op.hpp"
+#include "Cost.hpp"
+#include "Operand.hpp"
 #include "Tag.hpp"
 
 namespace Sglty::Expr {
@@ -64,6 +66,17 @@ struct Unary : Tag {
    */
   constexpr static std::size_t cols = op_type::template cols<operand_type>;
 
+  /**
+   * @brief Estimates the cost of evaluating this expression.
+   *
+   * Uses `op_type::cost` when the operation provides one, otherwise assumes
+   * one flop per element plus one read of the operand. The write-back of the
+   * result and `sizeof(Unary)` are added on top.
+   *
+   * @return The compile-time cost descriptor.
+   */
+  constexpr static Cost cost();
+
   /**
    * @brief Constructs a unary expression node.
    *
@@ -84,8 +97,8 @@ struct Unary : Tag {
    */
   constexpr auto operator()(std::size_t i, std::size_t j) const;
 
-  /// Stored operand (by value).
-  const operand_type _o;
+  /// Stored operand; see `operand_t`.
+  operand_t<operand_type> _o;
 };
 
 }  // namespace Sglty::Expr
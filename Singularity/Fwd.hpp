@@ -0,0 +1,142 @@
+#pragma once
+
+#include <cstddef>
+
+#include "Config.hpp"
+#include "Core/Enums.hpp"
+
+/**
+ * @brief Forward declarations of the public Singularity templates.
+ *
+ * Headers that only need to name Singularity types (function signatures,
+ * member declarations, aliases) can include this file instead of `Lib.hpp`
+ * and avoid pulling every `.tpp` implementation into the translation unit.
+ *
+ * `Lib.hpp` is the self-contained entry point for dense matrices and the
+ * core operators, suitable for a precompiled header or a header unit:
+ * ```
+ * g++ -std=c++20 -x c++-header Singularity/Lib.hpp -o Lib.hpp.gch
+ * ```
+ * The other cores, `Exec`, the backend registry, `Instr`, `Batch` and the
+ * 16-bit float types are opt-in headers next to it (see `README.md`).
+ */
+
+namespace Sglty::Core {
+
+template <typename, std::size_t, std::size_t, Major>
+class Dense;
+
+template <typename, std::size_t, std::size_t, Major, MapMode>
+class Mapped;
+
+template <typename, std::size_t, std::size_t, Major, std::size_t, std::size_t>
+class Map;
+
+template <typename, std::size_t, std::size_t, Major, typename>
+class Heap;
+
+template <typename, std::size_t, std::size_t, Major, std::size_t, std::size_t>
+class Padded;
+
+template <typename, std::size_t, std::size_t, Major, typename>
+class Shared;
+
+struct Dummy;
+
+}  // namespace Sglty::Core
+
+namespace Sglty::Mem {
+
+template <typename>
+class Allocator;
+
+}  // namespace Sglty::Mem
+
+namespace Sglty::Exec {
+
+struct Par;
+
+}  // namespace Sglty::Exec
+
+namespace Sglty::Types {
+
+template <typename>
+class Matrix;
+
+namespace Scalar {
+
+struct Half;
+
+struct BFloat16;
+
+}  // namespace Scalar
+
+using Scalar::BFloat16;
+using Scalar::Half;
+
+template <typename, std::size_t>
+struct Lanes;
+
+template <typename, std::size_t, std::size_t, std::size_t, std::size_t>
+class Batch;
+
+}  // namespace Sglty::Types
+
+namespace Sglty::Expr {
+
+struct Tag;
+
+template <typename, typename>
+struct Nullary;
+
+template <typename, typename>
+struct Unary;
+
+template <typename, typename, typename>
+struct Binary;
+
+template <typename>
+struct Cached;
+
+struct Add;
+struct Sub;
+struct MulScalar;
+struct MulMatrix;
+struct Neg;
+struct Trp;
+
+template <typename>
+struct Cast;
+
+template <Core::Major>
+struct Reorder;
+
+template <typename>
+struct Constant;
+
+template <typename>
+struct Identity;
+
+template <typename>
+struct Iota;
+
+template <typename>
+struct Random;
+
+template <typename>
+struct Func;
+
+template <typename>
+struct Cwise;
+
+template <std::size_t, std::size_t>
+struct Broadcast;
+
+struct Min;
+struct Max;
+
+struct PowScalar;
+
+}  // namespace Sglty::Expr
+
+// Singularity/Fwd.hpp
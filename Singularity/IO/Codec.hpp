@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Sglty::IO {
+
+/**
+ * @brief Computes a 64-bit checksum of a byte range.
+ *
+ * A multiply-rotate hash over four independent 64-bit lanes; fast enough to
+ * run at memory bandwidth and used to detect corrupted or truncated files,
+ * not as a cryptographic digest.
+ *
+ * @param _data Start of the range.
+ * @param _size Number of bytes.
+ * @param _seed Initial value; chaining a previous checksum as seed hashes a
+ * concatenation of ranges.
+ * @return The checksum.
+ */
+std::uint64_t Checksum(const void* _data,
+                       std::size_t _size,
+                       std::uint64_t _seed = 0);
+
+/**
+ * @brief Groups the bytes of consecutive elements by significance.
+ *
+ * Byte `k` of element `e` moves to `_dst[k * _count + e]`. Neighbouring
+ * numeric values tend to share their high-order bytes, so the shuffled
+ * stream has long runs that `RleEncode()` can collapse.
+ *
+ * @tparam _size Size of one element in bytes.
+ * @param _src   Source elements.
+ * @param _dst   Destination of `_count * _size` bytes; must not overlap.
+ * @param _count Number of elements.
+ */
+template <std::size_t _size>
+void Shuffle(const std::uint8_t* _src, std::uint8_t* _dst, std::size_t _count);
+
+/**
+ * @brief Reverses `Shuffle()`.
+ *
+ * @tparam _size Size of one element in bytes.
+ * @param _src   Shuffled bytes.
+ * @param _dst   Destination of `_count` elements; must not overlap.
+ * @param _count Number of elements.
+ */
+template <std::size_t _size>
+void Unshuffle(const std::uint8_t* _src,
+               std::uint8_t* _dst,
+               std::size_t _count);
+
+/**
+ * @brief Run-length encodes a byte range.
+ *
+ * Output is a sequence of packets: a control byte `c < 128` is followed by
+ * `c + 1` literal bytes, a control byte `c >= 128` by one byte repeated
+ * `c - 125` times.
+ *
+ * @param _src      Source bytes.
+ * @param _size     Number of source bytes.
+ * @param _dst      Destination buffer.
+ * @param _capacity Size of the destination buffer.
+ * @return The encoded size, or 0 if the result would exceed `_capacity`.
+ */
+std::size_t RleEncode(const std::uint8_t* _src,
+                      std::size_t _size,
+                      std::uint8_t* _dst,
+                      std::size_t _capacity);
+
+/**
+ * @brief Decodes the output of `RleEncode()`.
+ *
+ * @param _src      Encoded bytes.
+ * @param _size     Number of encoded bytes.
+ * @param _dst      Destination buffer.
+ * @param _expected Exact decoded size.
+ *
+ * @throws std::runtime_error if the input is malformed or does not decode to
+ * exactly `_expected` bytes.
+ */
+void RleDecode(const std::uint8_t* _src,
+               std::size_t _size,
+               std::uint8_t* _dst,
+               std::size_t _expected);
+
+}  // namespace Sglty::IO
+
+#include "Impl/Codec.tpp"
+
+// Singularity/IO/Codec.hpp
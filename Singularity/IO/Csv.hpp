@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+
+#include "../Fwd.hpp"
+#include "Text.hpp"
+
+namespace Sglty::IO {
+
+/**
+ * @brief Options for reading and writing delimited text.
+ */
+struct CsvOptions {
+  /// Field separator. A space accepts any run of blanks when reading.
+  char delimiter = ',';
+
+  /// Skip (when reading) the first line of the input.
+  bool header = false;
+
+  /// Number of bytes read from the input per chunk.
+  std::size_t chunk_size = 1 << 20;
+
+  /// Threads used to parse each chunk; `0` uses all hardware threads.
+  std::size_t threads = 1;
+};
+
+/**
+ * @brief Reads a matrix from delimited text, one row per line.
+ *
+ * Values are parsed with `std::from_chars` and stored straight into the
+ * core's `Data()` in its major order. The input is streamed in chunks of
+ * `CsvOptions::chunk_size` bytes, so files larger than memory-resident
+ * buffers are fine, and each chunk may be parsed in parallel across row
+ * ranges. Blank lines are ignored, and a value may be enclosed in double
+ * quotes.
+ *
+ * @tparam _core_impl The core implementation of the matrix. Its value type
+ * must be arithmetic.
+ * @param _in  The input stream.
+ * @param _m   The matrix to fill.
+ * @param _opt Parsing options.
+ *
+ * @throws std::runtime_error on malformed values or a row or column count
+ * different from the matrix dimensions.
+ */
+template <typename _core_impl>
+void ReadCsv(std::istream& _in,
+             Types::Matrix<_core_impl>& _m,
+             const CsvOptions& _opt = {});
+
+/**
+ * @brief Reads a matrix from a delimited text file.
+ *
+ * @throws std::system_error if the file cannot be opened.
+ * @see ReadCsv(std::istream&, Types::Matrix<_core_impl>&, const CsvOptions&)
+ */
+template <typename _core_impl>
+void ReadCsv(const std::string& _path,
+             Types::Matrix<_core_impl>& _m,
+             const CsvOptions& _opt = {});
+
+/**
+ * @brief Writes a matrix as delimited text, one row per line.
+ *
+ * Values are formatted with `std::to_chars` through a `TextWriter`;
+ * floating-point values round-trip exactly. Only `CsvOptions::delimiter` is
+ * used.
+ *
+ * @tparam _core_impl The core implementation of the matrix.
+ * @param _out The output stream.
+ * @param _m   The matrix to write.
+ * @param _opt Formatting options.
+ *
+ * @throws std::runtime_error if the stream fails.
+ */
+template <typename _core_impl>
+void WriteCsv(std::ostream& _out,
+              const Types::Matrix<_core_impl>& _m,
+              const CsvOptions& _opt = {});
+
+/**
+ * @brief Writes a matrix to a delimited text file.
+ *
+ * @throws std::system_error if the file cannot be opened.
+ * @see WriteCsv(std::ostream&, const Types::Matrix<_core_impl>&, const
+ * CsvOptions&)
+ */
+template <typename _core_impl>
+void WriteCsv(const std::string& _path,
+              const Types::Matrix<_core_impl>& _m,
+              const CsvOptions& _opt = {});
+
+}  // namespace Sglty::IO
+
+#include "Impl/Csv.tpp"
+
+// Singularity/IO/Csv.hpp
@@ -0,0 +1,191 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Sglty::IO {
+
+/**
+ * @brief Identifies the scalar type stored in a binary matrix file.
+ *
+ * Values are part of the on-disk formats and must never be renumbered.
+ */
+enum class Value : std::uint8_t {
+  Unknown  = 0,
+  Int8     = 1,
+  UInt8    = 2,
+  Int16    = 3,
+  UInt16   = 4,
+  Int32    = 5,
+  UInt32   = 6,
+  Int64    = 7,
+  UInt64   = 8,
+  Float32  = 9,
+  Float64  = 10,
+  Float16  = 11,
+  BFloat16 = 12
+};
+
+/**
+ * @brief Maps a value type to its `IO::Value` code.
+ *
+ * Yields `Value::Unknown` for types without a stable binary representation.
+ *
+ * @tparam _Tp Value type.
+ */
+template <typename _Tp>
+extern const Value value_v;
+
+/**
+ * @brief Byte-order marker stored in every header.
+ *
+ * Files are written in native byte order; a reader on a machine with the
+ * other order sees a different marker and rejects the file.
+ */
+constexpr inline std::uint32_t byte_order_mark = 0x01020304u;
+
+/**
+ * @brief Header of a raw, mappable matrix file.
+ *
+ * Layout on disk:
+ * ```
+ * [RawHeader][zero padding up to `offset`][payload]
+ * ```
+ * The payload holds `rows * cols` values of the type identified by `value`,
+ * densely packed in `core_major` order. `offset` is a multiple of
+ * `raw_alignment`, so the payload is page aligned once mapped.
+ *
+ * @see Sglty::Core::Mapped
+ * @see Sglty::IO::WriteRaw
+ */
+struct RawHeader {
+  /// Always `"SGLTYRAW"` (not null-terminated).
+  char magic[8];
+
+  /// Format version, currently 1.
+  std::uint32_t version;
+
+  /// Always `byte_order_mark` in the writer's byte order.
+  std::uint32_t byte_order;
+
+  /// `IO::Value` code of the elements.
+  std::uint8_t value;
+
+  /// `sizeof` one element.
+  std::uint8_t value_size;
+
+  /// `Core::Major` of the payload.
+  std::uint8_t core_major;
+
+  /// Reserved, always zero.
+  std::uint8_t reserved[5];
+
+  /// Number of rows.
+  std::uint64_t rows;
+
+  /// Number of columns.
+  std::uint64_t cols;
+
+  /// Byte offset of the payload from the start of the file.
+  std::uint64_t offset;
+};
+
+/// Current `RawHeader::version`.
+constexpr inline std::uint32_t raw_version = 1;
+
+/// Alignment of the payload of a raw matrix file.
+constexpr inline std::size_t raw_alignment = 4096;
+
+/**
+ * @brief Per-chunk encoding of a snapshot payload.
+ *
+ * Values are part of the on-disk format and must never be renumbered.
+ */
+enum class Compression : std::uint8_t {
+  /// Chunks hold the elements verbatim.
+  None = 0,
+
+  /// Chunks are byte-shuffled (byte k of every element stored together) and
+  /// run-length encoded. A chunk that would not shrink is stored verbatim.
+  ShuffleRle = 1
+};
+
+/**
+ * @brief Header of a snapshot file.
+ *
+ * Layout on disk:
+ * ```
+ * [SnapshotHeader][SnapshotChunk x chunk_count][chunk 0][chunk 1]...
+ * ```
+ * The decoded payload holds `rows * cols` values of the type identified by
+ * `value`, densely packed in `core_major` order, split into chunks of
+ * `chunk_size` bytes (the last one may be shorter). Chunks are encoded
+ * independently and stored back to back in the order of the chunk table.
+ *
+ * @see Sglty::IO::WriteSnapshot
+ * @see Sglty::IO::ReadSnapshot
+ */
+struct SnapshotHeader {
+  /// Always `"SGLTYSNP"` (not null-terminated).
+  char magic[8];
+
+  /// Format version, currently 1.
+  std::uint32_t version;
+
+  /// Always `byte_order_mark` in the writer's byte order.
+  std::uint32_t byte_order;
+
+  /// `IO::Value` code of the elements.
+  std::uint8_t value;
+
+  /// `sizeof` one element.
+  std::uint8_t value_size;
+
+  /// `Core::Type` of the matrix that was written.
+  std::uint8_t core_type;
+
+  /// `Core::Major` of the payload.
+  std::uint8_t core_major;
+
+  /// `IO::Compression` of the chunks.
+  std::uint8_t compression;
+
+  /// Reserved, always zero.
+  std::uint8_t reserved[3];
+
+  /// Number of rows.
+  std::uint64_t rows;
+
+  /// Number of columns.
+  std::uint64_t cols;
+
+  /// Decoded size of every chunk but the last, a multiple of `value_size`.
+  std::uint64_t chunk_size;
+
+  /// Number of chunks.
+  std::uint64_t chunk_count;
+
+  /// `IO::Checksum()` of this header (with `checksum` zero) and the chunk
+  /// table.
+  std::uint64_t checksum;
+};
+
+/**
+ * @brief Entry of the chunk table of a snapshot file.
+ */
+struct SnapshotChunk {
+  /// Stored size; equal to the decoded size if the chunk is stored verbatim.
+  std::uint64_t size;
+
+  /// `IO::Checksum()` of the decoded chunk.
+  std::uint64_t checksum;
+};
+
+/// Current `SnapshotHeader::version`.
+constexpr inline std::uint32_t snapshot_version = 1;
+
+}  // namespace Sglty::IO
+
+#include "Impl/Format.tpp"
+
+// Singularity/IO/Format.hpp
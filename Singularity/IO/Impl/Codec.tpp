@@ -0,0 +1,176 @@
+#pragma once
+
+#include "../Codec.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace Sglty::IO {
+
+namespace Impl {
+
+constexpr std::uint64_t checksum_prime_1 = 0x9E3779B185EBCA87ull;
+constexpr std::uint64_t checksum_prime_2 = 0xC2B2AE3D27D4EB4Full;
+constexpr std::uint64_t checksum_prime_3 = 0x165667B19E3779F9ull;
+
+constexpr std::uint64_t Rotl(std::uint64_t _x, int _r) {
+  return (_x << _r) | (_x >> (64 - _r));
+}
+
+inline std::uint64_t Load64(const std::uint8_t* _p) {
+  std::uint64_t w;
+  std::memcpy(&w, _p, sizeof(w));
+  return w;
+}
+
+constexpr std::uint64_t ChecksumRound(std::uint64_t _acc, std::uint64_t _w) {
+  return Rotl(_acc + _w * checksum_prime_2, 31) * checksum_prime_1;
+}
+
+}  // namespace Impl
+
+inline std::uint64_t Checksum(const void* _data,
+                              std::size_t _size,
+                              std::uint64_t _seed) {
+  const auto* p   = static_cast<const std::uint8_t*>(_data);
+  const auto* end = p + _size;
+
+  std::uint64_t h;
+  if (_size >= 32) {
+    std::uint64_t acc[4] = {_seed + Impl::checksum_prime_1,
+                            _seed + Impl::checksum_prime_2,
+                            _seed,
+                            _seed - Impl::checksum_prime_1};
+    for (; end - p >= 32; p += 32) {
+      for (int l = 0; l < 4; l++) {
+        acc[l] = Impl::ChecksumRound(acc[l], Impl::Load64(p + 8 * l));
+      }
+    }
+    h = Impl::Rotl(acc[0], 1) + Impl::Rotl(acc[1], 7) +
+        Impl::Rotl(acc[2], 12) + Impl::Rotl(acc[3], 18);
+  } else {
+    h = _seed + Impl::checksum_prime_3;
+  }
+  h += _size;
+
+  for (; end - p >= 8; p += 8) {
+    h ^= Impl::ChecksumRound(0, Impl::Load64(p));
+    h = Impl::Rotl(h, 27) * Impl::checksum_prime_1 + Impl::checksum_prime_3;
+  }
+  for (; p != end; p++) {
+    h ^= *p * Impl::checksum_prime_3;
+    h = Impl::Rotl(h, 11) * Impl::checksum_prime_1;
+  }
+
+  h ^= h >> 33;
+  h *= Impl::checksum_prime_2;
+  h ^= h >> 29;
+  h *= Impl::checksum_prime_3;
+  h ^= h >> 32;
+  return h;
+}
+
+template <std::size_t _size>
+void Shuffle(const std::uint8_t* _src, std::uint8_t* _dst, std::size_t _count) {
+  for (std::size_t e = 0; e < _count; e++) {
+    for (std::size_t k = 0; k < _size; k++) {
+      _dst[k * _count + e] = _src[e * _size + k];
+    }
+  }
+}
+
+template <std::size_t _size>
+void Unshuffle(const std::uint8_t* _src,
+               std::uint8_t* _dst,
+               std::size_t _count) {
+  for (std::size_t e = 0; e < _count; e++) {
+    for (std::size_t k = 0; k < _size; k++) {
+      _dst[e * _size + k] = _src[k * _count + e];
+    }
+  }
+}
+
+inline std::size_t RleEncode(const std::uint8_t* _src,
+                             std::size_t _size,
+                             std::uint8_t* _dst,
+                             std::size_t _capacity) {
+  constexpr std::size_t max_literal = 128;
+  constexpr std::size_t min_run     = 3;
+  constexpr std::size_t max_run     = 130;
+
+  std::size_t out     = 0;
+  std::size_t literal = 0;  // start of the pending literal bytes
+
+  const auto flush = [&](std::size_t end) {
+    while (literal < end) {
+      const std::size_t n = std::min(end - literal, max_literal);
+      if (out + 1 + n > _capacity) {
+        return false;
+      }
+      _dst[out++] = static_cast<std::uint8_t>(n - 1);
+      std::memcpy(_dst + out, _src + literal, n);
+      out += n;
+      literal += n;
+    }
+    return true;
+  };
+
+  std::size_t i = 0;
+  while (i < _size) {
+    std::size_t run = 1;
+    while (i + run < _size && run < max_run && _src[i + run] == _src[i]) {
+      run++;
+    }
+
+    if (run >= min_run) {
+      if (!flush(i) || out + 2 > _capacity) {
+        return 0;
+      }
+      _dst[out++] = static_cast<std::uint8_t>(128 + run - min_run);
+      _dst[out++] = _src[i];
+      literal     = i + run;
+    }
+    i += run;
+  }
+
+  return flush(_size) ? out : 0;
+}
+
+inline void RleDecode(const std::uint8_t* _src,
+                      std::size_t _size,
+                      std::uint8_t* _dst,
+                      std::size_t _expected) {
+  const auto fail = [] {
+    throw std::runtime_error("Error: corrupted run-length encoded data.");
+  };
+
+  std::size_t in  = 0;
+  std::size_t out = 0;
+  while (in < _size) {
+    const std::uint8_t c = _src[in++];
+    if (c < 128) {
+      const std::size_t n = c + 1u;
+      if (n > _size - in || n > _expected - out) {
+        fail();
+      }
+      std::memcpy(_dst + out, _src + in, n);
+      in += n;
+      out += n;
+    } else {
+      const std::size_t n = c - 125u;
+      if (in == _size || n > _expected - out) {
+        fail();
+      }
+      std::memset(_dst + out, _src[in++], n);
+      out += n;
+    }
+  }
+  if (out != _expected) {
+    fail();
+  }
+}
+
+}  // namespace Sglty::IO
+
+// Singularity/IO/Impl/Codec.tpp
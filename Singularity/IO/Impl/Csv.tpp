@@ -0,0 +1,133 @@
+#pragma once
+
+#include "../Csv.hpp"
+
+#include <fstream>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+
+#include "../../Types/Matrix.hpp"
+
+namespace Sglty::IO {
+
+namespace Impl {
+
+/**
+ * @brief Parses a value, optionally enclosed in double quotes as spreadsheet
+ * exports write them.
+ */
+template <typename _Tp>
+const char* ParseCsvValue(const char* _first, const char* _last, _Tp& _value) {
+  while (_first != _last && (*_first == ' ' || *_first == '\t')) {
+    _first++;
+  }
+  if (_first == _last || *_first != '"') {
+    return ParseValue(_first, _last, _value);
+  }
+
+  _first = ParseValue(_first + 1, _last, _value);
+  while (_first != _last && (*_first == ' ' || *_first == '\t')) {
+    _first++;
+  }
+  if (_first == _last || *_first != '"') {
+    throw std::runtime_error("Error: unterminated quoted value.");
+  }
+  return _first + 1;
+}
+
+}  // namespace Impl
+
+template <typename _core_impl>
+void ReadCsv(std::istream& _in,
+             Types::Matrix<_core_impl>& _m,
+             const CsvOptions& _opt) {
+  using matrix_type = Types::Matrix<_core_impl>;
+  using value_type  = typename matrix_type::value_type;
+
+  constexpr std::size_t rows = matrix_type::rows;
+  constexpr std::size_t cols = matrix_type::cols;
+
+  static_assert(Traits::Core::is_contiguous_v<_core_impl>,
+                "Error: CSV input requires a contiguous dense core.");
+
+  if (_opt.header) {
+    _in.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+  }
+
+  auto* data = _m.Data();
+
+  const auto parse = [&](std::size_t i, const char* first, const char* last) {
+    if (i >= rows) {
+      throw std::runtime_error("Error: input has more than " +
+                               std::to_string(rows) + " rows.");
+    }
+    for (std::size_t j = 0; j < cols; j++) {
+      if (j != 0) {
+        while (first != last && (*first == ' ' || *first == '\t') &&
+               *first != _opt.delimiter) {
+          first++;
+        }
+        if (_opt.delimiter != ' ') {
+          if (first == last || *first != _opt.delimiter) {
+            throw std::runtime_error("Error: row " + std::to_string(i) +
+                                     " has fewer than " +
+                                     std::to_string(cols) + " columns.");
+          }
+          first++;
+        }
+      }
+      value_type value{};
+      first = Impl::ParseCsvValue(first, last, value);
+      data[Impl::Offset<matrix_type::core_major>(rows, cols, i, j)] = value;
+    }
+    Impl::ExpectLineEnd(first, last);
+  };
+
+  const std::size_t read =
+      ForEachLine(_in, parse, _opt.chunk_size, _opt.threads);
+  if (read != rows) {
+    throw std::runtime_error("Error: input has " + std::to_string(read) +
+                             " rows, expected " + std::to_string(rows) + ".");
+  }
+}
+
+template <typename _core_impl>
+void ReadCsv(const std::string& _path,
+             Types::Matrix<_core_impl>& _m,
+             const CsvOptions& _opt) {
+  auto in = Impl::OpenFile<std::ifstream>(_path, std::ios::binary);
+  ReadCsv(in, _m, _opt);
+}
+
+template <typename _core_impl>
+void WriteCsv(std::ostream& _out,
+              const Types::Matrix<_core_impl>& _m,
+              const CsvOptions& _opt) {
+  TextWriter writer(_out);
+  for (std::size_t i = 0; i < _m.Rows(); i++) {
+    for (std::size_t j = 0; j < _m.Cols(); j++) {
+      if (j != 0) {
+        writer.Write(_opt.delimiter);
+      }
+      writer.Write(_m(i, j));
+    }
+    writer.Write('\n');
+  }
+  writer.Flush();
+}
+
+template <typename _core_impl>
+void WriteCsv(const std::string& _path,
+              const Types::Matrix<_core_impl>& _m,
+              const CsvOptions& _opt) {
+  auto out = Impl::OpenFile<std::ofstream>(
+      _path, std::ios::binary | std::ios::trunc);
+  WriteCsv(out, _m, _opt);
+}
+
+}  // namespace Sglty::IO
+
+// Singularity/IO/Impl/Csv.tpp
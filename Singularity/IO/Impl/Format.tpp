@@ -0,0 +1,61 @@
+#pragma once
+
+#include "../Format.hpp"
+
+#include <cstdint>
+#include <type_traits>
+
+#include "../../Fwd.hpp"
+
+namespace Sglty::IO {
+
+namespace Impl {
+
+template <typename _Tp>
+constexpr Value ValueOf() {
+  if constexpr (std::is_same_v<_Tp, std::int8_t>) {
+    return Value::Int8;
+  } else if constexpr (std::is_same_v<_Tp, std::uint8_t>) {
+    return Value::UInt8;
+  } else if constexpr (std::is_same_v<_Tp, std::int16_t>) {
+    return Value::Int16;
+  } else if constexpr (std::is_same_v<_Tp, std::uint16_t>) {
+    return Value::UInt16;
+  } else if constexpr (std::is_same_v<_Tp, std::int32_t>) {
+    return Value::Int32;
+  } else if constexpr (std::is_same_v<_Tp, std::uint32_t>) {
+    return Value::UInt32;
+  } else if constexpr (std::is_same_v<_Tp, std::int64_t>) {
+    return Value::Int64;
+  } else if constexpr (std::is_same_v<_Tp, std::uint64_t>) {
+    return Value::UInt64;
+  } else if constexpr (std::is_same_v<_Tp, float> && sizeof(float) == 4) {
+    return Value::Float32;
+  } else if constexpr (std::is_same_v<_Tp, double> && sizeof(double) == 8) {
+    return Value::Float64;
+  } else if constexpr (std::is_same_v<_Tp, Types::Half>) {
+    return Value::Float16;
+  } else if constexpr (std::is_same_v<_Tp, Types::BFloat16>) {
+    return Value::BFloat16;
+  } else {
+    return Value::Unknown;
+  }
+}
+
+}  // namespace Impl
+
+template <typename _Tp>
+constexpr inline Value value_v = Impl::ValueOf<std::remove_cv_t<_Tp>>();
+
+static_assert(sizeof(RawHeader) == 48,
+              "Error: unexpected padding in `RawHeader`.");
+
+static_assert(sizeof(SnapshotHeader) == 64,
+              "Error: unexpected padding in `SnapshotHeader`.");
+
+static_assert(sizeof(SnapshotChunk) == 16,
+              "Error: unexpected padding in `SnapshotChunk`.");
+
+}  // namespace Sglty::IO
+
+// Singularity/IO/Impl/Format.tpp
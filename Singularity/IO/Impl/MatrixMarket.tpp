@@ -0,0 +1,307 @@
+#pragma once
+
+#include "../MatrixMarket.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <istream>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "../../Types/Matrix.hpp"
+
+namespace Sglty::IO {
+
+namespace Impl {
+
+enum class MarketSymmetry { General, Symmetric, SkewSymmetric };
+
+struct MarketBanner {
+  MarketFormat format;
+  MarketSymmetry symmetry;
+  bool pattern;
+};
+
+inline MarketBanner ReadMarketBanner(std::istream& _in) {
+  std::string line;
+  std::getline(_in, line);
+  std::transform(line.begin(), line.end(), line.begin(), [](unsigned char c) {
+    return static_cast<char>(std::tolower(c));
+  });
+
+  std::istringstream tokens(line);
+  std::string banner, object, format, field, symmetry;
+  tokens >> banner >> object >> format >> field >> symmetry;
+
+  if (banner != "%%matrixmarket" || object != "matrix") {
+    throw std::runtime_error("Error: missing `%%MatrixMarket matrix` banner.");
+  }
+
+  MarketBanner result{};
+  if (format == "array") {
+    result.format = MarketFormat::Array;
+  } else if (format == "coordinate") {
+    result.format = MarketFormat::Coordinate;
+  } else {
+    throw std::runtime_error("Error: unsupported MatrixMarket format `" +
+                             format + "`.");
+  }
+
+  // The standard fields are `real`, `integer`, `complex` and `pattern`; the
+  // last only in `coordinate` files.
+  if (field == "pattern" && result.format == MarketFormat::Coordinate) {
+    result.pattern = true;
+  } else if (field == "complex") {
+    throw std::runtime_error("Error: complex MatrixMarket data cannot be "
+                             "read into a real matrix.");
+  } else if (field != "real" && field != "integer") {
+    throw std::runtime_error("Error: unsupported MatrixMarket field `" +
+                             field + "`.");
+  }
+
+  if (symmetry == "general") {
+    result.symmetry = MarketSymmetry::General;
+  } else if (symmetry == "symmetric") {
+    result.symmetry = MarketSymmetry::Symmetric;
+  } else if (symmetry == "skew-symmetric") {
+    result.symmetry = MarketSymmetry::SkewSymmetric;
+  } else {
+    throw std::runtime_error("Error: unsupported MatrixMarket symmetry `" +
+                             symmetry + "`.");
+  }
+  return result;
+}
+
+/**
+ * @brief Reads the size line following the banner and any comments.
+ */
+inline std::vector<std::size_t> ReadMarketSize(std::istream& _in,
+                                               std::size_t _count) {
+  std::string line;
+  while (std::getline(_in, line)) {
+    if (!line.empty() && line[0] == '%') {
+      continue;
+    }
+    if (IsBlank(line.data(), line.data() + line.size())) {
+      continue;
+    }
+
+    std::vector<std::size_t> size(_count);
+    const char* first = line.data();
+    const char* last  = first + line.size();
+    for (auto& s : size) {
+      first = ParseValue(first, last, s);
+    }
+    ExpectLineEnd(first, last);
+    return size;
+  }
+  throw std::runtime_error("Error: missing MatrixMarket size line.");
+}
+
+}  // namespace Impl
+
+template <typename _core_impl>
+void ReadMatrixMarket(std::istream& _in,
+                      Types::Matrix<_core_impl>& _m,
+                      const MarketOptions& _opt) {
+  using matrix_type = Types::Matrix<_core_impl>;
+  using value_type  = typename matrix_type::value_type;
+
+  constexpr std::size_t rows = matrix_type::rows;
+  constexpr std::size_t cols = matrix_type::cols;
+  constexpr auto offset      = Impl::Offset<matrix_type::core_major>;
+
+  static_assert(Traits::Core::is_contiguous_v<_core_impl>,
+                "Error: MatrixMarket input requires a contiguous dense core.");
+
+  const Impl::MarketBanner banner = Impl::ReadMarketBanner(_in);
+  const bool coordinate = banner.format == MarketFormat::Coordinate;
+  const auto size       = Impl::ReadMarketSize(_in, coordinate ? 3 : 2);
+
+  if (size[0] != rows || size[1] != cols) {
+    throw std::runtime_error(
+        "Error: MatrixMarket size " + std::to_string(size[0]) + "x" +
+        std::to_string(size[1]) + " does not match " + std::to_string(rows) +
+        "x" + std::to_string(cols) + ".");
+  }
+  if (banner.symmetry != Impl::MarketSymmetry::General && rows != cols) {
+    throw std::runtime_error("Error: symmetric MatrixMarket data must be "
+                             "square.");
+  }
+
+  const bool skew = banner.symmetry == Impl::MarketSymmetry::SkewSymmetric;
+  if (skew && std::is_unsigned_v<value_type>) {
+    throw std::runtime_error("Error: skew-symmetric MatrixMarket data cannot "
+                             "be read into an unsigned type.");
+  }
+  auto* data = _m.Data();
+
+  // Stores an entry and, for symmetric data, its mirror.
+  const auto store = [&](std::size_t i, std::size_t j, value_type v) {
+    data[offset(rows, cols, i, j)] = v;
+    if (banner.symmetry != Impl::MarketSymmetry::General && i != j) {
+      if constexpr (std::is_unsigned_v<value_type>) {
+        data[offset(rows, cols, j, i)] = v;
+      } else {
+        data[offset(rows, cols, j, i)] = skew ? value_type(-v) : v;
+      }
+    }
+  };
+
+  std::size_t expected = 0;
+  std::size_t read     = 0;
+
+  if (coordinate) {
+    expected = size[2];
+    std::fill(data, data + rows * cols, value_type{});
+
+    read = ForEachLine(
+        _in,
+        [&](std::size_t k, const char* first, const char* last) {
+          if (k >= expected) {
+            throw std::runtime_error("Error: more than " +
+                                     std::to_string(expected) +
+                                     " MatrixMarket entries.");
+          }
+          std::size_t i = 0, j = 0;
+          value_type v{1};
+          first = ParseValue(first, last, i);
+          first = ParseValue(first, last, j);
+          if (!banner.pattern) {
+            first = ParseValue(first, last, v);
+          }
+          Impl::ExpectLineEnd(first, last);
+          if (i == 0 || i > rows || j == 0 || j > cols) {
+            throw std::runtime_error("Error: MatrixMarket entry (" +
+                                     std::to_string(i) + ", " +
+                                     std::to_string(j) + ") out of range.");
+          }
+          store(i - 1, j - 1, v);
+        },
+        _opt.chunk_size,
+        _opt.threads);
+  } else {
+    // Column-major order; symmetric files list only the lower triangle
+    // (strictly lower if skew). `starts[j]` is the index of column j's first
+    // entry.
+    const bool triangle = banner.symmetry != Impl::MarketSymmetry::General;
+    const std::size_t skip = skew ? 1 : 0;
+
+    std::vector<std::size_t> starts(cols + 1, 0);
+    for (std::size_t j = 0; j < cols; j++) {
+      const std::size_t first_row = triangle ? std::min(j + skip, rows) : 0;
+      starts[j + 1]               = starts[j] + (rows - first_row);
+    }
+    expected = starts[cols];
+
+    if (skew) {
+      for (std::size_t i = 0; i < rows; i++) {
+        data[offset(rows, cols, i, i)] = value_type{};
+      }
+    }
+
+    read = ForEachLine(
+        _in,
+        [&](std::size_t k, const char* first, const char* last) {
+          if (k >= expected) {
+            throw std::runtime_error("Error: more than " +
+                                     std::to_string(expected) +
+                                     " MatrixMarket entries.");
+          }
+          const std::size_t j =
+              std::upper_bound(starts.begin(), starts.end(), k) -
+              starts.begin() - 1;
+          const std::size_t first_row = triangle ? j + skip : 0;
+
+          value_type v{};
+          first = ParseValue(first, last, v);
+          Impl::ExpectLineEnd(first, last);
+          store(first_row + (k - starts[j]), j, v);
+        },
+        _opt.chunk_size,
+        _opt.threads);
+  }
+
+  if (read != expected) {
+    throw std::runtime_error("Error: MatrixMarket data has " +
+                             std::to_string(read) + " entries, expected " +
+                             std::to_string(expected) + ".");
+  }
+}
+
+template <typename _core_impl>
+void ReadMatrixMarket(const std::string& _path,
+                      Types::Matrix<_core_impl>& _m,
+                      const MarketOptions& _opt) {
+  auto in = Impl::OpenFile<std::ifstream>(_path, std::ios::binary);
+  ReadMatrixMarket(in, _m, _opt);
+}
+
+template <typename _core_impl>
+void WriteMatrixMarket(std::ostream& _out,
+                       const Types::Matrix<_core_impl>& _m,
+                       const MarketOptions& _opt) {
+  using value_type = typename Types::Matrix<_core_impl>::value_type;
+
+  const bool coordinate = _opt.format == MarketFormat::Coordinate;
+
+  TextWriter writer(_out);
+  writer.Write(coordinate ? "%%MatrixMarket matrix coordinate "
+                          : "%%MatrixMarket matrix array ");
+  writer.Write(std::is_integral_v<value_type> ? "integer general\n"
+                                              : "real general\n");
+
+  writer.Write(_m.Rows());
+  writer.Write(' ');
+  writer.Write(_m.Cols());
+
+  if (!coordinate) {
+    writer.Write('\n');
+    for (std::size_t j = 0; j < _m.Cols(); j++) {
+      for (std::size_t i = 0; i < _m.Rows(); i++) {
+        writer.Write(_m(i, j));
+        writer.Write('\n');
+      }
+    }
+  } else {
+    std::size_t nonzeros = 0;
+    Types::Traverse(_m, [&](std::size_t i, std::size_t j) {
+      nonzeros += _m(i, j) != value_type{};
+    });
+
+    writer.Write(' ');
+    writer.Write(nonzeros);
+    writer.Write('\n');
+    for (std::size_t j = 0; j < _m.Cols(); j++) {
+      for (std::size_t i = 0; i < _m.Rows(); i++) {
+        if (_m(i, j) != value_type{}) {
+          writer.Write(i + 1);
+          writer.Write(' ');
+          writer.Write(j + 1);
+          writer.Write(' ');
+          writer.Write(_m(i, j));
+          writer.Write('\n');
+        }
+      }
+    }
+  }
+  writer.Flush();
+}
+
+template <typename _core_impl>
+void WriteMatrixMarket(const std::string& _path,
+                       const Types::Matrix<_core_impl>& _m,
+                       const MarketOptions& _opt) {
+  auto out = Impl::OpenFile<std::ofstream>(
+      _path, std::ios::binary | std::ios::trunc);
+  WriteMatrixMarket(out, _m, _opt);
+}
+
+}  // namespace Sglty::IO
+
+// Singularity/IO/Impl/MatrixMarket.tpp
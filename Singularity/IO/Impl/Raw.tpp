@@ -0,0 +1,76 @@
+#pragma once
+
+#include "../Raw.hpp"
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "../../Types/Matrix.hpp"
+
+namespace Sglty::IO {
+
+template <typename _core_impl>
+void WriteRaw(const std::string& _path, const Types::Matrix<_core_impl>& _m) {
+  using matrix_type = Types::Matrix<_core_impl>;
+  using value_type  = typename matrix_type::value_type;
+
+  static_assert(value_v<value_type> != Value::Unknown,
+                "Error: `value_type` has no raw file representation.");
+
+  RawHeader header{};
+  std::memcpy(header.magic, "SGLTYRAW", sizeof(header.magic));
+  header.version    = raw_version;
+  header.byte_order = byte_order_mark;
+  header.value      = static_cast<std::uint8_t>(value_v<value_type>);
+  header.value_size = sizeof(value_type);
+  header.core_major = static_cast<std::uint8_t>(matrix_type::core_major);
+  header.rows       = matrix_type::rows;
+  header.cols       = matrix_type::cols;
+  header.offset     = raw_alignment;
+
+  std::ofstream out(_path, std::ios::binary | std::ios::trunc);
+  const auto check = [&] {
+    if (!out) {
+      throw std::system_error(errno,
+                              std::generic_category(),
+                              "Error: cannot write `" + _path + "`");
+    }
+  };
+  check();
+
+  std::vector<char> padding(raw_alignment - sizeof(header), 0);
+  out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  out.write(padding.data(), static_cast<std::streamsize>(padding.size()));
+  check();
+
+  // Elements are staged in a fixed buffer so any core can be written in its
+  // major order without materializing a second full copy.
+  constexpr std::size_t buffer_elems = (1 << 16) / sizeof(value_type) + 1;
+  std::vector<value_type> buffer;
+  buffer.reserve(buffer_elems);
+
+  Types::Traverse(_m, [&](std::size_t i, std::size_t j) {
+    buffer.push_back(_m(i, j));
+    if (buffer.size() == buffer_elems) {
+      out.write(reinterpret_cast<const char*>(buffer.data()),
+                static_cast<std::streamsize>(buffer.size() *
+                                             sizeof(value_type)));
+      buffer.clear();
+    }
+  });
+  out.write(reinterpret_cast<const char*>(buffer.data()),
+            static_cast<std::streamsize>(buffer.size() * sizeof(value_type)));
+
+  out.flush();
+  check();
+}
+
+}  // namespace Sglty::IO
+
+// Singularity/IO/Impl/Raw.tpp
@@ -0,0 +1,283 @@
+#pragma once
+
+#include "../Snapshot.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../../Core/Enums.hpp"
+#include "../../Exec/Parallel.hpp"
+#include "../../Types/Matrix.hpp"
+#include "../Codec.hpp"
+#include "../Text.hpp"
+
+namespace Sglty::IO {
+
+namespace Impl {
+
+inline std::uint64_t SnapshotChecksum(
+    SnapshotHeader _header, const std::vector<SnapshotChunk>& _table) {
+  _header.checksum = 0;
+  return Checksum(_table.data(),
+                  _table.size() * sizeof(SnapshotChunk),
+                  Checksum(&_header, sizeof(_header)));
+}
+
+[[noreturn]] inline void SnapshotError(const std::string& _what) {
+  throw std::runtime_error("Error: invalid snapshot: " + _what + ".");
+}
+
+}  // namespace Impl
+
+template <typename _core_impl>
+void WriteSnapshot(std::ostream& _out,
+                   const Types::Matrix<_core_impl>& _m,
+                   const SnapshotOptions& _opt) {
+  using matrix_type = Types::Matrix<_core_impl>;
+  using value_type  = typename matrix_type::value_type;
+
+  static_assert(value_v<value_type> != Value::Unknown,
+                "Error: `value_type` has no snapshot representation.");
+  static_assert(Traits::Core::is_contiguous_v<_core_impl>,
+                "Error: snapshots require a contiguous dense core.");
+
+  constexpr std::size_t value_size = sizeof(value_type);
+
+  const std::size_t total = matrix_type::rows * matrix_type::cols * value_size;
+  const std::size_t chunk =
+      std::max<std::size_t>(_opt.chunk_size / value_size, 1) * value_size;
+  const std::size_t count = (total + chunk - 1) / chunk;
+
+  const auto* bytes = reinterpret_cast<const std::uint8_t*>(_m.Data());
+
+  // Encoded chunks; empty if the chunk is stored verbatim from `Data()`.
+  std::vector<SnapshotChunk> table(count);
+  std::vector<std::vector<std::uint8_t>> encoded(count);
+
+  Exec::ParallelFor(
+      0,
+      count,
+      [&](std::size_t lo, std::size_t hi) {
+        std::vector<std::uint8_t> shuffled;
+        for (std::size_t k = lo; k < hi; k++) {
+          const std::uint8_t* raw = bytes + k * chunk;
+          const std::size_t n     = std::min(chunk, total - k * chunk);
+
+          table[k].checksum = Checksum(raw, n);
+          table[k].size     = n;
+
+          if (_opt.compression == Compression::ShuffleRle) {
+            shuffled.resize(n);
+            Shuffle<value_size>(raw, shuffled.data(), n / value_size);
+
+            encoded[k].resize(n - 1);
+            const std::size_t size =
+                RleEncode(shuffled.data(), n, encoded[k].data(), n - 1);
+            encoded[k].resize(size);
+            encoded[k].shrink_to_fit();
+            if (size != 0) {
+              table[k].size = size;
+            }
+          }
+        }
+      },
+      _opt.threads);
+
+  SnapshotHeader header{};
+  std::memcpy(header.magic, "SGLTYSNP", sizeof(header.magic));
+  header.version     = snapshot_version;
+  header.byte_order  = byte_order_mark;
+  header.value       = static_cast<std::uint8_t>(value_v<value_type>);
+  header.value_size  = value_size;
+  header.core_type   = static_cast<std::uint8_t>(matrix_type::core_type);
+  header.core_major  = static_cast<std::uint8_t>(matrix_type::core_major);
+  header.compression = static_cast<std::uint8_t>(_opt.compression);
+  header.rows        = matrix_type::rows;
+  header.cols        = matrix_type::cols;
+  header.chunk_size  = chunk;
+  header.chunk_count = count;
+  header.checksum    = Impl::SnapshotChecksum(header, table);
+
+  _out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  _out.write(reinterpret_cast<const char*>(table.data()),
+             static_cast<std::streamsize>(count * sizeof(SnapshotChunk)));
+  for (std::size_t k = 0; k < count; k++) {
+    const std::uint8_t* data =
+        encoded[k].empty() ? bytes + k * chunk : encoded[k].data();
+    _out.write(reinterpret_cast<const char*>(data),
+               static_cast<std::streamsize>(table[k].size));
+  }
+
+  _out.flush();
+  if (!_out) {
+    throw std::runtime_error("Error: failed to write snapshot.");
+  }
+}
+
+template <typename _core_impl>
+void WriteSnapshot(const std::string& _path,
+                   const Types::Matrix<_core_impl>& _m,
+                   const SnapshotOptions& _opt) {
+  auto out = Impl::OpenFile<std::ofstream>(
+      _path, std::ios::binary | std::ios::trunc);
+  WriteSnapshot(out, _m, _opt);
+}
+
+template <typename _core_impl>
+void ReadSnapshot(std::istream& _in,
+                  Types::Matrix<_core_impl>& _m,
+                  const SnapshotOptions& _opt) {
+  using matrix_type = Types::Matrix<_core_impl>;
+  using value_type  = typename matrix_type::value_type;
+
+  static_assert(value_v<value_type> != Value::Unknown,
+                "Error: `value_type` has no snapshot representation.");
+  static_assert(Traits::Core::is_contiguous_v<_core_impl>,
+                "Error: snapshots require a contiguous dense core.");
+
+  constexpr std::size_t value_size = sizeof(value_type);
+  constexpr std::size_t rows       = matrix_type::rows;
+  constexpr std::size_t cols       = matrix_type::cols;
+  constexpr std::size_t total      = rows * cols * value_size;
+
+  const auto read = [&](void* dst, std::size_t n) {
+    _in.read(static_cast<char*>(dst), static_cast<std::streamsize>(n));
+    if (static_cast<std::size_t>(_in.gcount()) != n) {
+      Impl::SnapshotError("unexpected end of file");
+    }
+  };
+
+  SnapshotHeader header;
+  read(&header, sizeof(header));
+
+  if (std::memcmp(header.magic, "SGLTYSNP", sizeof(header.magic)) != 0) {
+    Impl::SnapshotError("bad magic");
+  }
+  if (header.version != snapshot_version) {
+    Impl::SnapshotError("unsupported version " +
+                        std::to_string(header.version));
+  }
+  if (header.byte_order != byte_order_mark) {
+    Impl::SnapshotError("written with a different byte order");
+  }
+  if (header.value != static_cast<std::uint8_t>(value_v<value_type>) ||
+      header.value_size != value_size) {
+    Impl::SnapshotError("stores a different value type");
+  }
+  if (header.core_type != static_cast<std::uint8_t>(Core::Type::Dense) ||
+      (header.core_major != static_cast<std::uint8_t>(Core::Major::Row) &&
+       header.core_major != static_cast<std::uint8_t>(Core::Major::Col))) {
+    Impl::SnapshotError("unsupported core layout");
+  }
+  if (header.rows != rows || header.cols != cols) {
+    Impl::SnapshotError("shape " + std::to_string(header.rows) + "x" +
+                        std::to_string(header.cols) + " does not match " +
+                        std::to_string(rows) + "x" + std::to_string(cols));
+  }
+  if (header.compression !=
+          static_cast<std::uint8_t>(Compression::None) &&
+      header.compression !=
+          static_cast<std::uint8_t>(Compression::ShuffleRle)) {
+    Impl::SnapshotError("unknown compression");
+  }
+  if (header.chunk_size == 0 || header.chunk_size % value_size != 0 ||
+      header.chunk_count !=
+          (total + header.chunk_size - 1) / header.chunk_size) {
+    Impl::SnapshotError("inconsistent chunking");
+  }
+
+  const std::size_t chunk = header.chunk_size;
+  const std::size_t count = header.chunk_count;
+
+  std::vector<SnapshotChunk> table(count);
+  read(table.data(), count * sizeof(SnapshotChunk));
+  if (Impl::SnapshotChecksum(header, table) != header.checksum) {
+    Impl::SnapshotError("header checksum mismatch");
+  }
+
+  // Payload chunks start at `offsets[k]` within the stored payload.
+  std::vector<std::size_t> offsets(count + 1, 0);
+  for (std::size_t k = 0; k < count; k++) {
+    const std::size_t n = std::min(chunk, total - k * chunk);
+    if (table[k].size == 0 || table[k].size > n) {
+      Impl::SnapshotError("bad size of chunk " + std::to_string(k));
+    }
+    offsets[k + 1] = offsets[k] + table[k].size;
+  }
+
+  const bool direct =
+      header.core_major == static_cast<std::uint8_t>(matrix_type::core_major);
+
+  std::vector<value_type> staging(direct ? 0 : rows * cols);
+  auto* dst = reinterpret_cast<std::uint8_t*>(direct ? _m.Data()
+                                                     : staging.data());
+
+  // A verbatim payload is read in one go; otherwise stored chunks are
+  // buffered and decoded in parallel.
+  const bool verbatim = offsets[count] == total;
+  std::vector<std::uint8_t> stored;
+  if (verbatim) {
+    read(dst, total);
+  } else {
+    stored.resize(offsets[count]);
+    read(stored.data(), stored.size());
+  }
+
+  Exec::ParallelFor(
+      0,
+      count,
+      [&](std::size_t lo, std::size_t hi) {
+        std::vector<std::uint8_t> shuffled;
+        for (std::size_t k = lo; k < hi; k++) {
+          std::uint8_t* raw   = dst + k * chunk;
+          const std::size_t n = std::min(chunk, total - k * chunk);
+
+          if (!verbatim) {
+            const std::uint8_t* src = stored.data() + offsets[k];
+            if (table[k].size == n) {
+              std::memcpy(raw, src, n);
+            } else {
+              shuffled.resize(n);
+              RleDecode(src, table[k].size, shuffled.data(), n);
+              Unshuffle<value_size>(shuffled.data(), raw, n / value_size);
+            }
+          }
+
+          if (Checksum(raw, n) != table[k].checksum) {
+            Impl::SnapshotError("checksum mismatch in chunk " +
+                                std::to_string(k));
+          }
+        }
+      },
+      _opt.threads);
+
+  if (!direct) {
+    constexpr auto source_major = matrix_type::core_major == Core::Major::Row
+                                      ? Core::Major::Col
+                                      : Core::Major::Row;
+    auto* data = _m.Data();
+    Types::Traverse(_m, [&](std::size_t i, std::size_t j) {
+      data[Impl::Offset<matrix_type::core_major>(rows, cols, i, j)] =
+          staging[Impl::Offset<source_major>(rows, cols, i, j)];
+    });
+  }
+}
+
+template <typename _core_impl>
+void ReadSnapshot(const std::string& _path,
+                  Types::Matrix<_core_impl>& _m,
+                  const SnapshotOptions& _opt) {
+  auto in = Impl::OpenFile<std::ifstream>(_path, std::ios::binary);
+  ReadSnapshot(in, _m, _opt);
+}
+
+}  // namespace Sglty::IO
+
+// Singularity/IO/Impl/Snapshot.tpp
@@ -0,0 +1,185 @@
+#pragma once
+
+#include "../Text.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <cstring>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+#include "../../Core/Enums.hpp"
+#include "../../Exec/Parallel.hpp"
+#include "../../Types/Float16.hpp"
+
+namespace Sglty::IO {
+
+template <typename _Tp>
+const char* ParseValue(const char* _first, const char* _last, _Tp& _value) {
+  static_assert((std::is_arithmetic_v<_Tp> && !std::is_same_v<_Tp, bool>) ||
+                    Types::is_float16_v<_Tp>,
+                "Error: `ParseValue` can only parse arithmetic values.");
+
+  while (_first != _last && (*_first == ' ' || *_first == '\t')) {
+    _first++;
+  }
+  if (_first != _last && *_first == '+') {
+    _first++;
+  }
+
+  std::from_chars_result result;
+  if constexpr (std::is_same_v<_Tp, char>) {
+    int wide{};
+    result = std::from_chars(_first, _last, wide);
+    if (result.ec == std::errc{} &&
+        (wide < std::numeric_limits<char>::min() ||
+         wide > std::numeric_limits<char>::max())) {
+      result.ec = std::errc::result_out_of_range;
+    }
+    _value = static_cast<char>(wide);
+  } else if constexpr (Types::is_float16_v<_Tp>) {
+    float wide{};
+    result = std::from_chars(_first, _last, wide);
+    _value = _Tp(wide);
+  } else {
+    result = std::from_chars(_first, _last, _value);
+  }
+
+  if (result.ec != std::errc{}) {
+    const char* end = std::find_if(_first, _last, [](char c) {
+      return c == '\n' || c == ',' || c == ' ' || c == '\t';
+    });
+    throw std::runtime_error(
+        std::string(result.ec == std::errc::result_out_of_range
+                        ? "Error: value out of range: `"
+                        : "Error: invalid value: `") +
+        std::string(_first, std::min<const char*>(end, _first + 32)) + "`.");
+  }
+  return result.ptr;
+}
+
+namespace Impl {
+
+/**
+ * @brief Position of element (_row, _col) within a core's `Data()`.
+ */
+template <Core::Major _major>
+constexpr std::size_t Offset(std::size_t _rows,
+                             std::size_t _cols,
+                             std::size_t _row,
+                             std::size_t _col) {
+  if constexpr (_major == Core::Major::Row) {
+    return _row * _cols + _col;
+  } else {
+    return _col * _rows + _row;
+  }
+}
+
+inline bool IsBlank(const char* _first, const char* _last) {
+  return std::all_of(_first, _last, [](char c) {
+    return c == ' ' || c == '\t' || c == '\r';
+  });
+}
+
+/**
+ * @brief Opens a file stream, throwing if that fails.
+ */
+template <typename _stream>
+_stream OpenFile(const std::string& _path, std::ios::openmode _mode) {
+  _stream s(_path, _mode);
+  if (!s) {
+    throw std::system_error(
+        errno, std::generic_category(), "Error: cannot open `" + _path + "`");
+  }
+  return s;
+}
+
+/**
+ * @brief Skips trailing blanks and a carriage return; fails if anything else
+ * remains on the line.
+ */
+inline void ExpectLineEnd(const char* _first, const char* _last) {
+  if (!IsBlank(_first, _last)) {
+    throw std::runtime_error(
+        "Error: unexpected trailing characters: `" +
+        std::string(_first, std::min<const char*>(_last, _first + 32)) + "`.");
+  }
+}
+
+}  // namespace Impl
+
+template <typename Func>
+std::size_t ForEachLine(std::istream& _in,
+                        Func&& _fn,
+                        std::size_t _chunk_size,
+                        std::size_t _threads) {
+  const std::size_t chunk_size = std::max<std::size_t>(_chunk_size, 1);
+
+  std::vector<char> buffer;
+  std::vector<const char*> starts;  // line begin/end pairs
+  std::size_t carry = 0;
+  std::size_t index = 0;
+
+  const auto dispatch = [&](const char* first, const char* last) {
+    starts.clear();
+    while (first < last) {
+      const void* nl = std::memchr(first, '\n', last - first);
+      const char* end = nl ? static_cast<const char*>(nl) : last;
+      if (!Impl::IsBlank(first, end)) {
+        starts.push_back(first);
+        starts.push_back(end);
+      }
+      first = end + 1;
+    }
+
+    const std::size_t lines = starts.size() / 2;
+    Exec::ParallelFor(
+        0,
+        lines,
+        [&](std::size_t lo, std::size_t hi) {
+          for (std::size_t k = lo; k < hi; k++) {
+            _fn(index + k, starts[2 * k], starts[2 * k + 1]);
+          }
+        },
+        _threads,
+        1024);
+    index += lines;
+  };
+
+  for (;;) {
+    buffer.resize(carry + chunk_size);
+    _in.read(buffer.data() + carry, static_cast<std::streamsize>(chunk_size));
+    const std::size_t size = carry + static_cast<std::size_t>(_in.gcount());
+
+    if (_in.bad()) {
+      throw std::runtime_error("Error: failed to read text input.");
+    }
+    if (!_in) {
+      dispatch(buffer.data(), buffer.data() + size);
+      break;
+    }
+
+    // Only complete lines are dispatched; the tail moves to the front.
+    const char* first = buffer.data();
+    const char* last  = first + size;
+    const char* tail  = last;
+    while (tail != first && tail[-1] != '\n') {
+      tail--;
+    }
+    dispatch(first, tail);
+    carry = static_cast<std::size_t>(last - tail);
+    std::memmove(buffer.data(), tail, carry);
+  }
+
+  return index;
+}
+
+}  // namespace Sglty::IO
+
+// Singularity/IO/Impl/Text.tpp
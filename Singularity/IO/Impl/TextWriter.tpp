@@ -0,0 +1,86 @@
+#pragma once
+
+#include "../TextWriter.hpp"
+
+#include <charconv>
+#include <cstring>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+
+#include "../../Types/Float16.hpp"
+
+namespace Sglty::IO {
+
+inline TextWriter::TextWriter(std::ostream& _out, std::size_t _buffer_size)
+    : _m_out(_out),
+      _m_capacity(_buffer_size < 64 ? 64 : _buffer_size),
+      _m_buffer(new char[_m_capacity]) {}
+
+inline TextWriter::~TextWriter() {
+  // Never throw from a destructor; a failed stream stays observable.
+  _m_out.write(_m_buffer, static_cast<std::streamsize>(_m_size));
+  delete[] _m_buffer;
+}
+
+template <typename _Tp>
+void TextWriter::Write(_Tp _value) {
+  static_assert(std::is_arithmetic_v<_Tp> || Types::is_float16_v<_Tp>,
+                "Error: `TextWriter` can only format arithmetic values.");
+
+  if constexpr (Types::is_float16_v<_Tp>) {
+    // Every 16-bit float is exactly a `float`, so this round-trips as well.
+    Write(static_cast<float>(_value));
+  } else if constexpr (std::is_same_v<_Tp, bool>) {
+    Write(_value ? '1' : '0');
+  } else if constexpr (std::is_same_v<_Tp, char>) {
+    Write(static_cast<int>(_value));
+  } else {
+    // Enough for any integer and for the shortest round-trip form of any
+    // standard floating-point type.
+    constexpr std::size_t max_chars = 64;
+
+    Reserve(max_chars);
+    char* first = _m_buffer + _m_size;
+    auto result = std::to_chars(first, first + max_chars, _value);
+    _m_size += static_cast<std::size_t>(result.ptr - first);
+  }
+}
+
+inline void TextWriter::Write(char _c) {
+  Reserve(1);
+  _m_buffer[_m_size++] = _c;
+}
+
+inline void TextWriter::Write(std::string_view _s) {
+  if (_s.size() > _m_capacity) {
+    Flush();
+    _m_out.write(_s.data(), static_cast<std::streamsize>(_s.size()));
+    return;
+  }
+  Reserve(_s.size());
+  std::memcpy(_m_buffer + _m_size, _s.data(), _s.size());
+  _m_size += _s.size();
+}
+
+inline void TextWriter::Write(const char* _s) {
+  Write(std::string_view(_s));
+}
+
+inline void TextWriter::Flush() {
+  _m_out.write(_m_buffer, static_cast<std::streamsize>(_m_size));
+  _m_size = 0;
+  if (!_m_out) {
+    throw std::runtime_error("Error: failed to write text output.");
+  }
+}
+
+inline void TextWriter::Reserve(std::size_t _n) {
+  if (_m_capacity - _m_size < _n) {
+    Flush();
+  }
+}
+
+}  // namespace Sglty::IO
+
+// Singularity/IO/Impl/TextWriter.tpp
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+
+#include "../Fwd.hpp"
+#include "Text.hpp"
+
+namespace Sglty::IO {
+
+/**
+ * @brief Storage layout of a MatrixMarket file.
+ */
+enum class MarketFormat {
+  Array,      ///< Dense, every entry listed in column-major order.
+  Coordinate  ///< Sparse, one `row col value` triplet per stored entry.
+};
+
+/**
+ * @brief Options for reading and writing MatrixMarket files.
+ */
+struct MarketOptions {
+  /// Layout used when writing; reading detects it from the banner.
+  MarketFormat format = MarketFormat::Array;
+
+  /// Number of bytes read from the input per chunk.
+  std::size_t chunk_size = 1 << 20;
+
+  /// Threads used to parse each chunk; `0` uses all hardware threads.
+  std::size_t threads = 1;
+};
+
+/**
+ * @brief Reads a matrix in MatrixMarket exchange format.
+ *
+ * Accepts `array` and `coordinate` files with `real`, `integer` or (for
+ * `coordinate`) `pattern` fields and `general`, `symmetric` or
+ * `skew-symmetric` symmetry. Entries absent from a `coordinate` file are
+ * zero; `pattern` entries are one. Values are parsed with `std::from_chars`
+ * and stored straight into the core's `Data()`; the body is streamed in chunks
+ * and may be parsed in parallel.
+ *
+ * @tparam _core_impl The core implementation of the matrix. Its value type
+ * must be arithmetic.
+ * @param _in  The input stream.
+ * @param _m   The matrix to fill.
+ * @param _opt Parsing options.
+ *
+ * @throws std::runtime_error on an unsupported banner (`complex` fields
+ * included), a size different from the matrix dimensions, `skew-symmetric`
+ * data for an unsigned value type, malformed or out-of-range entries or a
+ * wrong entry count.
+ */
+template <typename _core_impl>
+void ReadMatrixMarket(std::istream& _in,
+                      Types::Matrix<_core_impl>& _m,
+                      const MarketOptions& _opt = {});
+
+/**
+ * @brief Reads a matrix from a MatrixMarket file.
+ *
+ * @throws std::system_error if the file cannot be opened.
+ * @see ReadMatrixMarket(std::istream&, Types::Matrix<_core_impl>&, const
+ * MarketOptions&)
+ */
+template <typename _core_impl>
+void ReadMatrixMarket(const std::string& _path,
+                      Types::Matrix<_core_impl>& _m,
+                      const MarketOptions& _opt = {});
+
+/**
+ * @brief Writes a matrix in MatrixMarket exchange format.
+ *
+ * Produces a `general` file with `real` fields (`integer` for integral value
+ * types) in the layout selected by `MarketOptions::format`. `Coordinate`
+ * output lists only non-zero entries.
+ *
+ * @tparam _core_impl The core implementation of the matrix.
+ * @param _out The output stream.
+ * @param _m   The matrix to write.
+ * @param _opt Formatting options.
+ *
+ * @throws std::runtime_error if the stream fails.
+ */
+template <typename _core_impl>
+void WriteMatrixMarket(std::ostream& _out,
+                       const Types::Matrix<_core_impl>& _m,
+                       const MarketOptions& _opt = {});
+
+/**
+ * @brief Writes a matrix to a MatrixMarket file.
+ *
+ * @throws std::system_error if the file cannot be opened.
+ * @see WriteMatrixMarket(std::ostream&, const Types::Matrix<_core_impl>&,
+ * const MarketOptions&)
+ */
+template <typename _core_impl>
+void WriteMatrixMarket(const std::string& _path,
+                       const Types::Matrix<_core_impl>& _m,
+                       const MarketOptions& _opt = {});
+
+}  // namespace Sglty::IO
+
+#include "Impl/MatrixMarket.tpp"
+
+// Singularity/IO/MatrixMarket.hpp
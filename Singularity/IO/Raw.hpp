@@ -0,0 +1,31 @@
+#pragma once
+
+#include <string>
+
+#include "../Fwd.hpp"
+#include "Format.hpp"
+
+namespace Sglty::IO {
+
+/**
+ * @brief Writes a matrix as a raw, mappable file.
+ *
+ * Produces a `RawHeader`, zero padding up to a `raw_alignment` boundary and
+ * the elements in the matrix's major order. The result can be opened without
+ * copying through `Sglty::Core::Mapped`.
+ *
+ * @tparam _core_impl The core implementation of the matrix. Its value type
+ * must have an `IO::Value` code.
+ * @param _path Destination file; replaced if it exists.
+ * @param _m    The matrix to write.
+ *
+ * @throws std::system_error if the file cannot be written.
+ */
+template <typename _core_impl>
+void WriteRaw(const std::string& _path, const Types::Matrix<_core_impl>& _m);
+
+}  // namespace Sglty::IO
+
+#include "Impl/Raw.tpp"
+
+// Singularity/IO/Raw.hpp
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+
+#include "../Fwd.hpp"
+#include "Format.hpp"
+
+namespace Sglty::IO {
+
+/**
+ * @brief Options for writing and reading snapshots.
+ */
+struct SnapshotOptions {
+  /// Chunk encoding used when writing; reading detects it from the header.
+  Compression compression = Compression::ShuffleRle;
+
+  /// Decoded bytes per chunk when writing, rounded down to whole elements.
+  std::size_t chunk_size = 1 << 20;
+
+  /// Threads used to encode, decode and checksum chunks; `0` uses all
+  /// hardware threads.
+  std::size_t threads = 1;
+};
+
+/**
+ * @brief Writes a matrix as a binary snapshot.
+ *
+ * The payload is taken straight from `Data()` in the core's major order and
+ * split into chunks that are checksummed and encoded independently (and in
+ * parallel). See `SnapshotHeader` for the layout.
+ *
+ * @tparam _core_impl A dense core implementation whose value type has an
+ * `IO::Value` code.
+ * @param _out The output stream.
+ * @param _m   The matrix to write.
+ * @param _opt Encoding options.
+ *
+ * @throws std::runtime_error if the stream fails.
+ */
+template <typename _core_impl>
+void WriteSnapshot(std::ostream& _out,
+                   const Types::Matrix<_core_impl>& _m,
+                   const SnapshotOptions& _opt = {});
+
+/**
+ * @brief Writes a matrix to a snapshot file.
+ *
+ * @throws std::system_error if the file cannot be opened.
+ * @see WriteSnapshot(std::ostream&, const Types::Matrix<_core_impl>&, const
+ * SnapshotOptions&)
+ */
+template <typename _core_impl>
+void WriteSnapshot(const std::string& _path,
+                   const Types::Matrix<_core_impl>& _m,
+                   const SnapshotOptions& _opt = {});
+
+/**
+ * @brief Reads a snapshot into a matrix.
+ *
+ * The value type and shape must match the file. If the major order matches
+ * as well, chunks are read or decoded straight into `Data()`; verbatim
+ * payloads are a single read. Otherwise the payload is staged and reordered.
+ * Every chunk is verified against its checksum. On failure the matrix
+ * contents are unspecified.
+ *
+ * @tparam _core_impl A dense core implementation.
+ * @param _in  The input stream.
+ * @param _m   The matrix to fill.
+ * @param _opt Only `SnapshotOptions::threads` is used.
+ *
+ * @throws std::runtime_error if the file is truncated, corrupted or does not
+ * match the matrix type.
+ */
+template <typename _core_impl>
+void ReadSnapshot(std::istream& _in,
+                  Types::Matrix<_core_impl>& _m,
+                  const SnapshotOptions& _opt = {});
+
+/**
+ * @brief Reads a snapshot file into a matrix.
+ *
+ * @throws std::system_error if the file cannot be opened.
+ * @see ReadSnapshot(std::istream&, Types::Matrix<_core_impl>&, const
+ * SnapshotOptions&)
+ */
+template <typename _core_impl>
+void ReadSnapshot(const std::string& _path,
+                  Types::Matrix<_core_impl>& _m,
+                  const SnapshotOptions& _opt = {});
+
+}  // namespace Sglty::IO
+
+#include "Impl/Snapshot.tpp"
+
+// Singularity/IO/Snapshot.hpp
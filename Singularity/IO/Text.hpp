@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <iosfwd>
+
+#include "TextWriter.hpp"
+
+namespace Sglty::IO {
+
+/**
+ * @brief Parses one arithmetic value with `std::from_chars`.
+ *
+ * Leading blanks (spaces and tabs) and a leading `+` are skipped; a value
+ * must follow. Floating-point input accepts fixed, scientific, `inf` and
+ * `nan` notation.
+ *
+ * @tparam _Tp Arithmetic type of the value.
+ * @param _first  Start of the input.
+ * @param _last   End of the input.
+ * @param _value  Receives the parsed value.
+ * @return Pointer past the last consumed character.
+ *
+ * @throws std::runtime_error if no valid value starts at `_first` or it is out
+ * of range for `_Tp`.
+ */
+template <typename _Tp>
+const char* ParseValue(const char* _first, const char* _last, _Tp& _value);
+
+/**
+ * @brief Streams an input in chunks and calls a function for every line.
+ *
+ * The input is read `_chunk_size` bytes at a time; complete lines of each
+ * chunk are dispatched, partial lines are carried into the next chunk. Blank
+ * lines are skipped and not counted. With `_threads != 1` the lines of a
+ * chunk are processed in parallel across line ranges, so `_fn` must be safe to
+ * call concurrently for different lines.
+ *
+ * @tparam Func Callable accepting `(std::size_t index, const char* begin,
+ * const char* end)`, where `index` counts non-blank lines from zero and
+ * `[begin, end)` excludes the line terminator.
+ * @param _in         The input stream.
+ * @param _fn         The per-line callback.
+ * @param _chunk_size Number of bytes read per chunk.
+ * @param _threads    Threads per chunk; `0` uses `Exec::HardwareThreads()`.
+ * @return The number of lines processed.
+ */
+template <typename Func>
+std::size_t ForEachLine(std::istream& _in,
+                        Func&& _fn,
+                        std::size_t _chunk_size = 1 << 20,
+                        std::size_t _threads    = 1);
+
+}  // namespace Sglty::IO
+
+#include "Impl/Text.tpp"
+
+// Singularity/IO/Text.hpp
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstddef>
+#include <iosfwd>
+#include <string_view>
+
+namespace Sglty::IO {
+
+/**
+ * @brief Buffered number formatter on top of an output stream.
+ *
+ * Values are formatted with `std::to_chars` into an internal buffer that is
+ * handed to the stream in large blocks, avoiding the per-element locale and
+ * sentry overhead of `operator<<`. Floating-point values use the shortest
+ * representation that round-trips. The buffer is flushed on destruction.
+ *
+ * Example Usage:
+ * ```
+ * Sglty::IO::TextWriter out(std::cout);
+ * out.Write(1.5);
+ * out.Write('\n');
+ * ```
+ */
+class TextWriter {
+ public:
+  /**
+   * @brief Creates a writer for a stream.
+   *
+   * @param _out         Destination stream; must outlive the writer.
+   * @param _buffer_size Number of bytes collected before each stream write.
+   */
+  explicit TextWriter(std::ostream& _out, std::size_t _buffer_size = 1 << 16);
+
+  TextWriter(const TextWriter&)            = delete;
+  TextWriter& operator=(const TextWriter&) = delete;
+
+  ~TextWriter();
+
+  /**
+   * @brief Appends an arithmetic value.
+   *
+   * @tparam _Tp Arithmetic type, other than `char` and `bool` which are
+   * written as numbers.
+   */
+  template <typename _Tp>
+  void Write(_Tp _value);
+
+  /// Appends a single character.
+  void Write(char _c);
+
+  /// Appends a string.
+  void Write(std::string_view _s);
+
+  /// Appends a null-terminated string.
+  void Write(const char* _s);
+
+  /**
+   * @brief Hands all buffered bytes to the stream.
+   *
+   * @throws std::runtime_error if the stream is in a failed state afterwards.
+   */
+  void Flush();
+
+ private:
+  void Reserve(std::size_t _n);
+
+  std::ostream& _m_out;
+  std::size_t _m_capacity;
+  char* _m_buffer;
+  std::size_t _m_size = 0;
+};
+
+}  // namespace Sglty::IO
+
+#include "Impl/TextWriter.tpp"
+
+// Singularity/IO/TextWriter.hpp
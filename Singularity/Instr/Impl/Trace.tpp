@@ -0,0 +1,230 @@
+#pragma once
+
+#include "../Trace.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "../../Kernel/Isa.hpp"
+
+namespace Sglty::Instr {
+
+namespace Impl {
+
+struct Event {
+  const char* name;
+  std::size_t rows;
+  std::size_t cols;
+  std::size_t bytes;
+  std::uint64_t start_ns;
+  std::uint64_t duration_ns;
+  std::size_t thread;
+};
+
+struct Registry {
+  std::mutex mutex;
+  std::map<std::string, Counter> counters;
+  std::vector<Event> events;
+  std::size_t threads = 0;
+
+  // Bumped by `Reset()`, so threads take new ids afterwards.
+  std::size_t generation = 1;
+};
+
+inline Registry& GetRegistry() {
+  static Registry registry;
+  return registry;
+}
+
+inline std::uint64_t Now() {
+  using clock = std::chrono::steady_clock;
+  static const clock::time_point epoch = clock::now();
+  return static_cast<std::uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() -
+                                                           epoch)
+          .count());
+}
+
+inline void Record(const char* _name,
+                   std::size_t _rows,
+                   std::size_t _cols,
+                   std::size_t _bytes,
+                   std::uint64_t _start_ns) {
+  const std::uint64_t end_ns = Now();
+
+  Registry& registry = GetRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+
+  // Small sequential ids, in the order threads first record an event, so
+  // every thread keeps a track of its own in the exported trace.
+  thread_local std::size_t thread     = 0;
+  thread_local std::size_t generation = 0;
+  if (generation != registry.generation) {
+    thread     = ++registry.threads;
+    generation = registry.generation;
+  }
+
+  Counter& counter = registry.counters[_name];
+  counter.calls++;
+  counter.total_ns += end_ns - _start_ns;
+  counter.bytes += _bytes;
+
+  if (registry.events.size() < SGLTY_TRACE_MAX_EVENTS) {
+    registry.events.push_back(
+        {_name, _rows, _cols, _bytes, _start_ns, end_ns - _start_ns, thread});
+  }
+}
+
+template <typename _Tp>
+std::string_view PrettyName() {
+#if defined(__clang__) || defined(__GNUC__)
+  std::string_view name = __PRETTY_FUNCTION__;
+  const std::string_view key = "_Tp = ";
+#else
+  std::string_view name = __FUNCSIG__;
+  const std::string_view key = "PrettyName<";
+#endif
+  const std::size_t begin = name.find(key);
+  if (begin == std::string_view::npos) {
+    return name;
+  }
+  name.remove_prefix(begin + key.size());
+  return name.substr(0, name.find_first_of(";]>"));
+}
+
+template <typename _expr, typename = void>
+struct HasCost : std::false_type {};
+
+template <typename _expr>
+struct HasCost<_expr, std::void_t<decltype(_expr::cost())>>
+    : std::true_type {};
+
+template <typename _Tp, typename _enable = void>
+struct NameOf {
+  using type = _Tp;
+};
+
+template <typename _Tp>
+struct NameOf<_Tp, std::void_t<typename _Tp::op_type>> {
+  using type = typename _Tp::op_type;
+};
+
+}  // namespace Impl
+
+inline Scope::Scope(const char* (*_name_fn)(),
+                    std::size_t _rows,
+                    std::size_t _cols,
+                    std::size_t _bytes)
+    : _m_name_fn(_name_fn),
+      _m_rows(_rows),
+      _m_cols(_cols),
+      _m_bytes(_bytes),
+      _m_start(Impl::Now()) {}
+
+inline Scope::Scope(const char* _label,
+                    std::size_t _rows,
+                    std::size_t _cols,
+                    std::size_t _bytes)
+    : _m_label(_label),
+      _m_rows(_rows),
+      _m_cols(_cols),
+      _m_bytes(_bytes),
+      _m_start(Impl::Now()) {}
+
+inline Scope::~Scope() {
+  Impl::Record(
+      _m_label ? _m_label : _m_name_fn(), _m_rows, _m_cols, _m_bytes, _m_start);
+}
+
+namespace Impl {
+
+template <typename _expr, typename _fn>
+void Traced(_fn&& _body) {
+  SGLTY_TRACE_SCOPE(_expr);
+  _body();
+}
+
+}  // namespace Impl
+
+template <typename _expr>
+const char* Name() {
+  static const std::string name = [] {
+    std::string ret(Impl::PrettyName<typename Impl::NameOf<_expr>::type>());
+    for (std::string_view prefix : {"Sglty::Expr::", "Sglty::"}) {
+      if (ret.rfind(prefix, 0) == 0) {
+        ret.erase(0, prefix.size());
+      }
+    }
+    return ret;
+  }();
+  return name.c_str();
+}
+
+template <typename _expr>
+constexpr std::size_t Bytes() {
+  if constexpr (Impl::HasCost<_expr>::value) {
+    return _expr::cost().bytes_read + _expr::cost().bytes_written;
+  } else {
+    return 0;
+  }
+}
+
+inline std::map<std::string, Counter> Counters() {
+  Impl::Registry& registry = Impl::GetRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  return registry.counters;
+}
+
+inline void Reset() {
+  Impl::Registry& registry = Impl::GetRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  registry.counters.clear();
+  registry.events.clear();
+  registry.threads = 0;
+  registry.generation++;
+}
+
+inline void WriteTrace(std::ostream& _os) {
+  Impl::Registry& registry = Impl::GetRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+
+  // Timestamps are in microseconds; fractional digits keep sub-us spans.
+  const auto micros = [&](std::uint64_t ns) {
+    _os << ns / 1000 << '.' << static_cast<char>('0' + ns / 100 % 10)
+        << static_cast<char>('0' + ns / 10 % 10)
+        << static_cast<char>('0' + ns % 10);
+  };
+
+  _os << "{\"traceEvents\":[";
+  for (std::size_t i = 0; i < registry.events.size(); i++) {
+    const Impl::Event& e = registry.events[i];
+    _os << (i ? ",\n" : "\n") << "{\"name\":\"";
+    for (const char* c = e.name; *c; c++) {
+      if (*c == '"' || *c == '\\') {
+        _os << '\\';
+      }
+      _os << *c;
+    }
+    _os << "\",\"cat\":\"sglty\",\"ph\":\"X\",\"pid\":1,\"tid\":"
+        << e.thread << ",\"ts\":";
+    micros(e.start_ns);
+    _os << ",\"dur\":";
+    micros(e.duration_ns);
+    _os << ",\"args\":{\"rows\":" << e.rows << ",\"cols\":" << e.cols
+        << ",\"bytes\":" << e.bytes << "}}";
+  }
+  _os << "\n],\"displayTimeUnit\":\"ns\",\"otherData\":{\"isa\":\""
+      << Kernel::IsaName(Kernel::ActiveIsa()) << "\"}}\n";
+}
+
+}  // namespace Sglty::Instr
+
+// Singularity/Instr/Impl/Trace.tpp
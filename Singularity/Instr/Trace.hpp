@@ -0,0 +1,204 @@
+#pragma once
+
+#include "../Config.hpp"
+
+/**
+ * @brief Opt-in runtime instrumentation.
+ *
+ * Compiled out entirely unless `SGLTY_ENABLE_TRACE` is defined, in which case
+ * every `Expr::Assign()` (and with it `Evaluate()`, `Matrix` construction from
+ * expressions and all assignments) as well as every kernel marked with
+ * `SGLTY_TRACE_KERNEL` records its operation name, shape, elapsed time and
+ * the bytes it touched.
+ *
+ * Recorded data is available as:
+ *
+ * - per-operation counters via `Sglty::Instr::Counters()`
+ *
+ * - a trace-event JSON document via `Sglty::Instr::WriteTrace()`, which opens
+ *   in `chrome://tracing`, Perfetto and other trace viewers
+ *
+ * Evaluation during constant evaluation is never recorded, so `constexpr`
+ * code keeps working. Without `SGLTY_IS_CONSTANT_EVALUATED()` support (see
+ * `Config.hpp`) nothing is recorded.
+ *
+ * Example Usage:
+ * ```
+ * // g++ -std=c++17 -DSGLTY_ENABLE_TRACE ...
+ * Sglty::Instr::Reset();
+ * run_pipeline();
+ * for (const auto& [name, counter] : Sglty::Instr::Counters()) { ... }
+ * std::ofstream out("trace.json");
+ * Sglty::Instr::WriteTrace(out);
+ * ```
+ */
+
+#if defined(SGLTY_ENABLE_TRACE)
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <string>
+
+#ifndef SGLTY_TRACE_MAX_EVENTS
+/// Upper bound on stored trace events; counters keep updating past it.
+#define SGLTY_TRACE_MAX_EVENTS (std::size_t{1} << 20)
+#endif
+
+namespace Sglty::Instr {
+
+/**
+ * @brief Aggregated statistics for one operation name.
+ */
+struct Counter {
+  /// Number of recorded executions.
+  std::size_t calls = 0;
+
+  /// Total elapsed wall time in nanoseconds.
+  std::uint64_t total_ns = 0;
+
+  /// Total bytes read and written.
+  std::size_t bytes = 0;
+};
+
+/**
+ * @brief RAII timer recording one instrumented execution.
+ *
+ * Use through `SGLTY_TRACE_CALL`, `SGLTY_TRACE_SCOPE` or
+ * `SGLTY_TRACE_KERNEL` rather than directly. Not a literal type, so
+ * `constexpr` functions only create one outside constant evaluation, which
+ * `SGLTY_TRACE_CALL` takes care of.
+ */
+class Scope {
+ public:
+  /**
+   * @brief Starts timing an operation whose name is computed on demand.
+   *
+   * @param _name_fn Function returning the operation name.
+   * @param _rows    Rows of the produced result.
+   * @param _cols    Columns of the produced result.
+   * @param _bytes   Bytes read and written by the operation.
+   */
+  Scope(const char* (*_name_fn)(),
+        std::size_t _rows,
+        std::size_t _cols,
+        std::size_t _bytes);
+
+  /**
+   * @brief Starts timing an operation with a fixed name.
+   *
+   * @param _label Operation name (must outlive the program, e.g. a literal).
+   * @param _rows  Rows of the produced result.
+   * @param _cols  Columns of the produced result.
+   * @param _bytes Bytes read and written by the operation.
+   */
+  Scope(const char* _label,
+        std::size_t _rows,
+        std::size_t _cols,
+        std::size_t _bytes);
+
+  Scope(const Scope&)            = delete;
+  Scope& operator=(const Scope&) = delete;
+
+  /**
+   * @brief Stops timing and records the execution.
+   */
+  ~Scope();
+
+ private:
+  const char* (*_m_name_fn)() = nullptr;
+  const char* _m_label        = nullptr;
+  std::size_t _m_rows         = 0;
+  std::size_t _m_cols         = 0;
+  std::size_t _m_bytes        = 0;
+  std::uint64_t _m_start      = 0;
+};
+
+/**
+ * @brief Returns a readable name for an expression type.
+ *
+ * Expression nodes are named after their operation (e.g. `MulMatrix`),
+ * everything else after the type itself.
+ *
+ * @tparam _expr The expression type.
+ */
+template <typename _expr>
+const char* Name();
+
+/**
+ * @brief Bytes read and written when `_expr` is evaluated.
+ *
+ * Taken from the expression's `cost()` when available, zero otherwise.
+ *
+ * @tparam _expr The expression type.
+ */
+template <typename _expr>
+constexpr std::size_t Bytes();
+
+/**
+ * @brief Returns a snapshot of the per-operation counters.
+ */
+std::map<std::string, Counter> Counters();
+
+/**
+ * @brief Clears all counters and stored trace events.
+ *
+ * Thread ids in the exported trace start over at 1.
+ */
+void Reset();
+
+/**
+ * @brief Writes all stored events in trace-event JSON format.
+ *
+ * Each thread is one track (`tid`), numbered 1, 2, ... in the order the
+ * threads first recorded an event. The document's `otherData` names the
+ * `Kernel::ActiveIsa()` variant the kernels ran in.
+ *
+ * @param _os The stream to write to.
+ */
+void WriteTrace(std::ostream& _os);
+
+}  // namespace Sglty::Instr
+
+#define SGLTY_TRACE_CONCAT_IMPL(_a, _b) _a##_b
+#define SGLTY_TRACE_CONCAT(_a, _b) SGLTY_TRACE_CONCAT_IMPL(_a, _b)
+
+/// Evaluates `...`, recorded as an evaluation of the expression type `_type`
+/// unless constant evaluated. Usable in `constexpr` functions.
+#define SGLTY_TRACE_CALL(_type, ...)                                  \
+  do {                                                                \
+    if (SGLTY_IS_CONSTANT_EVALUATED()) {                              \
+      __VA_ARGS__;                                                    \
+    } else {                                                          \
+      ::Sglty::Instr::Impl::Traced<_type>([&] { __VA_ARGS__; });      \
+    }                                                                 \
+  } while (false)
+
+/// Records the evaluation of the expression type `_type` in this scope. Not
+/// for `constexpr` functions; see `SGLTY_TRACE_CALL`.
+#define SGLTY_TRACE_SCOPE(_type)                                  \
+  const ::Sglty::Instr::Scope SGLTY_TRACE_CONCAT(_sglty_trace_,   \
+                                                 __LINE__)(       \
+      &::Sglty::Instr::Name<_type>,                               \
+      _type::rows,                                                \
+      _type::cols,                                                \
+      ::Sglty::Instr::Bytes<_type>())
+
+/// Records a kernel named `_label` producing `_rows` × `_cols` in this scope.
+#define SGLTY_TRACE_KERNEL(_label, _rows, _cols, _bytes)        \
+  const ::Sglty::Instr::Scope SGLTY_TRACE_CONCAT(_sglty_trace_, \
+                                                 __LINE__)(     \
+      _label, _rows, _cols, _bytes)
+
+#include "Impl/Trace.tpp"
+
+#else
+
+#define SGLTY_TRACE_CALL(_type, ...) __VA_ARGS__
+#define SGLTY_TRACE_SCOPE(_type)
+#define SGLTY_TRACE_KERNEL(_label, _rows, _cols, _bytes)
+
+#endif  // SGLTY_ENABLE_TRACE
+
+// Singularity/Instr/Trace.hpp
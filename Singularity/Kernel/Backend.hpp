@@ -0,0 +1,54 @@
+#pragma once
+
+#include <string_view>
+#include <vector>
+
+#include "Route.hpp"
+
+/**
+ * @brief Registry of `Kernel::Backend` implementations.
+ *
+ * Selecting, forcing and routing products to a backend is declared in
+ * `Kernel/Route.hpp`, which every evaluation includes; this header adds the
+ * built-in reference backend and lookup by name, and is only needed by code
+ * that registers or looks up backends.
+ */
+
+namespace Sglty::Kernel {
+
+/**
+ * @brief Returns the built-in reference backend, registered as
+ * `"reference"`.
+ *
+ * Plain loops over the strided operands; `Gemm` packs op(B) into a row-major
+ * buffer like `Kernel::Gemm()`. Always available, never selected by default:
+ * force it to compare another backend against a simple baseline.
+ */
+const Backend& ReferenceBackend();
+
+/**
+ * @brief Adds `_backend` to the registry, replacing a backend of the same
+ * name. `_backend` must outlive every use of the registry.
+ *
+ * @param _backend The backend.
+ */
+void RegisterBackend(const Backend& _backend);
+
+/**
+ * @brief Looks up a registered backend by name.
+ *
+ * @param _name The backend name, e.g. `"reference"` or `"cblas"`.
+ * @return The backend, or `nullptr` if none is registered under `_name`.
+ */
+const Backend* FindBackend(std::string_view _name);
+
+/**
+ * @brief Returns every registered backend, in registration order.
+ */
+std::vector<const Backend*> Backends();
+
+}  // namespace Sglty::Kernel
+
+#include "Impl/Backend.tpp"
+
+// Singularity/Kernel/Backend.hpp
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "Backend.hpp"
+
+#ifndef SGLTY_CBLAS_HEADER
+/// Header declaring the `cblas_*` functions.
+#define SGLTY_CBLAS_HEADER <cblas.h>
+#endif
+
+#ifndef SGLTY_CBLAS_INT
+/// Integer type of the sizes, leading dimensions and increments passed to
+/// CBLAS (`int` for LP64 builds; e.g. `long` for an ILP64 OpenBLAS).
+#define SGLTY_CBLAS_INT int
+#endif
+
+namespace Sglty::Kernel {
+
+/**
+ * @brief Returns the `Backend` adapter over a CBLAS-compatible library
+ * (OpenBLAS, BLIS, MKL, Accelerate, ...), named `"cblas"`.
+ *
+ * Every routine forwards to `cblas_sgemm`, `cblas_dgemm`, `cblas_sgemv`, ...
+ * with the layout, transposition and triangle flags mapped one to one.
+ *
+ * Not included on its own. Define `SGLTY_ENABLE_CBLAS` for every translation
+ * unit and link the library (e.g. `-lopenblas`) to have the evaluation path
+ * (`Kernel/Route.hpp`) include it, register the adapter and select it, so large
+ * products go to the library without code changes. Without the macro,
+ * include this header and call `RegisterBackend(CblasBackend())` and
+ * `SelectBackend()` or `BackendScope` explicitly.
+ *
+ * Example Usage:
+ * ```
+ * // g++ -DSGLTY_ENABLE_CBLAS ... -lopenblas
+ * Sglty::Kernel::BackendScope scope(&Sglty::Kernel::ReferenceBackend());
+ * c = a * b;  // compare against the default, `cblas_sgemm`
+ * ```
+ */
+const Backend& CblasBackend();
+
+}  // namespace Sglty::Kernel
+
+#include "Impl/Cblas.tpp"
+
+// Singularity/Kernel/Cblas.hpp
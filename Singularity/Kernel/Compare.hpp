@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstddef>
+
+#include "../Fwd.hpp"
+
+namespace Sglty::Kernel {
+
+/**
+ * @brief Number of elements `Equal()` and `Approx()` compare between two
+ * early-exit checks.
+ *
+ * Inside a block the comparison results are combined without branching, so
+ * the loop vectorizes; a mismatch is noticed at most one block late.
+ */
+constexpr inline std::size_t compare_block = 256;
+
+/**
+ * @brief Tolerance test used by `Op::Cmp::IsApprox()`.
+ *
+ * True if `_a == _b` or `|_a - _b| <= max(_abs, _rel * max(|_a|, |_b|))`.
+ * Floating-point values are compared in their own precision (16-bit floats
+ * as `float`), integers as `double`. NaN is never close to anything, and
+ * an infinity only to itself.
+ *
+ * @param _a   First value.
+ * @param _b   Second value.
+ * @param _rel Relative tolerance.
+ * @param _abs Absolute tolerance.
+ */
+template <typename _Tp, typename _Up>
+constexpr bool IsClose(const _Tp& _a, const _Up& _b, double _rel, double _abs);
+
+/**
+ * @brief Returns true if `_a[k] == _b[k]` for every k < `_n`.
+ *
+ * Integers are compared with `std::memcmp`. Floating-point values use `==`
+ * (so `-0.0 == 0.0` and NaN differs from itself) in blocks of
+ * `compare_block` elements, returning at the first block with a mismatch.
+ *
+ * @tparam _Tp An arithmetic type.
+ * @param _a First array.
+ * @param _b Second array.
+ * @param _n Number of elements.
+ */
+template <typename _Tp>
+bool Equal(const _Tp* _a, const _Tp* _b, std::size_t _n);
+
+/**
+ * @brief Returns true if `IsClose(_a[k], _b[k], _rel, _abs)` for every
+ * k < `_n`.
+ *
+ * Scans in blocks of `compare_block` elements like `Equal()`.
+ *
+ * @tparam _Tp An arithmetic type.
+ * @param _a   First array.
+ * @param _b   Second array.
+ * @param _n   Number of elements.
+ * @param _rel Relative tolerance.
+ * @param _abs Absolute tolerance.
+ */
+template <typename _Tp>
+bool Approx(const _Tp* _a,
+            const _Tp* _b,
+            std::size_t _n,
+            double _rel,
+            double _abs);
+
+}  // namespace Sglty::Kernel
+
+#include "Impl/Compare.tpp"
+
+// Singularity/Kernel/Compare.hpp
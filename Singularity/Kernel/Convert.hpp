@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstddef>
+
+#include "../Fwd.hpp"
+
+namespace Sglty::Kernel {
+
+/**
+ * @brief Converts `_n` contiguous values from `_from` to `_to`.
+ *
+ * Equivalent to `_dst[k] = static_cast<_to>(_src[k])` for every k, but
+ * conversions between `float` and the 16-bit floating-point types use SIMD
+ * instructions: F16C or AVX-512F for `Types::Half` (in the `ActiveIsa()`
+ * variant), shifts for widening `Types::BFloat16` and AVX-512 BF16 for
+ * narrowing it when the build enables it. Other 16-bit conversions go
+ * through `float`; everything else is a plain loop the compiler vectorizes.
+ *
+ * `Expr::Assign()` uses it for `Cast()` between contiguous matrices and
+ * `Kernel::Gemm()` to pack 16-bit operands into fp32.
+ *
+ * @tparam _from Source value type.
+ * @tparam _to   Destination value type.
+ * @param _src Source values.
+ * @param _dst Destination values; must not overlap `_src`.
+ * @param _n   Number of values.
+ */
+template <typename _from, typename _to>
+void Convert(const _from* _src, _to* _dst, std::size_t _n);
+
+}  // namespace Sglty::Kernel
+
+#include "Impl/Convert.tpp"
+
+// Singularity/Kernel/Convert.hpp
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+
+#include "../Fwd.hpp"
+
+namespace Sglty::Kernel {
+
+/**
+ * @brief Smallest `rows * cols * inner` for which `Expr::Assign()` evaluates
+ * a matrix product with `Gemm()` instead of element by element.
+ */
+constexpr inline std::size_t gemm_min_work = 16 * 16 * 16;
+
+/**
+ * @brief Evaluates the matrix product `_l * _r` into `_dst`.
+ *
+ * Both operands are packed once into contiguous row-major buffers of their
+ * element types, reading every operand element exactly once. Lazy `Cast`,
+ * `Reorder` and `Trp` nodes (and any other expression) are therefore
+ * converted or re-indexed during packing rather than once per use in the
+ * inner loop. Each result row is then accumulated with unit-stride loops the
+ * compiler can vectorize, summing in the same order as `Expr::MulMatrix`
+ * without fusing multiply-adds, so results are identical in every
+ * `ActiveIsa()` variant.
+ *
+ * 16-bit floating-point operands (`Types::Half`, `Types::BFloat16`) are
+ * packed as fp32 and accumulated in fp32. Rows of contiguous row-major
+ * operands and of the destination are converted in bulk with
+ * `Kernel::Convert()`.
+ *
+ * Packing buffers come from the thread's `Mem::Scratch` block, so repeated
+ * products of the same shapes do not allocate. Runtime only;
+ * `Expr::Assign()` keeps the element-wise path during constant evaluation.
+ *
+ * @tparam _core_impl The core implementation of the destination.
+ * @tparam _lhs       Left operand expression (`rows × inner`).
+ * @tparam _rhs       Right operand expression (`inner × cols`).
+ * @param _dst The destination matrix; must not alias the operands.
+ * @param _l   Left operand.
+ * @param _r   Right operand.
+ */
+template <typename _core_impl, typename _lhs, typename _rhs>
+void Gemm(Types::Matrix<_core_impl>& _dst, const _lhs& _l, const _rhs& _r);
+
+}  // namespace Sglty::Kernel
+
+#include "Impl/Gemm.tpp"
+
+// Singularity/Kernel/Gemm.hpp
@@ -0,0 +1,435 @@
+#pragma once
+
+#include "../Backend.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+#include "../../Mem/Allocator.hpp"
+
+namespace Sglty::Kernel {
+
+#if defined(SGLTY_ENABLE_CBLAS)
+const Backend& CblasBackend();
+#endif
+
+namespace Impl {
+
+template <typename _Tp>
+using RefBuffer = std::vector<_Tp, Mem::Allocator<_Tp>>;
+
+// Offset of element (i, j) of an array stored in `_layout`.
+inline std::size_t Index(Core::Major _layout,
+                         std::size_t _ld,
+                         std::size_t _i,
+                         std::size_t _j) {
+  return _layout == Core::Major::Row ? _i * _ld + _j : _j * _ld + _i;
+}
+
+// Offset of element (i, j) of op(A).
+inline std::size_t OpIndex(Core::Major _layout,
+                           Trans _t,
+                           std::size_t _ld,
+                           std::size_t _i,
+                           std::size_t _j) {
+  return _t == Trans::No ? Index(_layout, _ld, _i, _j)
+                         : Index(_layout, _ld, _j, _i);
+}
+
+template <typename _Tp>
+_Tp Scale(_Tp _alpha, _Tp _v, _Tp _beta, _Tp _old) {
+  return _beta == _Tp(0) ? _alpha * _v : _alpha * _v + _beta * _old;
+}
+
+template <typename _Tp>
+void RefGemm(Core::Major _layout,
+             Trans _ta,
+             Trans _tb,
+             std::size_t _m,
+             std::size_t _n,
+             std::size_t _k,
+             _Tp _alpha,
+             const _Tp* _a,
+             std::size_t _lda,
+             const _Tp* _b,
+             std::size_t _ldb,
+             _Tp _beta,
+             _Tp* _c,
+             std::size_t _ldc) {
+  // op(B) packed row-major, as in `Kernel::Gemm()`.
+  RefBuffer<_Tp> b(_k * _n);
+  for (std::size_t l = 0; l < _k; l++) {
+    for (std::size_t j = 0; j < _n; j++) {
+      b[l * _n + j] = _b[OpIndex(_layout, _tb, _ldb, l, j)];
+    }
+  }
+
+  RefBuffer<_Tp> acc(_n);
+  for (std::size_t i = 0; i < _m; i++) {
+    std::fill(acc.begin(), acc.end(), _Tp(0));
+    for (std::size_t l = 0; l < _k; l++) {
+      const _Tp  a_il  = _a[OpIndex(_layout, _ta, _lda, i, l)];
+      const _Tp* b_row = b.data() + l * _n;
+      for (std::size_t j = 0; j < _n; j++) {
+        acc[j] += a_il * b_row[j];
+      }
+    }
+    for (std::size_t j = 0; j < _n; j++) {
+      _Tp& c = _c[Index(_layout, _ldc, i, j)];
+      c      = Scale(_alpha, acc[j], _beta, c);
+    }
+  }
+}
+
+template <typename _Tp>
+void RefGemv(Core::Major _layout,
+             Trans _ta,
+             std::size_t _m,
+             std::size_t _n,
+             _Tp _alpha,
+             const _Tp* _a,
+             std::size_t _lda,
+             const _Tp* _x,
+             std::size_t _incx,
+             _Tp _beta,
+             _Tp* _y,
+             std::size_t _incy) {
+  const std::size_t rows  = _ta == Trans::No ? _m : _n;
+  const std::size_t inner = _ta == Trans::No ? _n : _m;
+
+  for (std::size_t i = 0; i < rows; i++) {
+    _Tp s = _Tp(0);
+    for (std::size_t l = 0; l < inner; l++) {
+      s += _a[OpIndex(_layout, _ta, _lda, i, l)] * _x[l * _incx];
+    }
+    _y[i * _incy] = Scale(_alpha, s, _beta, _y[i * _incy]);
+  }
+}
+
+template <typename _Tp>
+void RefTrsm(Core::Major _layout,
+             Side _side,
+             Uplo _uplo,
+             Trans _ta,
+             Diag _diag,
+             std::size_t _m,
+             std::size_t _n,
+             _Tp _alpha,
+             const _Tp* _a,
+             std::size_t _lda,
+             _Tp* _b,
+             std::size_t _ldb) {
+  const auto a = [&](std::size_t i, std::size_t j) {
+    return _a[OpIndex(_layout, _ta, _lda, i, j)];
+  };
+  const auto b = [&](std::size_t i, std::size_t j) -> _Tp& {
+    return _b[Index(_layout, _ldb, i, j)];
+  };
+  const bool lower = (_uplo == Uplo::Lower) != (_ta == Trans::Yes);
+  const bool unit  = _diag == Diag::Unit;
+
+  if (_side == Side::Left) {
+    // op(A) X = alpha B, one column of B at a time.
+    for (std::size_t j = 0; j < _n; j++) {
+      for (std::size_t t = 0; t < _m; t++) {
+        const std::size_t i = lower ? t : _m - 1 - t;
+        _Tp               s = _alpha * b(i, j);
+        if (lower) {
+          for (std::size_t l = 0; l < i; l++) {
+            s -= a(i, l) * b(l, j);
+          }
+        } else {
+          for (std::size_t l = i + 1; l < _m; l++) {
+            s -= a(i, l) * b(l, j);
+          }
+        }
+        b(i, j) = unit ? s : s / a(i, i);
+      }
+    }
+  } else {
+    // X op(A) = alpha B, one row of B at a time.
+    for (std::size_t i = 0; i < _m; i++) {
+      for (std::size_t t = 0; t < _n; t++) {
+        const std::size_t j = lower ? _n - 1 - t : t;
+        _Tp               s = _alpha * b(i, j);
+        if (lower) {
+          for (std::size_t l = j + 1; l < _n; l++) {
+            s -= b(i, l) * a(l, j);
+          }
+        } else {
+          for (std::size_t l = 0; l < j; l++) {
+            s -= b(i, l) * a(l, j);
+          }
+        }
+        b(i, j) = unit ? s : s / a(j, j);
+      }
+    }
+  }
+}
+
+template <typename _Tp>
+void RefSyrk(Core::Major _layout,
+             Uplo _uplo,
+             Trans _ta,
+             std::size_t _n,
+             std::size_t _k,
+             _Tp _alpha,
+             const _Tp* _a,
+             std::size_t _lda,
+             _Tp _beta,
+             _Tp* _c,
+             std::size_t _ldc) {
+  for (std::size_t i = 0; i < _n; i++) {
+    const std::size_t lo = _uplo == Uplo::Lower ? 0 : i;
+    const std::size_t hi = _uplo == Uplo::Lower ? i + 1 : _n;
+    for (std::size_t j = lo; j < hi; j++) {
+      _Tp s = _Tp(0);
+      for (std::size_t l = 0; l < _k; l++) {
+        s += _a[OpIndex(_layout, _ta, _lda, i, l)] *
+             _a[OpIndex(_layout, _ta, _lda, j, l)];
+      }
+      _Tp& c = _c[Index(_layout, _ldc, i, j)];
+      c      = Scale(_alpha, s, _beta, c);
+    }
+  }
+}
+
+class Reference final : public Backend {
+ public:
+  std::string_view Name() const override { return "reference"; }
+
+  void Gemm(Core::Major _layout,
+            Trans _ta,
+            Trans _tb,
+            std::size_t _m,
+            std::size_t _n,
+            std::size_t _k,
+            float _alpha,
+            const float* _a,
+            std::size_t _lda,
+            const float* _b,
+            std::size_t _ldb,
+            float _beta,
+            float* _c,
+            std::size_t _ldc) const override {
+    RefGemm(_layout,
+            _ta,
+            _tb,
+            _m,
+            _n,
+            _k,
+            _alpha,
+            _a,
+            _lda,
+            _b,
+            _ldb,
+            _beta,
+            _c,
+            _ldc);
+  }
+
+  void Gemm(Core::Major _layout,
+            Trans _ta,
+            Trans _tb,
+            std::size_t _m,
+            std::size_t _n,
+            std::size_t _k,
+            double _alpha,
+            const double* _a,
+            std::size_t _lda,
+            const double* _b,
+            std::size_t _ldb,
+            double _beta,
+            double* _c,
+            std::size_t _ldc) const override {
+    RefGemm(_layout,
+            _ta,
+            _tb,
+            _m,
+            _n,
+            _k,
+            _alpha,
+            _a,
+            _lda,
+            _b,
+            _ldb,
+            _beta,
+            _c,
+            _ldc);
+  }
+
+  void Gemv(Core::Major _layout,
+            Trans _ta,
+            std::size_t _m,
+            std::size_t _n,
+            float _alpha,
+            const float* _a,
+            std::size_t _lda,
+            const float* _x,
+            std::size_t _incx,
+            float _beta,
+            float* _y,
+            std::size_t _incy) const override {
+    RefGemv(
+        _layout, _ta, _m, _n, _alpha, _a, _lda, _x, _incx, _beta, _y, _incy);
+  }
+
+  void Gemv(Core::Major _layout,
+            Trans _ta,
+            std::size_t _m,
+            std::size_t _n,
+            double _alpha,
+            const double* _a,
+            std::size_t _lda,
+            const double* _x,
+            std::size_t _incx,
+            double _beta,
+            double* _y,
+            std::size_t _incy) const override {
+    RefGemv(
+        _layout, _ta, _m, _n, _alpha, _a, _lda, _x, _incx, _beta, _y, _incy);
+  }
+
+  void Trsm(Core::Major _layout,
+            Side _side,
+            Uplo _uplo,
+            Trans _ta,
+            Diag _diag,
+            std::size_t _m,
+            std::size_t _n,
+            float _alpha,
+            const float* _a,
+            std::size_t _lda,
+            float* _b,
+            std::size_t _ldb) const override {
+    RefTrsm(_layout,
+            _side,
+            _uplo,
+            _ta,
+            _diag,
+            _m,
+            _n,
+            _alpha,
+            _a,
+            _lda,
+            _b,
+            _ldb);
+  }
+
+  void Trsm(Core::Major _layout,
+            Side _side,
+            Uplo _uplo,
+            Trans _ta,
+            Diag _diag,
+            std::size_t _m,
+            std::size_t _n,
+            double _alpha,
+            const double* _a,
+            std::size_t _lda,
+            double* _b,
+            std::size_t _ldb) const override {
+    RefTrsm(_layout,
+            _side,
+            _uplo,
+            _ta,
+            _diag,
+            _m,
+            _n,
+            _alpha,
+            _a,
+            _lda,
+            _b,
+            _ldb);
+  }
+
+  void Syrk(Core::Major _layout,
+            Uplo _uplo,
+            Trans _ta,
+            std::size_t _n,
+            std::size_t _k,
+            float _alpha,
+            const float* _a,
+            std::size_t _lda,
+            float _beta,
+            float* _c,
+            std::size_t _ldc) const override {
+    RefSyrk(
+        _layout, _uplo, _ta, _n, _k, _alpha, _a, _lda, _beta, _c, _ldc);
+  }
+
+  void Syrk(Core::Major _layout,
+            Uplo _uplo,
+            Trans _ta,
+            std::size_t _n,
+            std::size_t _k,
+            double _alpha,
+            const double* _a,
+            std::size_t _lda,
+            double _beta,
+            double* _c,
+            std::size_t _ldc) const override {
+    RefSyrk(
+        _layout, _uplo, _ta, _n, _k, _alpha, _a, _lda, _beta, _c, _ldc);
+  }
+};
+
+struct BackendRegistry {
+  BackendRegistry() : backends{&ReferenceBackend()} {
+#if defined(SGLTY_ENABLE_CBLAS)
+    backends.push_back(&CblasBackend());
+#endif
+  }
+
+  std::mutex mutex;
+  std::vector<const Backend*> backends;
+};
+
+inline BackendRegistry& GetBackendRegistry() {
+  static BackendRegistry registry;
+  return registry;
+}
+
+}  // namespace Impl
+
+inline const Backend& ReferenceBackend() {
+  static const Impl::Reference reference;
+  return reference;
+}
+
+inline void RegisterBackend(const Backend& _backend) {
+  Impl::BackendRegistry& r = Impl::GetBackendRegistry();
+  std::lock_guard<std::mutex> lock(r.mutex);
+
+  for (const Backend*& b : r.backends) {
+    if (b->Name() == _backend.Name()) {
+      b = &_backend;
+      return;
+    }
+  }
+  r.backends.push_back(&_backend);
+}
+
+inline const Backend* FindBackend(std::string_view _name) {
+  Impl::BackendRegistry& r = Impl::GetBackendRegistry();
+  std::lock_guard<std::mutex> lock(r.mutex);
+
+  for (const Backend* b : r.backends) {
+    if (b->Name() == _name) {
+      return b;
+    }
+  }
+  return nullptr;
+}
+
+inline std::vector<const Backend*> Backends() {
+  Impl::BackendRegistry& r = Impl::GetBackendRegistry();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  return r.backends;
+}
+
+}  // namespace Sglty::Kernel
+
+// Singularity/Kernel/Impl/Backend.tpp
@@ -0,0 +1,266 @@
+#pragma once
+
+#include "../Cblas.hpp"
+
+#include <cstddef>
+#include <string_view>
+
+#include SGLTY_CBLAS_HEADER
+
+namespace Sglty::Kernel {
+
+namespace Impl {
+
+using CblasInt = SGLTY_CBLAS_INT;
+
+inline CBLAS_ORDER ToCblas(Core::Major _layout) {
+  return _layout == Core::Major::Row ? CblasRowMajor : CblasColMajor;
+}
+
+inline CBLAS_TRANSPOSE ToCblas(Trans _t) {
+  return _t == Trans::No ? CblasNoTrans : CblasTrans;
+}
+
+inline CBLAS_UPLO ToCblas(Uplo _u) {
+  return _u == Uplo::Upper ? CblasUpper : CblasLower;
+}
+
+inline CBLAS_SIDE ToCblas(Side _s) {
+  return _s == Side::Left ? CblasLeft : CblasRight;
+}
+
+inline CBLAS_DIAG ToCblas(Diag _d) {
+  return _d == Diag::NonUnit ? CblasNonUnit : CblasUnit;
+}
+
+inline CblasInt CblasSize(std::size_t _n) {
+  return static_cast<CblasInt>(_n);
+}
+
+class Cblas final : public Backend {
+ public:
+  std::string_view Name() const override { return "cblas"; }
+
+  void Gemm(Core::Major _layout,
+            Trans _ta,
+            Trans _tb,
+            std::size_t _m,
+            std::size_t _n,
+            std::size_t _k,
+            float _alpha,
+            const float* _a,
+            std::size_t _lda,
+            const float* _b,
+            std::size_t _ldb,
+            float _beta,
+            float* _c,
+            std::size_t _ldc) const override {
+    cblas_sgemm(ToCblas(_layout),
+                ToCblas(_ta),
+                ToCblas(_tb),
+                CblasSize(_m),
+                CblasSize(_n),
+                CblasSize(_k),
+                _alpha,
+                _a,
+                CblasSize(_lda),
+                _b,
+                CblasSize(_ldb),
+                _beta,
+                _c,
+                CblasSize(_ldc));
+  }
+
+  void Gemm(Core::Major _layout,
+            Trans _ta,
+            Trans _tb,
+            std::size_t _m,
+            std::size_t _n,
+            std::size_t _k,
+            double _alpha,
+            const double* _a,
+            std::size_t _lda,
+            const double* _b,
+            std::size_t _ldb,
+            double _beta,
+            double* _c,
+            std::size_t _ldc) const override {
+    cblas_dgemm(ToCblas(_layout),
+                ToCblas(_ta),
+                ToCblas(_tb),
+                CblasSize(_m),
+                CblasSize(_n),
+                CblasSize(_k),
+                _alpha,
+                _a,
+                CblasSize(_lda),
+                _b,
+                CblasSize(_ldb),
+                _beta,
+                _c,
+                CblasSize(_ldc));
+  }
+
+  void Gemv(Core::Major _layout,
+            Trans _ta,
+            std::size_t _m,
+            std::size_t _n,
+            float _alpha,
+            const float* _a,
+            std::size_t _lda,
+            const float* _x,
+            std::size_t _incx,
+            float _beta,
+            float* _y,
+            std::size_t _incy) const override {
+    cblas_sgemv(ToCblas(_layout),
+                ToCblas(_ta),
+                CblasSize(_m),
+                CblasSize(_n),
+                _alpha,
+                _a,
+                CblasSize(_lda),
+                _x,
+                CblasSize(_incx),
+                _beta,
+                _y,
+                CblasSize(_incy));
+  }
+
+  void Gemv(Core::Major _layout,
+            Trans _ta,
+            std::size_t _m,
+            std::size_t _n,
+            double _alpha,
+            const double* _a,
+            std::size_t _lda,
+            const double* _x,
+            std::size_t _incx,
+            double _beta,
+            double* _y,
+            std::size_t _incy) const override {
+    cblas_dgemv(ToCblas(_layout),
+                ToCblas(_ta),
+                CblasSize(_m),
+                CblasSize(_n),
+                _alpha,
+                _a,
+                CblasSize(_lda),
+                _x,
+                CblasSize(_incx),
+                _beta,
+                _y,
+                CblasSize(_incy));
+  }
+
+  void Trsm(Core::Major _layout,
+            Side _side,
+            Uplo _uplo,
+            Trans _ta,
+            Diag _diag,
+            std::size_t _m,
+            std::size_t _n,
+            float _alpha,
+            const float* _a,
+            std::size_t _lda,
+            float* _b,
+            std::size_t _ldb) const override {
+    cblas_strsm(ToCblas(_layout),
+                ToCblas(_side),
+                ToCblas(_uplo),
+                ToCblas(_ta),
+                ToCblas(_diag),
+                CblasSize(_m),
+                CblasSize(_n),
+                _alpha,
+                _a,
+                CblasSize(_lda),
+                _b,
+                CblasSize(_ldb));
+  }
+
+  void Trsm(Core::Major _layout,
+            Side _side,
+            Uplo _uplo,
+            Trans _ta,
+            Diag _diag,
+            std::size_t _m,
+            std::size_t _n,
+            double _alpha,
+            const double* _a,
+            std::size_t _lda,
+            double* _b,
+            std::size_t _ldb) const override {
+    cblas_dtrsm(ToCblas(_layout),
+                ToCblas(_side),
+                ToCblas(_uplo),
+                ToCblas(_ta),
+                ToCblas(_diag),
+                CblasSize(_m),
+                CblasSize(_n),
+                _alpha,
+                _a,
+                CblasSize(_lda),
+                _b,
+                CblasSize(_ldb));
+  }
+
+  void Syrk(Core::Major _layout,
+            Uplo _uplo,
+            Trans _ta,
+            std::size_t _n,
+            std::size_t _k,
+            float _alpha,
+            const float* _a,
+            std::size_t _lda,
+            float _beta,
+            float* _c,
+            std::size_t _ldc) const override {
+    cblas_ssyrk(ToCblas(_layout),
+                ToCblas(_uplo),
+                ToCblas(_ta),
+                CblasSize(_n),
+                CblasSize(_k),
+                _alpha,
+                _a,
+                CblasSize(_lda),
+                _beta,
+                _c,
+                CblasSize(_ldc));
+  }
+
+  void Syrk(Core::Major _layout,
+            Uplo _uplo,
+            Trans _ta,
+            std::size_t _n,
+            std::size_t _k,
+            double _alpha,
+            const double* _a,
+            std::size_t _lda,
+            double _beta,
+            double* _c,
+            std::size_t _ldc) const override {
+    cblas_dsyrk(ToCblas(_layout),
+                ToCblas(_uplo),
+                ToCblas(_ta),
+                CblasSize(_n),
+                CblasSize(_k),
+                _alpha,
+                _a,
+                CblasSize(_lda),
+                _beta,
+                _c,
+                CblasSize(_ldc));
+  }
+};
+
+}  // namespace Impl
+
+inline const Backend& CblasBackend() {
+  static const Impl::Cblas cblas;
+  return cblas;
+}
+
+}  // namespace Sglty::Kernel
+
+// Singularity/Kernel/Impl/Cblas.tpp
@@ -0,0 +1,129 @@
+#pragma once
+
+#include "../Compare.hpp"
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+#include "../Isa.hpp"
+
+namespace Sglty::Kernel {
+
+namespace Impl {
+
+template <typename _Tp>
+using CompareCompute =
+    std::conditional_t<std::is_floating_point_v<_Tp>, _Tp, double>;
+
+template <typename _Tp>
+constexpr _Tp CompareAbs(_Tp _x) {
+  return _x < 0 ? -_x : _x;
+}
+
+template <typename _Tp>
+constexpr _Tp CompareMax(_Tp _a, _Tp _b) {
+  return _a < _b ? _b : _a;
+}
+
+// Whether `_d <= _tol` for a finite distance; `inf - inf` is NaN, so an
+// infinite distance never passes, whatever the tolerance.
+template <typename _Tp>
+constexpr bool CompareWithin(_Tp _d, _Tp _tol) {
+  return (_d - _d == 0) & (_d <= _tol);
+}
+
+}  // namespace Impl
+
+template <typename _Tp, typename _Up>
+constexpr bool IsClose(const _Tp& _a,
+                       const _Up& _b,
+                       double _rel,
+                       double _abs) {
+  using calc = Impl::CompareCompute<decltype(_a - _b)>;
+
+  const calc a = static_cast<calc>(_a);
+  const calc b = static_cast<calc>(_b);
+  const calc d = Impl::CompareAbs(a - b);
+  const calc m = Impl::CompareMax(Impl::CompareAbs(a), Impl::CompareAbs(b));
+  return a == b ||
+         Impl::CompareWithin(d, Impl::CompareMax(static_cast<calc>(_abs),
+                                                 static_cast<calc>(_rel) * m));
+}
+
+template <typename _Tp>
+bool Equal(const _Tp* _a, const _Tp* _b, std::size_t _n) {
+  static_assert(std::is_arithmetic_v<_Tp>,
+                "Error: `Kernel::Equal()` needs arithmetic values.");
+
+  if constexpr (std::is_integral_v<_Tp>) {
+    return _n == 0 || std::memcmp(_a, _b, _n * sizeof(_Tp)) == 0;
+  } else {
+    // Fixed-length blocks, so the inner loop vectorizes at -O2.
+    return IsaDispatch([&](auto) {
+      std::size_t k = 0;
+      for (; k + compare_block <= _n; k += compare_block) {
+        int diff = 0;
+        for (std::size_t l = 0; l < compare_block; l++) {
+          diff |= _a[k + l] != _b[k + l];
+        }
+        if (diff) {
+          return false;
+        }
+      }
+
+      int diff = 0;
+      for (; k < _n; k++) {
+        diff |= _a[k] != _b[k];
+      }
+      return !diff;
+    });
+  }
+}
+
+template <typename _Tp>
+bool Approx(const _Tp* _a,
+            const _Tp* _b,
+            std::size_t _n,
+            double _rel,
+            double _abs) {
+  static_assert(std::is_arithmetic_v<_Tp>,
+                "Error: `Kernel::Approx()` needs arithmetic values.");
+
+  using calc = Impl::CompareCompute<_Tp>;
+
+  const calc rel = static_cast<calc>(_rel);
+  const calc abs = static_cast<calc>(_abs);
+
+  const auto far = [&](std::size_t l) {
+    const calc a = static_cast<calc>(_a[l]);
+    const calc b = static_cast<calc>(_b[l]);
+    const calc m = Impl::CompareMax(Impl::CompareAbs(a), Impl::CompareAbs(b));
+    const calc t = Impl::CompareMax(abs, rel * m);
+    const calc d = Impl::CompareAbs(a - b);
+    return !((a == b) | Impl::CompareWithin(d, t));
+  };
+
+  return IsaDispatch([&](auto) {
+    std::size_t k = 0;
+    for (; k + compare_block <= _n; k += compare_block) {
+      int diff = 0;
+      for (std::size_t l = 0; l < compare_block; l++) {
+        diff |= far(k + l);
+      }
+      if (diff) {
+        return false;
+      }
+    }
+
+    int diff = 0;
+    for (; k < _n; k++) {
+      diff |= far(k);
+    }
+    return !diff;
+  });
+}
+
+}  // namespace Sglty::Kernel
+
+// Singularity/Kernel/Impl/Compare.tpp
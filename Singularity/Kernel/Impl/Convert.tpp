@@ -0,0 +1,204 @@
+#pragma once
+
+#include "../Convert.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "../../Config.hpp"
+
+#if SGLTY_HAS_X86_KERNELS
+#include <immintrin.h>
+#endif
+
+#include "../../Types/Float16.hpp"
+#include "../Isa.hpp"
+
+namespace Sglty::Kernel {
+
+namespace Impl {
+
+// F16C converts 8 values at a time, AVX-512 16. The zero-masked AVX-512
+// forms avoid a `-Wmaybe-uninitialized` false positive from the unmasked
+// ones in GCC's headers.
+inline void HalfToFloat(const Types::Half* _src, float* _dst, std::size_t _n) {
+  std::size_t k = 0;
+#if SGLTY_HAS_X86_KERNELS && defined(__AVX512F__)
+  for (; k + 16 <= _n; k += 16) {
+    const __m256i h =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_src + k));
+    _mm512_storeu_ps(_dst + k, _mm512_maskz_cvtph_ps(__mmask16(-1), h));
+  }
+#endif
+#if SGLTY_HAS_X86_KERNELS && defined(__F16C__)
+  for (; k + 8 <= _n; k += 8) {
+    const __m128i h =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(_src + k));
+    _mm256_storeu_ps(_dst + k, _mm256_cvtph_ps(h));
+  }
+#endif
+  for (; k < _n; k++) {
+    _dst[k] = float(_src[k]);
+  }
+}
+
+inline void FloatToHalf(const float* _src, Types::Half* _dst, std::size_t _n) {
+  std::size_t k = 0;
+#if SGLTY_HAS_X86_KERNELS && defined(__AVX512F__)
+  for (; k + 16 <= _n; k += 16) {
+    const __m256i h = _mm512_maskz_cvtps_ph(
+        __mmask16(-1), _mm512_loadu_ps(_src + k), _MM_FROUND_TO_NEAREST_INT);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(_dst + k), h);
+  }
+#endif
+#if SGLTY_HAS_X86_KERNELS && defined(__F16C__)
+  for (; k + 8 <= _n; k += 8) {
+    const __m128i h =
+        _mm256_cvtps_ph(_mm256_loadu_ps(_src + k), _MM_FROUND_TO_NEAREST_INT);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(_dst + k), h);
+  }
+#endif
+  for (; k < _n; k++) {
+    _dst[k] = Types::Half(_src[k]);
+  }
+}
+
+#if SGLTY_HAS_X86_KERNELS && SGLTY_HAS_MULTIVERSIONING
+SGLTY_TARGET(SGLTY_ISA_AVX2)
+inline void HalfToFloatAvx2(const Types::Half* _src,
+                            float* _dst,
+                            std::size_t _n) {
+  std::size_t k = 0;
+  for (; k + 8 <= _n; k += 8) {
+    const __m128i h =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(_src + k));
+    _mm256_storeu_ps(_dst + k, _mm256_cvtph_ps(h));
+  }
+  for (; k < _n; k++) {
+    _dst[k] = float(_src[k]);
+  }
+}
+
+SGLTY_TARGET(SGLTY_ISA_AVX512)
+inline void HalfToFloatAvx512(const Types::Half* _src,
+                              float* _dst,
+                              std::size_t _n) {
+  std::size_t k = 0;
+  for (; k + 16 <= _n; k += 16) {
+    const __m256i h =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_src + k));
+    _mm512_storeu_ps(_dst + k, _mm512_maskz_cvtph_ps(__mmask16(-1), h));
+  }
+  HalfToFloatAvx2(_src + k, _dst + k, _n - k);
+}
+
+SGLTY_TARGET(SGLTY_ISA_AVX2)
+inline void FloatToHalfAvx2(const float* _src,
+                            Types::Half* _dst,
+                            std::size_t _n) {
+  std::size_t k = 0;
+  for (; k + 8 <= _n; k += 8) {
+    const __m128i h =
+        _mm256_cvtps_ph(_mm256_loadu_ps(_src + k), _MM_FROUND_TO_NEAREST_INT);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(_dst + k), h);
+  }
+  for (; k < _n; k++) {
+    _dst[k] = Types::Half(_src[k]);
+  }
+}
+
+SGLTY_TARGET(SGLTY_ISA_AVX512)
+inline void FloatToHalfAvx512(const float* _src,
+                              Types::Half* _dst,
+                              std::size_t _n) {
+  std::size_t k = 0;
+  for (; k + 16 <= _n; k += 16) {
+    const __m256i h = _mm512_maskz_cvtps_ph(
+        __mmask16(-1), _mm512_loadu_ps(_src + k), _MM_FROUND_TO_NEAREST_INT);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(_dst + k), h);
+  }
+  FloatToHalfAvx2(_src + k, _dst + k, _n - k);
+}
+#endif
+
+inline void BFloat16ToFloat(const Types::BFloat16* _src,
+                            float* _dst,
+                            std::size_t _n) {
+  // A bfloat16 is the upper half of a float; the loop vectorizes as a
+  // zero-extend and shift.
+  for (std::size_t k = 0; k < _n; k++) {
+    const std::uint32_t w = std::uint32_t(_src[k].bits) << 16;
+    std::memcpy(_dst + k, &w, sizeof(w));
+  }
+}
+
+inline void FloatToBFloat16(const float* _src,
+                            Types::BFloat16* _dst,
+                            std::size_t _n) {
+  std::size_t k = 0;
+#if SGLTY_HAS_X86_KERNELS && defined(__AVX512BF16__)
+  for (; k < _n / 16 * 16; k += 16) {
+    const __m256bh b = _mm512_cvtneps_pbh(_mm512_loadu_ps(_src + k));
+    std::memcpy(static_cast<void*>(_dst + k), &b, sizeof(b));
+  }
+#endif
+  for (; k < _n; k++) {
+    _dst[k] = Types::BFloat16(_src[k]);
+  }
+}
+
+}  // namespace Impl
+
+template <typename _from, typename _to>
+void Convert(const _from* _src, _to* _dst, std::size_t _n) {
+  using from_type = std::remove_cv_t<_from>;
+
+  if constexpr (std::is_same_v<from_type, Types::Half> &&
+                std::is_same_v<_to, float>) {
+#if SGLTY_HAS_X86_KERNELS && SGLTY_HAS_MULTIVERSIONING
+    static const auto convert = Impl::IsaSelect(&Impl::HalfToFloat,
+                                                &Impl::HalfToFloatAvx2,
+                                                &Impl::HalfToFloatAvx512);
+    convert(_src, _dst, _n);
+#else
+    Impl::HalfToFloat(_src, _dst, _n);
+#endif
+  } else if constexpr (std::is_same_v<from_type, float> &&
+                       std::is_same_v<_to, Types::Half>) {
+#if SGLTY_HAS_X86_KERNELS && SGLTY_HAS_MULTIVERSIONING
+    static const auto convert = Impl::IsaSelect(&Impl::FloatToHalf,
+                                                &Impl::FloatToHalfAvx2,
+                                                &Impl::FloatToHalfAvx512);
+    convert(_src, _dst, _n);
+#else
+    Impl::FloatToHalf(_src, _dst, _n);
+#endif
+  } else if constexpr (std::is_same_v<from_type, Types::BFloat16> &&
+                       std::is_same_v<_to, float>) {
+    Impl::BFloat16ToFloat(_src, _dst, _n);
+  } else if constexpr (std::is_same_v<from_type, float> &&
+                       std::is_same_v<_to, Types::BFloat16>) {
+    Impl::FloatToBFloat16(_src, _dst, _n);
+  } else if constexpr (!std::is_same_v<from_type, _to> &&
+                       (Types::is_float16_v<from_type> ||
+                        Types::is_float16_v<_to>)) {
+    // Through a small fp32 block so both halves use the paths above.
+    constexpr std::size_t block = 256;
+    float tmp[block];
+    for (std::size_t k = 0; k < _n; k += block) {
+      const std::size_t n = _n - k < block ? _n - k : block;
+      Convert(_src + k, tmp, n);
+      Convert(static_cast<const float*>(tmp), _dst + k, n);
+    }
+  } else {
+    for (std::size_t k = 0; k < _n; k++) {
+      _dst[k] = static_cast<_to>(_src[k]);
+    }
+  }
+}
+
+}  // namespace Sglty::Kernel
+
+// Singularity/Kernel/Impl/Convert.tpp
@@ -0,0 +1,124 @@
+#pragma once
+
+#include "../Gemm.hpp"
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "../../Instr/Trace.hpp"
+#include "../Convert.hpp"
+#include "../Isa.hpp"
+#include "../../Mem/Scratch.hpp"
+#include "../../Traits/Core.hpp"
+#include "../../Types/Float16.hpp"
+#include "../../Types/Matrix.hpp"
+
+namespace Sglty::Kernel {
+
+namespace Impl {
+
+/// Type operands are packed and multiplied in: 16-bit floats widen to fp32.
+template <typename _Tp>
+using Compute = std::conditional_t<Types::is_float16_v<_Tp>, float, _Tp>;
+
+/// Whether `_expr` is a matrix whose rows are contiguous in `Data()`, each
+/// `OuterStride()` elements after the previous one.
+template <typename _expr>
+struct HasContiguousRows : std::false_type {};
+
+template <typename _core_impl>
+struct HasContiguousRows<Types::Matrix<_core_impl>>
+    : std::bool_constant<Traits::Core::is_inner_contiguous_v<_core_impl> &&
+                         _core_impl::core_traits::core_major ==
+                             Core::Major::Row> {};
+
+/// Copies row `_i` of `_e` into `_dst`, converting contiguous rows in bulk.
+template <typename _expr, typename _Tp>
+void PackRow(const _expr& _e, std::size_t _i, _Tp* _dst) {
+  if constexpr (HasContiguousRows<_expr>::value) {
+    Convert(_e.Data() + _i * _expr::OuterStride(), _dst, _expr::cols);
+  } else {
+    for (std::size_t j = 0; j < _expr::cols; j++) {
+      _dst[j] = _e(_i, j);
+    }
+  }
+}
+
+/// `_acc[j] += _x * _y[j]`. The buffers never overlap, so `-O2` vectorizes
+/// it without runtime alias checks.
+template <typename _Tp, typename _Up, typename _Vp>
+void MulAdd(_Tp* __restrict _acc,
+            _Up _x,
+            const _Vp* __restrict _y,
+            std::size_t _n) {
+  for (std::size_t j = 0; j < _n; j++) {
+    _acc[j] += _x * _y[j];
+  }
+}
+
+}  // namespace Impl
+
+template <typename _core_impl, typename _lhs, typename _rhs>
+void Gemm(Types::Matrix<_core_impl>& _dst, const _lhs& _l, const _rhs& _r) {
+  using lhs_value = Impl::Compute<std::decay_t<decltype(_l(0, 0))>>;
+  using rhs_value = Impl::Compute<std::decay_t<decltype(_r(0, 0))>>;
+  using acc_value =
+      decltype(std::declval<lhs_value>() * std::declval<rhs_value>());
+
+  constexpr std::size_t rows  = _lhs::rows;
+  constexpr std::size_t inner = _lhs::cols;
+  constexpr std::size_t cols  = _rhs::cols;
+
+  SGLTY_TRACE_KERNEL("Gemm",
+                     rows,
+                     cols,
+                     (rows * inner * sizeof(lhs_value) +
+                      inner * cols * sizeof(rhs_value) +
+                      rows * cols * sizeof(acc_value)));
+
+  // rhs packed row-major: row k is contiguous across all result columns.
+  Mem::Scratch scratch(Mem::Scratch::Bytes<rhs_value>(inner * cols) +
+                       Mem::Scratch::Bytes<lhs_value>(inner) +
+                       Mem::Scratch::Bytes<acc_value>(cols));
+  Mem::ScratchArray<rhs_value> b(scratch, inner * cols);
+  for (std::size_t k = 0; k < inner; k++) {
+    Impl::PackRow(_r, k, b.data() + k * cols);
+  }
+
+  Mem::ScratchArray<lhs_value> a(scratch, inner);
+  Mem::ScratchArray<acc_value> acc(scratch, cols);
+
+  auto multiply = [&](auto) {
+    for (std::size_t i = 0; i < rows; i++) {
+      Impl::PackRow(_l, i, a.data());
+
+      for (std::size_t j = 0; j < cols; j++) {
+        acc[j] = a[0] * b[j];
+      }
+      for (std::size_t k = 1; k < inner; k++) {
+        Impl::MulAdd(acc.data(), a[k], b.data() + k * cols, cols);
+      }
+
+      if constexpr (Impl::HasContiguousRows<Types::Matrix<_core_impl>>::value) {
+        Convert(acc.data(), _dst.Data() + i * _dst.OuterStride(), cols);
+      } else {
+        for (std::size_t j = 0; j < cols; j++) {
+          _dst(i, j) = acc[j];
+        }
+      }
+    }
+  };
+
+  // Vectorized for the `ActiveIsa()` variant; user-defined element types
+  // are not compiled three times.
+  if constexpr (std::is_arithmetic_v<acc_value>) {
+    IsaDispatch(multiply);
+  } else {
+    multiply(IsaTag<Isa::Baseline>{});
+  }
+}
+
+}  // namespace Sglty::Kernel
+
+// Singularity/Kernel/Impl/Gemm.tpp
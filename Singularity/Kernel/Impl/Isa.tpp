@@ -0,0 +1,149 @@
+#pragma once
+
+#include "../Isa.hpp"
+
+#include <cstdlib>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace Sglty::Kernel {
+
+namespace Impl {
+
+/// Highest variant the build flags already require of the CPU.
+constexpr Isa BuildIsa() {
+#if defined(__AVX512F__) && defined(__AVX512BW__) && \
+    defined(__AVX512DQ__) && defined(__AVX512VL__)
+  return Isa::Avx512;
+#elif defined(__AVX2__) && defined(__FMA__) && defined(__F16C__)
+  return Isa::Avx2;
+#else
+  return Isa::Baseline;
+#endif
+}
+
+inline Isa ChooseIsa() {
+  const Isa detected = DetectedIsa();
+
+  const char* env = std::getenv("SGLTY_ISA");
+  if (env == nullptr) {
+    return detected;
+  }
+  for (const Isa isa : {Isa::Baseline, Isa::Avx2, Isa::Avx512}) {
+    if (IsaName(isa) == env) {
+      // Clamped to what was compiled in and what the CPU runs.
+      if (isa < BuildIsa()) {
+        return BuildIsa();
+      }
+      return detected < isa ? detected : isa;
+    }
+  }
+  return detected;
+}
+
+/// Returns the entry of a per-variant table for `ActiveIsa()`.
+template <typename _fn>
+_fn IsaSelect(_fn _baseline, _fn _avx2, _fn _avx512) {
+  switch (ActiveIsa()) {
+    case Isa::Avx512:
+      return _avx512;
+    case Isa::Avx2:
+      return _avx2;
+    default:
+      return _baseline;
+  }
+}
+
+template <typename _fn>
+using IsaResult =
+    decltype(std::declval<_fn&>()(IsaTag<Isa::Baseline>{}));
+
+template <typename _fn>
+IsaResult<_fn> IsaRunBaseline(_fn& _f) {
+  return _f(IsaTag<Isa::Baseline>{});
+}
+
+#if SGLTY_HAS_MULTIVERSIONING
+// `fp-contract=off` keeps FMA from fusing the multiply-adds of `_f`, so
+// every variant rounds like the baseline one.
+template <typename _fn>
+SGLTY_TARGET(SGLTY_ISA_AVX2)
+__attribute__((flatten, optimize("fp-contract=off")))
+IsaResult<_fn> IsaRunAvx2(_fn& _f) {
+  return _f(IsaTag<Isa::Avx2>{});
+}
+
+template <typename _fn>
+SGLTY_TARGET(SGLTY_ISA_AVX512)
+__attribute__((flatten, optimize("fp-contract=off")))
+IsaResult<_fn> IsaRunAvx512(_fn& _f) {
+  return _f(IsaTag<Isa::Avx512>{});
+}
+#endif
+
+}  // namespace Impl
+
+inline Isa DetectedIsa() {
+#if SGLTY_HAS_MULTIVERSIONING
+  static const Isa isa = [] {
+    __builtin_cpu_init();
+
+    // libgcc also checks that the OS saves the wider registers (XCR0).
+    Isa ret = Isa::Baseline;
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") &&
+        __builtin_cpu_supports("f16c")) {
+      ret = Isa::Avx2;
+      if (__builtin_cpu_supports("avx512f") &&
+          __builtin_cpu_supports("avx512bw") &&
+          __builtin_cpu_supports("avx512dq") &&
+          __builtin_cpu_supports("avx512vl")) {
+        ret = Isa::Avx512;
+      }
+    }
+    return ret < Impl::BuildIsa() ? Impl::BuildIsa() : ret;
+  }();
+  return isa;
+#else
+  return Impl::BuildIsa();
+#endif
+}
+
+inline Isa ActiveIsa() {
+#if SGLTY_HAS_MULTIVERSIONING
+  static const Isa isa = Impl::ChooseIsa();
+  return isa;
+#else
+  return Impl::BuildIsa();
+#endif
+}
+
+inline std::string_view IsaName(Isa _isa) {
+  switch (_isa) {
+    case Isa::Avx512:
+      return "avx512";
+    case Isa::Avx2:
+      return "avx2";
+    default:
+      return "baseline";
+  }
+}
+
+template <typename _fn>
+decltype(auto) IsaDispatch(_fn&& _f) {
+  using fn_type = std::remove_reference_t<_fn>;
+
+#if SGLTY_HAS_MULTIVERSIONING
+  static Impl::IsaResult<fn_type> (*const run)(fn_type&) =
+      Impl::IsaSelect(&Impl::IsaRunBaseline<fn_type>,
+                      &Impl::IsaRunAvx2<fn_type>,
+                      &Impl::IsaRunAvx512<fn_type>);
+  return run(_f);
+#else
+  return Impl::IsaRunBaseline<fn_type>(_f);
+#endif
+}
+
+}  // namespace Sglty::Kernel
+
+// Singularity/Kernel/Impl/Isa.tpp
@@ -0,0 +1,339 @@
+#pragma once
+
+#include "../Math.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include "../../Config.hpp"
+
+#if SGLTY_HAS_X86_KERNELS
+#include <immintrin.h>
+#endif
+
+#include "../../Types/Float16.hpp"
+#include "../Isa.hpp"
+
+namespace Sglty::Kernel {
+
+namespace Impl {
+
+/// True for the lane types the approximations are written for.
+template <typename _Tp>
+constexpr inline bool is_math_lane_v =
+    std::is_same_v<_Tp, float> || std::is_same_v<_Tp, double>;
+
+/// Type a scalar element is computed in: 16-bit floats as `float`, integers
+/// as `double`, floating-point types as themselves.
+template <typename _Tp>
+using MathCompute = std::conditional_t<
+    std::is_floating_point_v<_Tp>,
+    _Tp,
+    std::conditional_t<Types::is_float16_v<_Tp>, float, double>>;
+
+/**
+ * @brief Lane and same-width signed integer types of `_V`, which is either a
+ * `float` / `double` or a GCC vector of them.
+ */
+template <typename _V, bool = std::is_arithmetic_v<_V>>
+struct MathLanes {
+  using lane     = _V;
+  using int_lane =
+      std::conditional_t<sizeof(_V) == 4, std::int32_t, std::int64_t>;
+  using bits = int_lane;
+  using wide     = double;
+};
+
+#if SGLTY_HAS_VECTOR_EXTENSIONS
+template <typename _V>
+struct MathLanes<_V, false> {
+  using lane = std::remove_cv_t<
+      std::remove_reference_t<decltype(std::declval<_V>()[0])>>;
+  using int_lane =
+      std::conditional_t<sizeof(lane) == 4, std::int32_t, std::int64_t>;
+
+  typedef int_lane bits __attribute__((vector_size(sizeof(_V))));
+  typedef double wide
+      __attribute__((vector_size(sizeof(_V) / sizeof(lane) * sizeof(double))));
+};
+
+/// Vector of `_bytes` bytes of `_Tp`.
+template <typename _Tp, std::size_t _bytes>
+struct MathPack {
+  typedef _Tp type __attribute__((vector_size(_bytes)));
+};
+#endif
+
+template <typename _V>
+using MathLane = typename MathLanes<_V>::lane;
+
+template <typename _V>
+using MathBits = typename MathLanes<_V>::bits;
+
+template <typename _Tp>
+struct MathConsts;
+
+/**
+ * @brief Format constants and polynomial coefficients per lane type.
+ *
+ * - `exp`: Taylor coefficients 1/k! of e^r; |r| <= ln(2)/2 keeps the
+ *   truncation below half an ulp.
+ * - `log`: the series R(z) = 2z/3 + 2z^2/5 + ... in
+ *   log(1 + f) = f - s (f - R(s^2)) with s = f / (2 + f); |s| <= 0.172.
+ * - `tanh`: Taylor series of tanh(x) / x - 1 in x^2, used for |x| < 0.25.
+ *
+ * `ln2_hi` has trailing zero bits, so `k * ln2_hi` is exact for every `k`
+ * the exponential reaches.
+ */
+template <>
+struct MathConsts<float> {
+  constexpr static int mant       = 23;
+  constexpr static int bias       = 127;
+  constexpr static float ln2_hi   = 0x1.63p-1f;
+  constexpr static float ln2_lo   = -0x1.bd0106p-13f;
+  constexpr static float exp_lo   = -104.0f;
+  constexpr static float exp_hi   = 89.0f;
+  constexpr static float subnorm  = 0x1p24f;
+  constexpr static int subnorm_e  = 24;
+
+  constexpr static float exp[] = {1.0f,
+                                  1.0f,
+                                  1.0f / 2,
+                                  1.0f / 6,
+                                  1.0f / 24,
+                                  1.0f / 120,
+                                  1.0f / 720,
+                                  1.0f / 5040};
+
+  constexpr static float log[] = {
+      2.0f / 3, 2.0f / 5, 2.0f / 7, 2.0f / 9, 2.0f / 11};
+
+  constexpr static float tanh[] = {-1.0f / 3,
+                                   2.0f / 15,
+                                   -17.0f / 315,
+                                   62.0f / 2835,
+                                   -1382.0f / 155925};
+};
+
+template <>
+struct MathConsts<double> {
+  constexpr static int mant       = 52;
+  constexpr static int bias       = 1023;
+  constexpr static double ln2_hi  = 0x1.62e42feep-1;
+  constexpr static double ln2_lo  = 0x1.a39ef35793c76p-33;
+  constexpr static double exp_lo  = -746.0;
+  constexpr static double exp_hi  = 710.0;
+  constexpr static double subnorm = 0x1p54;
+  constexpr static int subnorm_e  = 54;
+
+  constexpr static double exp[] = {1.0,
+                                   1.0,
+                                   1.0 / 2,
+                                   1.0 / 6,
+                                   1.0 / 24,
+                                   1.0 / 120,
+                                   1.0 / 720,
+                                   1.0 / 5040,
+                                   1.0 / 40320,
+                                   1.0 / 362880,
+                                   1.0 / 3628800,
+                                   1.0 / 39916800,
+                                   1.0 / 479001600,
+                                   1.0 / 6227020800};
+
+  constexpr static double log[] = {2.0 / 3,
+                                   2.0 / 5,
+                                   2.0 / 7,
+                                   2.0 / 9,
+                                   2.0 / 11,
+                                   2.0 / 13,
+                                   2.0 / 15,
+                                   2.0 / 17,
+                                   2.0 / 19,
+                                   2.0 / 21,
+                                   2.0 / 23};
+
+  constexpr static double tanh[] = {-1.0 / 3,
+                                    2.0 / 15,
+                                    -17.0 / 315,
+                                    62.0 / 2835,
+                                    -1382.0 / 155925,
+                                    21844.0 / 6081075,
+                                    -929569.0 / 638512875,
+                                    6404582.0 / 10854718875,
+                                    -443861162.0 / 1856156927625,
+                                    18888466084.0 / 194896477400625};
+};
+
+template <typename _Tp>
+constexpr void CheckMathValue() {
+  static_assert(std::is_arithmetic_v<_Tp> || Types::is_float16_v<_Tp>,
+                "Error: element-wise functions need arithmetic or 16-bit "
+                "floating-point values.");
+}
+
+/// Bytes of the packs `Apply()` processes per step: one native register, so
+/// the packs are passed in registers.
+#if defined(__AVX512F__)
+constexpr inline std::size_t math_pack_bytes = 64;
+#elif defined(__AVX__)
+constexpr inline std::size_t math_pack_bytes = 32;
+#else
+constexpr inline std::size_t math_pack_bytes = 16;
+#endif
+
+#include "MathLanes.tpp"
+
+}  // namespace Impl
+
+#if SGLTY_HAS_MULTIVERSIONING
+SGLTY_PUSH_TARGET(SGLTY_ISA_AVX2)
+namespace Impl::Avx2 {
+
+constexpr inline std::size_t math_pack_bytes = 32;
+
+#include "MathLanes.tpp"
+
+}  // namespace Impl::Avx2
+SGLTY_POP_TARGET()
+
+SGLTY_PUSH_TARGET(SGLTY_ISA_AVX512)
+namespace Impl::Avx512 {
+
+constexpr inline std::size_t math_pack_bytes = 64;
+
+#include "MathLanes.tpp"
+
+}  // namespace Impl::Avx512
+SGLTY_POP_TARGET()
+#else
+namespace Impl {
+
+// Only the baseline kernels exist.
+namespace Avx2   = Impl;
+namespace Avx512 = Impl;
+
+}  // namespace Impl
+#endif
+
+template <typename _Tp>
+constexpr auto Exp::operator()(_Tp _x) const {
+  Impl::CheckMathValue<_Tp>();
+  using compute = Impl::MathCompute<_Tp>;
+  if constexpr (Impl::is_math_lane_v<compute>) {
+    return Impl::ExpLanes(compute(_x));
+  } else {
+    return std::exp(compute(_x));
+  }
+}
+
+template <typename _Tp>
+void Exp::Apply(const _Tp* _src, _Tp* _dst, std::size_t _n) {
+  static const auto apply = Impl::IsaSelect(&Impl::ExpApply<_Tp>,
+                                            &Impl::Avx2::ExpApply<_Tp>,
+                                            &Impl::Avx512::ExpApply<_Tp>);
+  apply(_src, _dst, _n);
+}
+
+template <typename _Tp>
+constexpr auto Log::operator()(_Tp _x) const {
+  Impl::CheckMathValue<_Tp>();
+  using compute = Impl::MathCompute<_Tp>;
+  if constexpr (Impl::is_math_lane_v<compute>) {
+    return Impl::LogLanes(compute(_x));
+  } else {
+    return std::log(compute(_x));
+  }
+}
+
+template <typename _Tp>
+void Log::Apply(const _Tp* _src, _Tp* _dst, std::size_t _n) {
+  static const auto apply = Impl::IsaSelect(&Impl::LogApply<_Tp>,
+                                            &Impl::Avx2::LogApply<_Tp>,
+                                            &Impl::Avx512::LogApply<_Tp>);
+  apply(_src, _dst, _n);
+}
+
+template <typename _Tp>
+constexpr auto Tanh::operator()(_Tp _x) const {
+  Impl::CheckMathValue<_Tp>();
+  using compute = Impl::MathCompute<_Tp>;
+  if constexpr (Impl::is_math_lane_v<compute>) {
+    return Impl::TanhLanes(compute(_x));
+  } else {
+    return std::tanh(compute(_x));
+  }
+}
+
+template <typename _Tp>
+void Tanh::Apply(const _Tp* _src, _Tp* _dst, std::size_t _n) {
+  static const auto apply = Impl::IsaSelect(&Impl::TanhApply<_Tp>,
+                                            &Impl::Avx2::TanhApply<_Tp>,
+                                            &Impl::Avx512::TanhApply<_Tp>);
+  apply(_src, _dst, _n);
+}
+
+template <typename _Tp>
+constexpr auto Sqrt::operator()(_Tp _x) const {
+  Impl::CheckMathValue<_Tp>();
+  return std::sqrt(Impl::MathCompute<_Tp>(_x));
+}
+
+template <typename _Tp>
+void Sqrt::Apply(const _Tp* _src, _Tp* _dst, std::size_t _n) {
+  static const auto apply = Impl::IsaSelect(&Impl::SqrtApply<_Tp>,
+                                            &Impl::Avx2::SqrtApply<_Tp>,
+                                            &Impl::Avx512::SqrtApply<_Tp>);
+  apply(_src, _dst, _n);
+}
+
+template <typename _Tp>
+constexpr auto Abs::operator()(_Tp _x) const {
+  Impl::CheckMathValue<_Tp>();
+  if constexpr (std::is_integral_v<_Tp>) {
+    return _x < 0 ? -_x : _x;
+  } else {
+    using compute = Impl::MathCompute<_Tp>;
+    if constexpr (Impl::is_math_lane_v<compute>) {
+      return Impl::AbsLanes(compute(_x));
+    } else {
+      return std::fabs(compute(_x));
+    }
+  }
+}
+
+template <typename _Tp>
+void Abs::Apply(const _Tp* _src, _Tp* _dst, std::size_t _n) {
+  static const auto apply = Impl::IsaSelect(&Impl::AbsApply<_Tp>,
+                                            &Impl::Avx2::AbsApply<_Tp>,
+                                            &Impl::Avx512::AbsApply<_Tp>);
+  apply(_src, _dst, _n);
+}
+
+template <typename _Tp, typename _Up>
+constexpr auto Pow::operator()(_Tp _x, _Up _y) const {
+  Impl::CheckMathValue<_Tp>();
+  using compute = Impl::MathCompute<_Tp>;
+  if constexpr (Impl::is_math_lane_v<compute>) {
+    return Impl::PowNarrow(compute(_x), compute(_y));
+  } else {
+    return std::pow(compute(_x), compute(_y));
+  }
+}
+
+template <typename _Tp, typename _Up>
+void Pow::Apply(const _Tp* _src, _Tp* _dst, std::size_t _n, _Up _y) {
+  static const auto apply = Impl::IsaSelect(&Impl::PowApply<_Tp>,
+                                            &Impl::Avx2::PowApply<_Tp>,
+                                            &Impl::Avx512::PowApply<_Tp>);
+  apply(_src, _dst, _n, static_cast<_Tp>(_y));
+}
+
+}  // namespace Sglty::Kernel
+
+// Singularity/Kernel/Impl/Math.tpp
@@ -0,0 +1,443 @@
+// Lane-wise kernels of `Math.tpp`. Included once per instruction-set variant,
+// each time into its own namespace with its own `math_pack_bytes` and
+// `target` options, so there is no include guard.
+
+template <typename _V>
+constexpr _V Splat(MathLane<_V> _s) {
+  return _V{} + _s;
+}
+
+// `_m ? _a : _b` is lane-wise for vectors.
+template <typename _M, typename _V>
+constexpr _V Select(_M _m, _V _a, _V _b) {
+  return _m ? _a : _b;
+}
+
+// Vectors are reinterpreted with a cast, so no function outside the variant
+// takes or returns them (`-Wpsabi`).
+template <typename _V>
+constexpr MathBits<_V> ToBits(_V _v) {
+  if constexpr (std::is_arithmetic_v<_V>) {
+    return Types::Impl::BitCast<MathBits<_V>>(_v);
+  } else {
+    return (MathBits<_V>)_v;
+  }
+}
+
+template <typename _V>
+constexpr _V FromBits(MathBits<_V> _b) {
+  if constexpr (std::is_arithmetic_v<_V>) {
+    return Types::Impl::BitCast<_V>(_b);
+  } else {
+    return (_V)_b;
+  }
+}
+
+// Value conversion lane by lane.
+template <typename _To, typename _From>
+constexpr _To LaneCast(_From _v) {
+#if SGLTY_HAS_VECTOR_EXTENSIONS
+  if constexpr (!std::is_arithmetic_v<_From>) {
+    return __builtin_convertvector(_v, _To);
+  } else {
+    return static_cast<_To>(_v);
+  }
+#else
+  return static_cast<_To>(_v);
+#endif
+}
+
+template <typename _V, typename _Tp, std::size_t _n, std::size_t... _k>
+constexpr _V Horner(_V _x,
+                    const _Tp (&_c)[_n],
+                    std::index_sequence<_k...>) {
+  _V ret = Splat<_V>(_c[_n - 1]);
+  ((ret = ret * _x + _c[_n - 2 - _k]), ...);
+  return ret;
+}
+
+// Evaluates the polynomial with coefficients `_c` (constant term first),
+// unrolled so the coefficients stay in registers at `-O2`.
+template <typename _V, typename _Tp, std::size_t _n>
+constexpr _V Horner(_V _x, const _Tp (&_c)[_n]) {
+  return Horner(_x, _c, std::make_index_sequence<_n - 1>{});
+}
+
+template <typename _V>
+constexpr _V AbsLanes(_V _x) {
+  using int_lane = typename MathLanes<_V>::int_lane;
+  return FromBits<_V>(ToBits(_x) & std::numeric_limits<int_lane>::max());
+}
+
+// `_lo` is a correction added to `_x` during the argument reduction, for
+// callers that carry `_x` to more than the lane precision.
+template <typename _V>
+constexpr _V ExpLanes(_V _x, _V _lo = _V{}) {
+  using lane   = MathLane<_V>;
+  using consts = MathConsts<lane>;
+
+  // 1.5 * 2^mant: adding it rounds to an integer kept in the low mantissa
+  // bits of the sum.
+  constexpr lane shift = lane(3) * lane(1ull << (consts::mant - 1));
+  constexpr lane log2e = lane(1.44269504088896340736);
+
+  // Beyond [exp_lo, exp_hi] the result is 0 or infinity either way.
+  _V x = Select(_x > consts::exp_hi, Splat<_V>(consts::exp_hi), _x);
+  x    = Select(x < consts::exp_lo, Splat<_V>(consts::exp_lo), x);
+
+  // x = k ln2 + r
+  const _V t = x * log2e + shift;
+  const _V k = t - shift;
+  const _V r = ((x - k * consts::ln2_hi) + _lo) - k * consts::ln2_lo;
+  const _V p = Horner(r, consts::exp);
+
+  // 2^k as two normal factors, so results near the ends of the range
+  // overflow or underflow (gradually) in the final products.
+  const MathBits<_V> n  = ToBits(t) - ToBits(Splat<_V>(shift));
+  const MathBits<_V> n1 = n >> 1;
+  const MathBits<_V> n2 = n - n1;
+  const _V ret = p * FromBits<_V>((n1 + consts::bias) << consts::mant) *
+                 FromBits<_V>((n2 + consts::bias) << consts::mant);
+  return Select(_x != _x, _x, ret);
+}
+
+template <typename _V>
+constexpr _V LogLanes(_V _x) {
+  using lane   = MathLane<_V>;
+  using bits   = MathBits<_V>;
+  using consts = MathConsts<lane>;
+
+  constexpr lane sqrt2 = lane(1.41421356237309504880);
+  constexpr lane inf   = std::numeric_limits<lane>::infinity();
+  constexpr lane nan   = std::numeric_limits<lane>::quiet_NaN();
+  constexpr auto one   = ToBits(lane(1));
+  constexpr auto man   = (decltype(one)(1) << consts::mant) - 1;
+
+  // Subnormals are scaled into the normal range first.
+  const auto sub = _x < std::numeric_limits<lane>::min();
+  const _V x     = Select(sub, _x * consts::subnorm, _x);
+
+  // x = 2^e m with m in [sqrt(2)/2, sqrt(2)).
+  const bits u   = ToBits(x);
+  const bits raw = (u >> consts::mant) - consts::bias;
+  bits e         = Select(sub, raw - consts::subnorm_e, raw);
+  _V m           = FromBits<_V>((u & man) | one);
+  const auto big = m > sqrt2;
+  m              = Select(big, m * lane(0.5), m);
+  e              = Select(big, e + 1, e);
+
+  const _V f  = m - lane(1);
+  const _V s  = f / (f + lane(2));
+  const _V z  = s * s;
+  const _V R  = z * Horner(z, consts::log);
+  const _V l  = f - s * (f - R);
+  const _V ef = LaneCast<_V>(e);
+
+  _V ret = ef * consts::ln2_hi + (l + ef * consts::ln2_lo);
+  ret    = Select(_x == inf, Splat<_V>(inf), ret);
+  ret    = Select(_x == lane(0), Splat<_V>(-inf), ret);
+  ret    = Select(_x < lane(0), Splat<_V>(nan), ret);
+  return Select(_x != _x, _x, ret);
+}
+
+template <typename _V>
+constexpr _V TanhLanes(_V _x) {
+  using lane = MathLane<_V>;
+
+  const _V a     = AbsLanes(_x);
+  const _V z     = a * a;
+  const _V small = a + a * z * Horner(z, MathConsts<lane>::tanh);
+  const _V t     = ExpLanes(a * lane(-2));
+  const _V large = (lane(1) - t) / (lane(1) + t);
+  const _V ret   = Select(a < lane(0.25), small, large);
+
+  // tanh is odd: put the sign of `_x` back.
+  return FromBits<_V>(ToBits(ret) | (ToBits(_x) ^ ToBits(a)));
+}
+
+// An unevaluated sum `hi + lo` with `|lo|` at most half an ulp of `hi`:
+// about twice the precision of one lane.
+template <typename _V>
+struct MathPair {
+  _V hi;
+  _V lo;
+};
+
+// `_a + _b` exactly (Knuth's two-sum).
+template <typename _V>
+constexpr MathPair<_V> TwoSum(_V _a, _V _b) {
+  const _V s = _a + _b;
+  const _V v = s - _a;
+  return {s, (_a - (s - v)) + (_b - v)};
+}
+
+// `_a` as a high half of `mant / 2` bits, cut from its representation, and
+// the exact remainder. Unlike Veltkamp's split this does not multiply, so
+// contraction into FMAs cannot change it and it holds over the whole range.
+template <typename _V>
+constexpr MathPair<_V> Split(_V _a) {
+  using lane     = MathLane<_V>;
+  using int_lane = typename MathLanes<_V>::int_lane;
+
+  constexpr int bits  = (MathConsts<lane>::mant + 2) / 2;
+  constexpr int_lane cut = (int_lane(1) << bits) - 1;
+
+  const _V hi = FromBits<_V>(ToBits(_a) & ~cut);
+  return {hi, _a - hi};
+}
+
+// `_a * _b` as a pair (Dekker's two-product). Every partial product but the
+// last is exact, which leaves a relative error of about 2^-106 for `double`.
+template <typename _V>
+constexpr MathPair<_V> TwoProd(_V _a, _V _b) {
+  const _V p           = _a * _b;
+  const MathPair<_V> a = Split(_a);
+  const MathPair<_V> b = Split(_b);
+  return {p, ((a.hi * b.hi - p) + a.hi * b.lo + a.lo * b.hi) + a.lo * b.lo};
+}
+
+// `_a * _b` to about twice the lane precision. Once the product overflows
+// only its high part is kept.
+template <typename _V>
+constexpr MathPair<_V> MulPair(MathPair<_V> _a, MathPair<_V> _b) {
+  using lane = MathLane<_V>;
+
+  constexpr lane inf = std::numeric_limits<lane>::infinity();
+
+  const MathPair<_V> p = TwoProd(_a.hi, _b.hi);
+  const _V lo = Select(AbsLanes(p.hi) < inf,
+                       p.lo + (_a.hi * _b.lo + _a.lo * _b.hi),
+                       Splat<_V>(0));
+
+  // A zero `lo` leaves `hi` alone, which keeps the sign of a zero product.
+  const _V hi = p.hi + lo;
+  return {Select(lo == lane(0), p.hi, hi), lo - (hi - p.hi)};
+}
+
+// Natural logarithm of a finite positive `_x` to about twice the lane
+// precision: the reduction of `LogLanes()`, with `s = f / (2 + f)` carried
+// as a pair and log(1 + f) = 2s + s R(s^2).
+template <typename _V>
+constexpr MathPair<_V> LogPair(_V _x) {
+  using lane   = MathLane<_V>;
+  using bits   = MathBits<_V>;
+  using consts = MathConsts<lane>;
+
+  constexpr lane sqrt2 = lane(1.41421356237309504880);
+  constexpr auto one   = ToBits(lane(1));
+  constexpr auto man   = (decltype(one)(1) << consts::mant) - 1;
+
+  const auto sub = _x < std::numeric_limits<lane>::min();
+  const _V x     = Select(sub, _x * consts::subnorm, _x);
+
+  const bits u   = ToBits(x);
+  const bits raw = (u >> consts::mant) - consts::bias;
+  bits e         = Select(sub, raw - consts::subnorm_e, raw);
+  _V m           = FromBits<_V>((u & man) | one);
+  const auto big = m > sqrt2;
+  m              = Select(big, m * lane(0.5), m);
+  e              = Select(big, e + 1, e);
+
+  // f is exact; s_lo is the rounding error of s = f / (2 + f).
+  const _V f             = m - lane(1);
+  const MathPair<_V> t   = TwoSum(Splat<_V>(lane(2)), f);
+  const _V s             = f / t.hi;
+  const MathPair<_V> st  = TwoProd(s, t.hi);
+  const _V s_lo          = (((f - st.hi) - st.lo) - s * t.lo) / t.hi;
+  const _V z             = s * s;
+  const _V tail          = s * (z * Horner(z, consts::log));
+  const MathPair<_V> l   = TwoSum(s * lane(2), s_lo * lane(2) + tail);
+  const _V ef            = LaneCast<_V>(e);
+  const MathPair<_V> ret = TwoSum(ef * consts::ln2_hi, l.hi);
+  return TwoSum(ret.hi, ret.lo + (l.lo + ef * consts::ln2_lo));
+}
+
+// `_x^_n` for a small integer `_n`: repeated squaring to about twice the
+// lane precision, through the reciprocal for negative `_n`, so results that
+// are representable (`(-2)^3`) come out exact and the rest correctly
+// rounded but for rare halfway cases.
+template <typename _V>
+constexpr _V PowInt(_V _x, int _n) {
+  using lane = MathLane<_V>;
+
+  MathPair<_V> b{_x, Splat<_V>(0)};
+  if (_n < 0) {
+    // 1 / x with its rounding error; not needed where it is not finite.
+    const _V r           = lane(1) / _x;
+    const MathPair<_V> t = TwoProd(_x, r);
+    const _V e           = (lane(1) - t.hi) - t.lo;
+    b = {r, Select(e == e, e * r, Splat<_V>(0))};
+    _n = -_n;
+  }
+
+  MathPair<_V> ret{Splat<_V>(lane(1)), Splat<_V>(0)};
+  for (; _n != 0; _n >>= 1) {
+    if (_n & 1) {
+      ret = MulPair(ret, b);
+    }
+    if (_n > 1) {
+      b = MulPair(b, b);
+    }
+  }
+  return ret.hi;
+}
+
+// Largest `|y|` taking the `PowInt()` path.
+constexpr inline int pow_int_max = 16;
+
+// `_x^_y` as exp(y log|x|) with the logarithm and the product carried as
+// pairs, so the rounding of `y log|x|` does not show in the result. The
+// special cases follow `std::pow`.
+template <typename _V>
+constexpr _V PowLanes(_V _x, _V _y) {
+  using lane = MathLane<_V>;
+
+  constexpr lane shift   = lane(1ull << MathConsts<lane>::mant);
+  constexpr lane all_odd = shift * lane(2);
+  constexpr lane inf     = std::numeric_limits<lane>::infinity();
+  constexpr lane nan     = std::numeric_limits<lane>::quiet_NaN();
+
+  const _V ax = AbsLanes(_x);
+  const _V ay = AbsLanes(_y);
+
+  // The correction only matters while exp(y log|x|) is in range, and is
+  // not finite once the product overflows.
+  const MathPair<_V> l = LogPair(ax);
+  const MathPair<_V> p = TwoProd(_y, l.hi);
+  const _V lo =
+      Select(AbsLanes(p.hi) < lane(1024), p.lo + _y * l.lo, Splat<_V>(0));
+  _V ret = ExpLanes(p.hi, lo);
+
+  // Zero and infinite operands: 0 or infinity by whether the result grows.
+  const _V edge = Select((ax > lane(1)) == (_y > lane(0)),
+                         Splat<_V>(inf),
+                         Splat<_V>(lane(0)));
+  ret = Select((ax == lane(0)) | (ax == inf) | (ay == inf), edge, ret);
+
+  // Above `shift` every value is an integer, above `all_odd` an even one.
+  const _V half     = ay * lane(0.5);
+  const auto whole  = (ay >= shift) | (((ay + shift) - shift) == ay);
+  const auto halved = (half >= shift) | (((half + shift) - shift) == half);
+  const auto odd    = (ay < all_odd) & whole & (halved == 0);
+
+  ret = Select(odd & (ToBits(_x) < 0), -ret, ret);
+  ret = Select((whole == 0) & (_x < lane(0)) & (_x > -inf),
+               Splat<_V>(nan),
+               ret);
+  ret = Select((_x != _x) | (_y != _y), _x + _y, ret);
+  return Select((_y == lane(0)) | (_x == lane(1)) |
+                    ((ax == lane(1)) & (ay == inf)),
+                Splat<_V>(lane(1)),
+                ret);
+}
+
+// `float` powers are evaluated in `double`; small integer exponents take
+// `PowInt()`.
+template <typename _V>
+constexpr _V PowNarrow(_V _x, MathLane<_V> _y) {
+  using lane = MathLane<_V>;
+
+  if constexpr (sizeof(lane) == 4) {
+    using wide = typename MathLanes<_V>::wide;
+    return LaneCast<_V>(PowNarrow(LaneCast<wide>(_x), double(_y)));
+  } else {
+    if (_y >= -pow_int_max && _y <= pow_int_max && _y == lane(int(_y))) {
+      return _y == lane(0) ? Splat<_V>(lane(1)) : PowInt(_x, int(_y));
+    }
+    return PowLanes(_x, Splat<_V>(_y));
+  }
+}
+
+// Runs `_f` over packs of `_src`, then over the remaining elements. `_half`
+// halves the packs, for functions that widen their lanes.
+template <bool _half = false, typename _Tp, typename _fn>
+void MathApply(const _Tp* _src, _Tp* _dst, std::size_t _n, _fn _f) {
+  static_assert(is_math_lane_v<_Tp>,
+                "Error: bulk element-wise functions need `float` or `double`.");
+
+  std::size_t k = 0;
+#if SGLTY_HAS_VECTOR_EXTENSIONS
+  constexpr std::size_t bytes = _half ? math_pack_bytes / 2 : math_pack_bytes;
+  using pack                  = typename MathPack<_Tp, bytes>::type;
+  constexpr std::size_t width = sizeof(pack) / sizeof(_Tp);
+  for (; k < _n / width * width; k += width) {
+    pack v;
+    std::memcpy(&v, _src + k, sizeof(v));
+    v = _f(v);
+    std::memcpy(_dst + k, &v, sizeof(v));
+  }
+#endif
+  for (; k < _n; k++) {
+    _dst[k] = _f(_src[k]);
+  }
+}
+
+template <typename _Tp>
+void ExpApply(const _Tp* _src, _Tp* _dst, std::size_t _n) {
+  MathApply(_src, _dst, _n, [](auto _v) { return ExpLanes(_v); });
+}
+
+template <typename _Tp>
+void LogApply(const _Tp* _src, _Tp* _dst, std::size_t _n) {
+  MathApply(_src, _dst, _n, [](auto _v) { return LogLanes(_v); });
+}
+
+template <typename _Tp>
+void TanhApply(const _Tp* _src, _Tp* _dst, std::size_t _n) {
+  MathApply(_src, _dst, _n, [](auto _v) { return TanhLanes(_v); });
+}
+
+template <typename _Tp>
+void AbsApply(const _Tp* _src, _Tp* _dst, std::size_t _n) {
+  MathApply(_src, _dst, _n, [](auto _v) { return AbsLanes(_v); });
+}
+
+template <typename _Tp>
+void PowApply(const _Tp* _src, _Tp* _dst, std::size_t _n, _Tp _y) {
+  MathApply<sizeof(_Tp) == 4>(
+      _src, _dst, _n, [_y](auto _v) { return PowNarrow(_v, _y); });
+}
+
+template <typename _Tp>
+void SqrtApply(const _Tp* _src, _Tp* _dst, std::size_t _n) {
+  static_assert(is_math_lane_v<_Tp>,
+                "Error: bulk element-wise functions need `float` or `double`.");
+
+  // The zero-masked AVX-512 forms avoid a `-Wmaybe-uninitialized` false
+  // positive from the unmasked ones in GCC's headers.
+  std::size_t k = 0;
+#if SGLTY_HAS_X86_KERNELS
+  if constexpr (std::is_same_v<_Tp, float> && math_pack_bytes == 64) {
+    for (; k + 16 <= _n; k += 16) {
+      const __m512 v = _mm512_loadu_ps(_src + k);
+      _mm512_storeu_ps(_dst + k, _mm512_maskz_sqrt_ps(__mmask16(-1), v));
+    }
+  } else if constexpr (std::is_same_v<_Tp, float> && math_pack_bytes == 32) {
+    for (; k + 8 <= _n; k += 8) {
+      _mm256_storeu_ps(_dst + k, _mm256_sqrt_ps(_mm256_loadu_ps(_src + k)));
+    }
+  } else if constexpr (std::is_same_v<_Tp, float>) {
+    for (; k + 4 <= _n; k += 4) {
+      _mm_storeu_ps(_dst + k, _mm_sqrt_ps(_mm_loadu_ps(_src + k)));
+    }
+  } else if constexpr (math_pack_bytes == 64) {
+    for (; k + 8 <= _n; k += 8) {
+      const __m512d v = _mm512_loadu_pd(_src + k);
+      _mm512_storeu_pd(_dst + k, _mm512_maskz_sqrt_pd(__mmask8(-1), v));
+    }
+  } else if constexpr (math_pack_bytes == 32) {
+    for (; k + 4 <= _n; k += 4) {
+      _mm256_storeu_pd(_dst + k, _mm256_sqrt_pd(_mm256_loadu_pd(_src + k)));
+    }
+  } else {
+    for (; k + 2 <= _n; k += 2) {
+      _mm_storeu_pd(_dst + k, _mm_sqrt_pd(_mm_loadu_pd(_src + k)));
+    }
+  }
+#endif
+  for (; k < _n; k++) {
+    _dst[k] = std::sqrt(_src[k]);
+  }
+}
+
+// Singularity/Kernel/Impl/MathLanes.tpp
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "../Philox.hpp"
+
+#include <array>
+#include <cstdint>
+
+namespace Sglty::Kernel {
+
+namespace Impl {
+
+constexpr std::uint32_t philox_m0 = 0xD2511F53;
+constexpr std::uint32_t philox_m1 = 0xCD9E8D57;
+constexpr std::uint32_t philox_w0 = 0x9E3779B9;
+constexpr std::uint32_t philox_w1 = 0xBB67AE85;
+
+constexpr std::array<std::uint32_t, 4> PhiloxRound(
+    const std::array<std::uint32_t, 4>& _c,
+    const std::array<std::uint32_t, 2>& _k) {
+  const std::uint64_t p0 = std::uint64_t{philox_m0} * _c[0];
+  const std::uint64_t p1 = std::uint64_t{philox_m1} * _c[2];
+  return {static_cast<std::uint32_t>(p1 >> 32) ^ _c[1] ^ _k[0],
+          static_cast<std::uint32_t>(p1),
+          static_cast<std::uint32_t>(p0 >> 32) ^ _c[3] ^ _k[1],
+          static_cast<std::uint32_t>(p0)};
+}
+
+}  // namespace Impl
+
+constexpr std::array<std::uint32_t, 4> Philox4x32(
+    std::array<std::uint32_t, 4> _counter,
+    std::array<std::uint32_t, 2> _key) {
+  for (int round = 0; round < 10; round++) {
+    if (round != 0) {
+      _key[0] += Impl::philox_w0;
+      _key[1] += Impl::philox_w1;
+    }
+    _counter = Impl::PhiloxRound(_counter, _key);
+  }
+  return _counter;
+}
+
+}  // namespace Sglty::Kernel
+
+// Singularity/Kernel/Impl/Philox.tpp
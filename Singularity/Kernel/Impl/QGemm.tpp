@@ -0,0 +1,349 @@
+#pragma once
+
+#include "../QGemm.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "../../Config.hpp"
+
+#if SGLTY_HAS_X86_KERNELS
+#include <immintrin.h>
+#endif
+
+#include "../../Instr/Trace.hpp"
+#include "../../Mem/Scratch.hpp"
+#include "../../Types/Matrix.hpp"
+#include "../Isa.hpp"
+
+namespace Sglty::Kernel {
+
+namespace Impl {
+
+/// Result columns computed per pass over a packed lhs row.
+constexpr inline std::size_t qgemm_cols = 4;
+
+/// 8-bit values consumed per vector step by the widest variant; packed rows
+/// are zero-padded to a multiple of it.
+constexpr inline std::size_t qgemm_step = 32;
+
+/**
+ * @brief Dot products of one packed lhs row with `qgemm_cols` packed rhs
+ * columns `_stride` elements apart, in the `_isa` variant; `_n` is a
+ * multiple of `qgemm_step`.
+ *
+ * The vector variants widen the 8-bit values to 16-bit lanes and sum the
+ * pairwise products into 32-bit lanes.
+ */
+template <Isa _isa>
+struct QDot {
+  template <typename _a, typename _b>
+  static void Run(const _a* _x,
+                  const _b* _y,
+                  std::size_t _stride,
+                  std::size_t _n,
+                  std::int32_t* _out) {
+    for (std::size_t c = 0; c < qgemm_cols; c++) {
+      const _b* y      = _y + c * _stride;
+      std::int32_t sum = 0;
+      for (std::size_t k = 0; k < _n; k++) {
+        sum += std::int32_t(_x[k]) * std::int32_t(y[k]);
+      }
+      _out[c] = sum;
+    }
+  }
+};
+
+#if SGLTY_HAS_X86_KERNELS && (defined(__AVX2__) || SGLTY_HAS_MULTIVERSIONING)
+template <>
+struct QDot<Isa::Avx2> {
+  template <typename _Tp>
+  SGLTY_TARGET(SGLTY_ISA_AVX2)
+  static __m256i Load(const _Tp* _p) {
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_p));
+    if constexpr (std::is_signed_v<_Tp>) {
+      return _mm256_cvtepi8_epi16(v);
+    } else {
+      return _mm256_cvtepu8_epi16(v);
+    }
+  }
+
+  SGLTY_TARGET(SGLTY_ISA_AVX2)
+  static __m256i MulAdd(__m256i _acc, __m256i _a, __m256i _b) {
+    return _mm256_add_epi32(_acc, _mm256_madd_epi16(_a, _b));
+  }
+
+  SGLTY_TARGET(SGLTY_ISA_AVX2)
+  static std::int32_t Sum(__m128i _v) {
+    _v = _mm_add_epi32(_v, _mm_shuffle_epi32(_v, _MM_SHUFFLE(1, 0, 3, 2)));
+    _v = _mm_add_epi32(_v, _mm_shuffle_epi32(_v, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtsi128_si32(_v);
+  }
+
+  SGLTY_TARGET(SGLTY_ISA_AVX2)
+  static std::int32_t Sum(__m256i _v) {
+    return Sum(_mm_add_epi32(_mm256_castsi256_si128(_v),
+                             _mm256_extracti128_si256(_v, 1)));
+  }
+
+  template <typename _a, typename _b>
+  SGLTY_TARGET(SGLTY_ISA_AVX2)
+  static void Run(const _a* _x,
+                  const _b* _y,
+                  std::size_t _stride,
+                  std::size_t _n,
+                  std::int32_t* _out) {
+    static_assert(qgemm_cols == 4, "Error: kernel computes four columns.");
+
+    __m256i acc0 = _mm256_setzero_si256();
+    __m256i acc1 = acc0, acc2 = acc0, acc3 = acc0;
+    for (std::size_t k = 0; k < _n; k += 16) {
+      const __m256i x = Load(_x + k);
+      acc0            = MulAdd(acc0, x, Load(_y + k));
+      acc1            = MulAdd(acc1, x, Load(_y + _stride + k));
+      acc2            = MulAdd(acc2, x, Load(_y + 2 * _stride + k));
+      acc3            = MulAdd(acc3, x, Load(_y + 3 * _stride + k));
+    }
+    _out[0] = Sum(acc0);
+    _out[1] = Sum(acc1);
+    _out[2] = Sum(acc2);
+    _out[3] = Sum(acc3);
+  }
+};
+#endif
+
+#if SGLTY_HAS_X86_KERNELS && \
+    (defined(__AVX512BW__) || SGLTY_HAS_MULTIVERSIONING)
+template <>
+struct QDot<Isa::Avx512> {
+  template <typename _Tp>
+  SGLTY_TARGET(SGLTY_ISA_AVX512)
+  static __m512i Load(const _Tp* _p) {
+    const __m256i v =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_p));
+    if constexpr (std::is_signed_v<_Tp>) {
+      return _mm512_cvtepi8_epi16(v);
+    } else {
+      return _mm512_cvtepu8_epi16(v);
+    }
+  }
+
+  SGLTY_TARGET(SGLTY_ISA_AVX512)
+  static __m512i MulAdd(__m512i _acc, __m512i _a, __m512i _b) {
+#if defined(__AVX512VNNI__)
+    return _mm512_dpwssd_epi32(_acc, _a, _b);
+#else
+    return _mm512_add_epi32(_acc, _mm512_madd_epi16(_a, _b));
+#endif
+  }
+
+  // Masked extracts: GCC 12 warns about the unset passthrough operand of
+  // `_mm512_reduce_add_epi32()` and `_mm512_castsi512_si256()`.
+  SGLTY_TARGET(SGLTY_ISA_AVX512)
+  static std::int32_t Sum(__m512i _v) {
+    const __m256i lo = _mm512_maskz_extracti64x4_epi64(__mmask8(-1), _v, 0);
+    const __m256i hi = _mm512_maskz_extracti64x4_epi64(__mmask8(-1), _v, 1);
+    return QDot<Isa::Avx2>::Sum(_mm256_add_epi32(lo, hi));
+  }
+
+  template <typename _a, typename _b>
+  SGLTY_TARGET(SGLTY_ISA_AVX512)
+  static void Run(const _a* _x,
+                  const _b* _y,
+                  std::size_t _stride,
+                  std::size_t _n,
+                  std::int32_t* _out) {
+    static_assert(qgemm_cols == 4, "Error: kernel computes four columns.");
+
+    __m512i acc0 = _mm512_setzero_si512();
+    __m512i acc1 = acc0, acc2 = acc0, acc3 = acc0;
+    for (std::size_t k = 0; k < _n; k += 32) {
+      const __m512i x = Load(_x + k);
+      acc0            = MulAdd(acc0, x, Load(_y + k));
+      acc1            = MulAdd(acc1, x, Load(_y + _stride + k));
+      acc2            = MulAdd(acc2, x, Load(_y + 2 * _stride + k));
+      acc3            = MulAdd(acc3, x, Load(_y + 3 * _stride + k));
+    }
+    _out[0] = Sum(acc0);
+    _out[1] = Sum(acc1);
+    _out[2] = Sum(acc2);
+    _out[3] = Sum(acc3);
+  }
+};
+#endif
+
+/// `QDot` specialization the `_isa` variant of `QGemm()` uses: at least the
+/// one the build flags enable.
+template <Isa _isa>
+constexpr Isa QLevel() {
+#if defined(__AVX512BW__)
+  return Isa::Avx512;
+#elif defined(__AVX2__)
+  return _isa < Isa::Avx2 ? Isa::Avx2 : _isa;
+#else
+  return _isa;
+#endif
+}
+
+/**
+ * @brief Packs both operands and passes every raw accumulator, together with
+ * the sums of its lhs row and rhs column, to `_store(i, j, acc, row, col)`.
+ */
+template <typename _lhs, typename _rhs, typename _store>
+void QGemm(const _lhs& _l, const _rhs& _r, _store&& _st) {
+  using lhs_value = std::decay_t<decltype(_l(0, 0))>;
+  using rhs_value = std::decay_t<decltype(_r(0, 0))>;
+
+  static_assert(is_quantized_v<lhs_value> && is_quantized_v<rhs_value>,
+                "Error: `QGemm()` requires 8-bit integer operands.");
+
+  constexpr std::size_t rows  = _lhs::rows;
+  constexpr std::size_t inner = _lhs::cols;
+  constexpr std::size_t cols  = _rhs::cols;
+
+  static_assert(inner * 255 * 255 <= std::numeric_limits<std::int32_t>::max(),
+                "Error: inner dimension too large for int32 accumulation.");
+
+  // Zero padding to whole vector steps and column groups leaves the dot
+  // products unchanged.
+  constexpr std::size_t depth =
+      (inner + qgemm_step - 1) / qgemm_step * qgemm_step;
+  constexpr std::size_t groups = (cols + qgemm_cols - 1) / qgemm_cols;
+
+  SGLTY_TRACE_KERNEL("QGemm",
+                     rows,
+                     cols,
+                     (rows * inner * sizeof(lhs_value) +
+                      inner * cols * sizeof(rhs_value) +
+                      rows * cols * sizeof(std::int32_t)));
+
+  // rhs packed column by column: column j is contiguous along k.
+  Mem::Scratch scratch(
+      Mem::Scratch::Bytes<rhs_value>(groups * qgemm_cols * depth) +
+      Mem::Scratch::Bytes<std::int32_t>(cols) +
+      Mem::Scratch::Bytes<lhs_value>(depth));
+  Mem::ScratchArray<rhs_value> b(scratch, groups * qgemm_cols * depth);
+  Mem::ScratchArray<std::int32_t> col_sum(scratch, cols);
+  for (std::size_t k = 0; k < inner; k++) {
+    for (std::size_t j = 0; j < cols; j++) {
+      const rhs_value v = _r(k, j);
+      b[j * depth + k]  = v;
+      col_sum[j] += v;
+    }
+  }
+
+  Mem::ScratchArray<lhs_value> a(scratch, depth);
+  std::array<std::int32_t, qgemm_cols> acc{};
+
+  IsaDispatch([&](auto _isa) {
+    for (std::size_t i = 0; i < rows; i++) {
+      std::int32_t row_sum = 0;
+      for (std::size_t k = 0; k < inner; k++) {
+        a[k] = _l(i, k);
+        row_sum += a[k];
+      }
+
+      for (std::size_t g = 0; g < groups; g++) {
+        const std::size_t j0 = g * qgemm_cols;
+        QDot<QLevel<decltype(_isa)::value>()>::Run(
+            a.data(), b.data() + j0 * depth, depth, depth, acc.data());
+
+        const std::size_t n = cols - j0 < qgemm_cols ? cols - j0 : qgemm_cols;
+        for (std::size_t c = 0; c < n; c++) {
+          _st(i, j0 + c, acc[c], row_sum, col_sum[j0 + c]);
+        }
+      }
+    }
+  });
+}
+
+/// `std::round()` of a requantized value, without `<cmath>`: halfway cases
+/// away from zero. Magnitudes from 2^52 up are already integral.
+inline double QRound(double _v) {
+  constexpr double integral = 4503599627370496.0;
+  if (!(_v > -integral && _v < integral)) {
+    return _v;
+  }
+  const double t = double(static_cast<std::int64_t>(_v));
+  const double r = _v - t;
+  return r >= 0.5 ? t + 1 : r <= -0.5 ? t - 1 : t;
+}
+
+/// Rounds and saturates a requantized value to `_Tp`.
+template <typename _Tp>
+_Tp QStore(double _v) {
+  if constexpr (std::is_integral_v<_Tp>) {
+    constexpr double lo = double(std::numeric_limits<_Tp>::lowest());
+    constexpr double hi = double(std::numeric_limits<_Tp>::max());
+    const double r      = QRound(_v);
+    return static_cast<_Tp>(r < lo ? lo : hi < r ? hi : r);
+  } else {
+    return static_cast<_Tp>(_v);
+  }
+}
+
+}  // namespace Impl
+
+template <typename _core_impl, typename _lhs, typename _rhs>
+void QGemm(Types::Matrix<_core_impl>& _dst, const _lhs& _l, const _rhs& _r) {
+  using value_type = typename Types::Matrix<_core_impl>::value_type;
+
+  Impl::QGemm(_l,
+              _r,
+              [&](std::size_t i,
+                  std::size_t j,
+                  std::int32_t acc,
+                  std::int32_t,
+                  std::int32_t) { _dst(i, j) = static_cast<value_type>(acc); });
+}
+
+template <typename _core_impl,
+          typename _lhs,
+          typename _rhs,
+          QAxis _axis,
+          std::size_t _count>
+void QGemm(Types::Matrix<_core_impl>& _dst,
+           const _lhs& _l,
+           const _rhs& _r,
+           const QParams<_axis, _count>& _params) {
+  using value_type = typename Types::Matrix<_core_impl>::value_type;
+
+  static_assert(_axis != QAxis::Tensor || _count == 1,
+                "Error: a per-tensor scale needs exactly one value.");
+  static_assert(_axis != QAxis::Row || _count == _lhs::rows,
+                "Error: per-row scales need one value per result row.");
+  static_assert(_axis != QAxis::Col || _count == _rhs::cols,
+                "Error: per-column scales need one value per result column.");
+
+  // sum (a - za)(b - zb) = sum ab - zb sum a - za sum b + k za zb
+  const std::int64_t lz   = _params.lhs_zero;
+  const std::int64_t rz   = _params.rhs_zero;
+  const std::int64_t bias = std::int64_t(_lhs::cols) * lz * rz;
+
+  Impl::QGemm(_l,
+              _r,
+              [&](std::size_t i,
+                  std::size_t j,
+                  std::int32_t acc,
+                  std::int32_t row_sum,
+                  std::int32_t col_sum) {
+                const std::int64_t v = acc - rz * row_sum - lz * col_sum + bias;
+
+                float scale = _params.scale[0];
+                if constexpr (_axis == QAxis::Row) {
+                  scale = _params.scale[i];
+                } else if constexpr (_axis == QAxis::Col) {
+                  scale = _params.scale[j];
+                }
+
+                _dst(i, j) = Impl::QStore<value_type>(
+                    double(v) * double(scale) + double(_params.out_zero));
+              });
+}
+
+}  // namespace Sglty::Kernel
+
+// Singularity/Kernel/Impl/QGemm.tpp
@@ -0,0 +1,288 @@
+#pragma once
+
+#include "../Route.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+#include "../../Instr/Trace.hpp"
+#include "../../Traits/Core.hpp"
+#include "../../Types/Matrix.hpp"
+#include "../Compare.hpp"
+
+namespace Sglty::Kernel {
+
+#if defined(SGLTY_ENABLE_CBLAS)
+const Backend& CblasBackend();
+#endif
+
+inline std::size_t Backend::MinWork() const {
+  return backend_min_work;
+}
+
+namespace Impl {
+
+// The backend chosen with `SelectBackend()`.
+inline std::atomic<const Backend*>& Selected() {
+#if defined(SGLTY_ENABLE_CBLAS)
+  static std::atomic<const Backend*> selected{&CblasBackend()};
+#else
+  static std::atomic<const Backend*> selected{nullptr};
+#endif
+  return selected;
+}
+
+// The calling thread's `BackendScope` state.
+struct ForcedBackend {
+  bool forced            = false;
+  const Backend* backend = nullptr;
+};
+
+inline ForcedBackend& Forced() {
+  thread_local ForcedBackend forced;
+  return forced;
+}
+
+// The backend a product of `_work` multiply-adds goes to, or `nullptr`.
+inline const Backend* RouteProduct(std::size_t _work) {
+  const ForcedBackend& f = Forced();
+  if (f.forced) {
+    return f.backend;
+  }
+  const Backend* b = SelectedBackend();
+  return b != nullptr && _work >= b->MinWork() ? b : nullptr;
+}
+
+// A product operand a backend can read in place: a matrix with contiguous
+// (possibly padded) lines, or `Trp` of one.
+template <typename _expr>
+struct BackendOperand : std::false_type {};
+
+template <typename _core_impl>
+struct BackendOperand<Types::Matrix<_core_impl>>
+    : std::bool_constant<Traits::Core::is_inner_contiguous_v<_core_impl>> {
+  using matrix_type = Types::Matrix<_core_impl>;
+  using value_type  = typename matrix_type::value_type;
+
+  constexpr static bool transposed = false;
+
+  // Distance between consecutive elements of a vector.
+  constexpr static std::size_t inc =
+      matrix_type::rows == 1 ? Traits::Core::col_stride_v<_core_impl>
+                             : Traits::Core::row_stride_v<_core_impl>;
+
+  static const matrix_type& Get(const matrix_type& _m) { return _m; }
+
+  // Whether the stored matrix is read transposed in `_layout`.
+  constexpr static Trans Op(Core::Major _layout) {
+    return (matrix_type::core_major != _layout) != transposed ? Trans::Yes
+                                                              : Trans::No;
+  }
+};
+
+template <typename _core_impl>
+struct BackendOperand<Expr::Unary<Types::Matrix<_core_impl>, Expr::Trp>>
+    : BackendOperand<Types::Matrix<_core_impl>> {
+  using matrix_type = Types::Matrix<_core_impl>;
+
+  constexpr static bool transposed = true;
+
+  static const matrix_type& Get(
+      const Expr::Unary<matrix_type, Expr::Trp>& _e) {
+    return _e._o;
+  }
+
+  constexpr static Trans Op(Core::Major _layout) {
+    return (matrix_type::core_major != _layout) != transposed ? Trans::Yes
+                                                              : Trans::No;
+  }
+};
+
+template <typename _core_impl, typename _lhs, typename _rhs>
+constexpr bool IsBackendProduct() {
+  if constexpr (BackendOperand<_lhs>::value && BackendOperand<_rhs>::value &&
+                Traits::Core::is_inner_contiguous_v<_core_impl>) {
+    using value_type = typename Types::Matrix<_core_impl>::value_type;
+    return (std::is_same_v<value_type, float> ||
+            std::is_same_v<value_type, double>) &&
+           std::is_same_v<value_type,
+                          typename BackendOperand<_lhs>::value_type> &&
+           std::is_same_v<value_type,
+                          typename BackendOperand<_rhs>::value_type>;
+  } else {
+    return false;
+  }
+}
+
+// `x * Trp(x)` or `Trp(x) * x`, for a matrix type x.
+template <typename _lhs, typename _rhs>
+struct IsGram : std::false_type {};
+
+template <typename _core_impl>
+struct IsGram<Types::Matrix<_core_impl>,
+              Expr::Unary<Types::Matrix<_core_impl>, Expr::Trp>>
+    : std::true_type {};
+
+template <typename _core_impl>
+struct IsGram<Expr::Unary<Types::Matrix<_core_impl>, Expr::Trp>,
+              Types::Matrix<_core_impl>> : std::true_type {};
+
+// Whether two matrices of the same type hold the same elements: the same
+// storage, as in `x * Trp(x)` over a heap-backed `x`, or equal values, as
+// over two copies of a `Dense` one.
+template <typename _core_impl>
+bool SameElements(const Types::Matrix<_core_impl>& _a,
+                  const Types::Matrix<_core_impl>& _b) {
+  using matrix_type = Types::Matrix<_core_impl>;
+
+  if (_a.Data() == _b.Data()) {
+    return true;
+  }
+
+  constexpr bool        row   = matrix_type::core_major == Core::Major::Row;
+  constexpr std::size_t outer = row ? matrix_type::rows : matrix_type::cols;
+  constexpr std::size_t inner = row ? matrix_type::cols : matrix_type::rows;
+  constexpr std::size_t ld    = matrix_type::OuterStride();
+
+  for (std::size_t o = 0; o < outer; o++) {
+    if (!Equal(_a.Data() + o * ld, _b.Data() + o * ld, inner)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace Impl
+
+inline void SelectBackend(const Backend* _backend) {
+  Impl::Selected().store(_backend);
+}
+
+inline const Backend* SelectedBackend() {
+  return Impl::Selected().load();
+}
+
+inline BackendScope::BackendScope(const Backend* _backend)
+    : _m_previous_forced(Impl::Forced().forced),
+      _m_previous(Impl::Forced().backend) {
+  Impl::Forced() = {true, _backend};
+}
+
+inline BackendScope::~BackendScope() {
+  Impl::Forced() = {_m_previous_forced, _m_previous};
+}
+
+template <typename _core_impl, typename _lhs, typename _rhs>
+bool BackendMul(Types::Matrix<_core_impl>& _dst,
+                const _lhs& _l,
+                const _rhs& _r) {
+  if constexpr (!Impl::IsBackendProduct<_core_impl, _lhs, _rhs>()) {
+    return false;
+  } else {
+    using dst_type   = Types::Matrix<_core_impl>;
+    using value_type = typename dst_type::value_type;
+    using lhs_op     = Impl::BackendOperand<_lhs>;
+    using rhs_op     = Impl::BackendOperand<_rhs>;
+
+    constexpr std::size_t m = _lhs::rows;
+    constexpr std::size_t k = _lhs::cols;
+    constexpr std::size_t n = _rhs::cols;
+
+    const Backend* backend = Impl::RouteProduct(m * n * k);
+    if (backend == nullptr) {
+      return false;
+    }
+
+    SGLTY_TRACE_KERNEL("Backend",
+                       m,
+                       n,
+                       (m * k + k * n + m * n) * sizeof(value_type));
+
+    const auto& a = lhs_op::Get(_l);
+    const auto& b = rhs_op::Get(_r);
+
+    if constexpr (n == 1) {
+      // y = op(A) x, with A as stored.
+      using a_type             = std::decay_t<decltype(a)>;
+      constexpr Core::Major la = a_type::core_major;
+      backend->Gemv(la,
+                    lhs_op::Op(la),
+                    a_type::rows,
+                    a_type::cols,
+                    value_type(1),
+                    a.Data(),
+                    a_type::OuterStride(),
+                    b.Data(),
+                    rhs_op::inc,
+                    value_type(0),
+                    _dst.Data(),
+                    Traits::Core::row_stride_v<_core_impl>);
+    } else if constexpr (m == 1) {
+      // yᵀ = xᵀ op(B), i.e. y = op(B)ᵀ x.
+      using b_type             = std::decay_t<decltype(b)>;
+      constexpr Core::Major lb = b_type::core_major;
+      backend->Gemv(lb,
+                    rhs_op::Op(lb) == Trans::No ? Trans::Yes : Trans::No,
+                    b_type::rows,
+                    b_type::cols,
+                    value_type(1),
+                    b.Data(),
+                    b_type::OuterStride(),
+                    a.Data(),
+                    lhs_op::inc,
+                    value_type(0),
+                    _dst.Data(),
+                    Traits::Core::col_stride_v<_core_impl>);
+    } else {
+      constexpr Core::Major layout = dst_type::core_major;
+
+      if constexpr (Impl::IsGram<_lhs, _rhs>::value) {
+        if (Impl::SameElements(a, b)) {
+          // One triangle of op(A) op(A)ᵀ, mirrored into the other.
+          backend->Syrk(layout,
+                        Uplo::Lower,
+                        lhs_op::Op(layout),
+                        m,
+                        k,
+                        value_type(1),
+                        a.Data(),
+                        a.OuterStride(),
+                        value_type(0),
+                        _dst.Data(),
+                        _dst.OuterStride());
+          for (std::size_t i = 0; i < m; i++) {
+            for (std::size_t j = i + 1; j < m; j++) {
+              _dst(i, j) = _dst(j, i);
+            }
+          }
+          return true;
+        }
+      }
+
+      backend->Gemm(layout,
+                    lhs_op::Op(layout),
+                    rhs_op::Op(layout),
+                    m,
+                    n,
+                    k,
+                    value_type(1),
+                    a.Data(),
+                    a.OuterStride(),
+                    b.Data(),
+                    b.OuterStride(),
+                    value_type(0),
+                    _dst.Data(),
+                    _dst.OuterStride());
+    }
+    return true;
+  }
+}
+
+}  // namespace Sglty::Kernel
+
+#if defined(SGLTY_ENABLE_CBLAS)
+#include "../Cblas.hpp"
+#endif
+
+// Singularity/Kernel/Impl/Route.tpp
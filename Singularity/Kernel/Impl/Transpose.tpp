@@ -0,0 +1,309 @@
+#pragma once
+
+#include "../Transpose.hpp"
+
+#include <cstddef>
+#include <type_traits>
+
+#include "../../Config.hpp"
+
+#if SGLTY_HAS_X86_KERNELS
+#include <immintrin.h>
+#endif
+
+#include "../Isa.hpp"
+
+namespace Sglty::Kernel {
+
+namespace Impl {
+
+// Copies one row of a transposed block out of the buffer.
+template <typename _Tp>
+void CopyRow(const _Tp* _src, std::size_t _n, _Tp* _dst) {
+  for (std::size_t k = 0; k < _n; k++) {
+    _dst[k] = _src[k];
+  }
+}
+
+#if SGLTY_HAS_X86_KERNELS && (SGLTY_HAS_MULTIVERSIONING || defined(__AVX__))
+// The AVX kernels need AVX only, so the baseline of `-mavx` builds uses
+// them as well.
+
+// 8x8 block of 4-byte elements, via unpack, shuffle and lane permute.
+SGLTY_TARGET("avx")
+inline void TransposeAvx(const float* _s,
+                         std::size_t _ss,
+                         float* _d,
+                         std::size_t _ds) {
+  // Written out: with arrays and loops, GCC keeps the registers on the
+  // stack at `-O2`.
+  const __m256 r0 = _mm256_loadu_ps(_s);
+  const __m256 r1 = _mm256_loadu_ps(_s + _ss);
+  const __m256 r2 = _mm256_loadu_ps(_s + 2 * _ss);
+  const __m256 r3 = _mm256_loadu_ps(_s + 3 * _ss);
+  const __m256 r4 = _mm256_loadu_ps(_s + 4 * _ss);
+  const __m256 r5 = _mm256_loadu_ps(_s + 5 * _ss);
+  const __m256 r6 = _mm256_loadu_ps(_s + 6 * _ss);
+  const __m256 r7 = _mm256_loadu_ps(_s + 7 * _ss);
+
+  const __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+  const __m256 t1 = _mm256_unpackhi_ps(r0, r1);
+  const __m256 t2 = _mm256_unpacklo_ps(r2, r3);
+  const __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+  const __m256 t4 = _mm256_unpacklo_ps(r4, r5);
+  const __m256 t5 = _mm256_unpackhi_ps(r4, r5);
+  const __m256 t6 = _mm256_unpacklo_ps(r6, r7);
+  const __m256 t7 = _mm256_unpackhi_ps(r6, r7);
+
+  const __m256 u0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+  const __m256 u1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+  const __m256 u2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+  const __m256 u3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+  const __m256 u4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+  const __m256 u5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+  const __m256 u6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+  const __m256 u7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+
+  _mm256_storeu_ps(_d, _mm256_permute2f128_ps(u0, u4, 0x20));
+  _mm256_storeu_ps(_d + _ds, _mm256_permute2f128_ps(u1, u5, 0x20));
+  _mm256_storeu_ps(_d + 2 * _ds, _mm256_permute2f128_ps(u2, u6, 0x20));
+  _mm256_storeu_ps(_d + 3 * _ds, _mm256_permute2f128_ps(u3, u7, 0x20));
+  _mm256_storeu_ps(_d + 4 * _ds, _mm256_permute2f128_ps(u0, u4, 0x31));
+  _mm256_storeu_ps(_d + 5 * _ds, _mm256_permute2f128_ps(u1, u5, 0x31));
+  _mm256_storeu_ps(_d + 6 * _ds, _mm256_permute2f128_ps(u2, u6, 0x31));
+  _mm256_storeu_ps(_d + 7 * _ds, _mm256_permute2f128_ps(u3, u7, 0x31));
+}
+
+// 4x4 block of 8-byte elements.
+SGLTY_TARGET("avx")
+inline void TransposeAvx(const double* _s,
+                         std::size_t _ss,
+                         double* _d,
+                         std::size_t _ds) {
+  const __m256d r0 = _mm256_loadu_pd(_s);
+  const __m256d r1 = _mm256_loadu_pd(_s + _ss);
+  const __m256d r2 = _mm256_loadu_pd(_s + 2 * _ss);
+  const __m256d r3 = _mm256_loadu_pd(_s + 3 * _ss);
+
+  const __m256d t0 = _mm256_unpacklo_pd(r0, r1);
+  const __m256d t1 = _mm256_unpackhi_pd(r0, r1);
+  const __m256d t2 = _mm256_unpacklo_pd(r2, r3);
+  const __m256d t3 = _mm256_unpackhi_pd(r2, r3);
+
+  _mm256_storeu_pd(_d, _mm256_permute2f128_pd(t0, t2, 0x20));
+  _mm256_storeu_pd(_d + _ds, _mm256_permute2f128_pd(t1, t3, 0x20));
+  _mm256_storeu_pd(_d + 2 * _ds, _mm256_permute2f128_pd(t0, t2, 0x31));
+  _mm256_storeu_pd(_d + 3 * _ds, _mm256_permute2f128_pd(t1, t3, 0x31));
+}
+#endif
+
+#if SGLTY_HAS_X86_KERNELS
+// 4x4 block of 4-byte elements.
+inline void TransposeSse2(const float* _s,
+                          std::size_t _ss,
+                          float* _d,
+                          std::size_t _ds) {
+  __m128 r0 = _mm_loadu_ps(_s);
+  __m128 r1 = _mm_loadu_ps(_s + _ss);
+  __m128 r2 = _mm_loadu_ps(_s + 2 * _ss);
+  __m128 r3 = _mm_loadu_ps(_s + 3 * _ss);
+
+  _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+  _mm_storeu_ps(_d, r0);
+  _mm_storeu_ps(_d + _ds, r1);
+  _mm_storeu_ps(_d + 2 * _ds, r2);
+  _mm_storeu_ps(_d + 3 * _ds, r3);
+}
+
+// 2x2 block of 8-byte elements.
+inline void TransposeSse2(const double* _s,
+                          std::size_t _ss,
+                          double* _d,
+                          std::size_t _ds) {
+  const __m128d r0 = _mm_loadu_pd(_s);
+  const __m128d r1 = _mm_loadu_pd(_s + _ss);
+
+  _mm_storeu_pd(_d, _mm_unpacklo_pd(r0, r1));
+  _mm_storeu_pd(_d + _ds, _mm_unpackhi_pd(r0, r1));
+}
+#endif
+
+// Whether the AVX kernels are used in variant `_isa`: in the AVX2 and
+// AVX-512 variants, and in the baseline of builds with AVX enabled.
+template <Isa _isa>
+constexpr bool UsesTransposeAvx() {
+#if !SGLTY_HAS_X86_KERNELS
+  return false;
+#elif defined(__AVX__)
+  return true;
+#elif SGLTY_HAS_MULTIVERSIONING
+  return _isa != Isa::Baseline;
+#else
+  return false;
+#endif
+}
+
+// Side of the in-register block for `_Tp` in variant `_isa`, or 1 if there
+// is none.
+template <typename _Tp, Isa _isa>
+constexpr std::size_t TransposeMicro() {
+  if constexpr (!std::is_trivially_copyable_v<_Tp> ||
+                (sizeof(_Tp) != 4 && sizeof(_Tp) != 8)) {
+    return 1;
+  } else if constexpr (UsesTransposeAvx<_isa>()) {
+    return sizeof(_Tp) == 4 ? 8 : 4;
+  } else {
+#if SGLTY_HAS_X86_KERNELS
+    return sizeof(_Tp) == 4 ? 4 : 2;
+#else
+    return 1;
+#endif
+  }
+}
+
+// Transposes a `TransposeMicro()` block with the kernel of variant `_isa`.
+template <Isa _isa, typename _lane>
+void TransposeMicroBlock(const _lane* _s,
+                         std::size_t _ss,
+                         _lane* _d,
+                         std::size_t _ds) {
+  if constexpr (UsesTransposeAvx<_isa>()) {
+#if SGLTY_HAS_X86_KERNELS && (SGLTY_HAS_MULTIVERSIONING || defined(__AVX__))
+    TransposeAvx(_s, _ss, _d, _ds);
+#endif
+  } else {
+#if SGLTY_HAS_X86_KERNELS
+    TransposeSse2(_s, _ss, _d, _ds);
+#endif
+  }
+}
+
+// Transposes one block of at most `transpose_block` rows and columns.
+template <Isa _isa, typename _Tp>
+void TransposeBlock(const _Tp* _src,
+                    std::size_t _ss,
+                    _Tp* _dst,
+                    std::size_t _ds,
+                    std::size_t _rows,
+                    std::size_t _cols) {
+  constexpr std::size_t micro = TransposeMicro<_Tp, _isa>();
+
+  std::size_t i = 0;
+  if constexpr (micro > 1) {
+    // The element bits are moved unchanged, as `float`s or `double`s.
+    using lane = std::conditional_t<sizeof(_Tp) == 4, float, double>;
+
+    for (; i + micro <= _rows; i += micro) {
+      std::size_t j = 0;
+      for (; j + micro <= _cols; j += micro) {
+        TransposeMicroBlock<_isa>(
+            reinterpret_cast<const lane*>(_src + i * _ss + j),
+            _ss,
+            reinterpret_cast<lane*>(_dst + j * _ds + i),
+            _ds);
+      }
+      for (; j < _cols; j++) {
+        for (std::size_t ii = i; ii < i + micro; ii++) {
+          _dst[j * _ds + ii] = _src[ii * _ss + j];
+        }
+      }
+    }
+  }
+  for (; i < _rows; i++) {
+    for (std::size_t j = 0; j < _cols; j++) {
+      _dst[j * _ds + i] = _src[i * _ss + j];
+    }
+  }
+}
+
+// `TransposeBlock()` in the variant chosen by `ActiveIsa()`.
+template <typename _Tp>
+void TransposeBlock(const _Tp* _src,
+                    std::size_t _ss,
+                    _Tp* _dst,
+                    std::size_t _ds,
+                    std::size_t _rows,
+                    std::size_t _cols) {
+  if constexpr (TransposeMicro<_Tp, Isa::Avx2>() > 1) {
+    IsaDispatch([&](auto _isa) {
+      TransposeBlock<decltype(_isa)::value>(
+          _src, _ss, _dst, _ds, _rows, _cols);
+    });
+  } else {
+    TransposeBlock<Isa::Baseline>(_src, _ss, _dst, _ds, _rows, _cols);
+  }
+}
+
+template <typename _Tp>
+void TransposeRecursive(const _Tp* _src,
+                        std::size_t _ss,
+                        _Tp* _dst,
+                        std::size_t _ds,
+                        std::size_t _rows,
+                        std::size_t _cols) {
+  if (_rows <= transpose_block && _cols <= transpose_block) {
+    // Strided stores would each touch a different line; write whole rows.
+    _Tp tmp[transpose_block * transpose_block];
+    TransposeBlock(_src, _ss, tmp, _rows, _rows, _cols);
+    for (std::size_t r = 0; r < _cols; r++) {
+      CopyRow(tmp + r * _rows, _rows, _dst + r * _ds);
+    }
+  } else if (_rows >= _cols) {
+    // Split on a multiple of 8 so in-register blocks stay aligned to it.
+    const std::size_t h = _rows / 2 / 8 * 8;
+    TransposeRecursive(_src, _ss, _dst, _ds, h, _cols);
+    TransposeRecursive(_src + h * _ss, _ss, _dst + h, _ds, _rows - h, _cols);
+  } else {
+    const std::size_t h = _cols / 2 / 8 * 8;
+    TransposeRecursive(_src, _ss, _dst, _ds, _rows, h);
+    TransposeRecursive(_src + h, _ss, _dst + h * _ds, _ds, _rows, _cols - h);
+  }
+}
+
+}  // namespace Impl
+
+template <typename _Tp>
+void Transpose(const _Tp* _src,
+               std::size_t _src_stride,
+               _Tp* _dst,
+               std::size_t _dst_stride,
+               std::size_t _rows,
+               std::size_t _cols) {
+  Impl::TransposeRecursive(
+      _src, _src_stride, _dst, _dst_stride, _rows, _cols);
+}
+
+template <typename _Tp>
+void TransposeInPlace(_Tp* _p, std::size_t _n, std::size_t _stride) {
+  constexpr std::size_t block = transpose_block;
+
+  _Tp tmp[block * block];
+  for (std::size_t bi = 0; bi < _n; bi += block) {
+    const std::size_t ni = _n - bi < block ? _n - bi : block;
+
+    // Diagonal block: through the buffer and back.
+    _Tp* diag = _p + bi * _stride + bi;
+    Impl::TransposeBlock(diag, _stride, tmp, ni, ni, ni);
+    for (std::size_t r = 0; r < ni; r++) {
+      Impl::CopyRow(tmp + r * ni, ni, diag + r * _stride);
+    }
+
+    // Mirror pair: upper -> buffer, lower -> upper, buffer -> lower.
+    for (std::size_t bj = bi + block; bj < _n; bj += block) {
+      const std::size_t nj = _n - bj < block ? _n - bj : block;
+
+      _Tp* upper = _p + bi * _stride + bj;
+      _Tp* lower = _p + bj * _stride + bi;
+      Impl::TransposeBlock(upper, _stride, tmp, ni, ni, nj);
+      Impl::TransposeBlock(lower, _stride, upper, _stride, nj, ni);
+      for (std::size_t r = 0; r < nj; r++) {
+        Impl::CopyRow(tmp + r * ni, ni, lower + r * _stride);
+      }
+    }
+  }
+}
+
+}  // namespace Sglty::Kernel
+
+// Singularity/Kernel/Impl/Transpose.tpp
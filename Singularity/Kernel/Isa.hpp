@@ -0,0 +1,121 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+#include <type_traits>
+
+#include "../Config.hpp"
+
+/// `target` options of the `Isa::Avx2` variants (x86-64-v3).
+#define SGLTY_ISA_AVX2 "avx2,fma,f16c"
+
+/// `target` options of the `Isa::Avx512` variants (x86-64-v4).
+#define SGLTY_ISA_AVX512 "avx2,fma,f16c,avx512f,avx512bw,avx512dq,avx512vl"
+
+#if SGLTY_HAS_MULTIVERSIONING
+/// Compiles the function it precedes for the instruction set `_isa`.
+#define SGLTY_TARGET(_isa) __attribute__((target(_isa)))
+
+#define SGLTY_PRAGMA(_x) _Pragma(#_x)
+
+/// Compiles every function up to `SGLTY_POP_TARGET()` for `_isa`.
+#define SGLTY_PUSH_TARGET(_isa) \
+  SGLTY_PRAGMA(GCC push_options) SGLTY_PRAGMA(GCC target(_isa))
+
+#define SGLTY_POP_TARGET() SGLTY_PRAGMA(GCC pop_options)
+#else
+#define SGLTY_TARGET(_isa)
+#endif
+
+namespace Sglty::Kernel {
+
+/**
+ * @brief Instruction-set variants the vectorized kernels are compiled in.
+ *
+ * With `SGLTY_HAS_MULTIVERSIONING` (GCC on x86-64) the element-wise math
+ * functions, comparisons, conversions, transposes, `Gemm()` and `QGemm()`
+ * inner loops and large element-wise assignments are compiled once per
+ * variant, whatever the build flags are, and `ActiveIsa()` picks one at the
+ * first call. One binary built for plain x86-64 then runs the AVX2 code on
+ * AVX2 machines and the AVX-512 code on AVX-512 machines. Without it, only
+ * `Baseline` exists.
+ *
+ * Variants are ordered: each one may use everything the previous ones do.
+ */
+enum class Isa {
+  /// Whatever the build flags enable (SSE2 on a plain x86-64 build).
+  Baseline,
+
+  /// AVX2, FMA and F16C (x86-64-v3).
+  Avx2,
+
+  /// AVX-512 F, BW, DQ and VL on top of `Avx2` (x86-64-v4).
+  Avx512
+};
+
+/**
+ * @brief Smallest element-wise assignment, in elements, that
+ * `Expr::Assign()` evaluates in the `ActiveIsa()` variant.
+ *
+ * Smaller ones stay on the baseline code, so small fixed-size expressions
+ * are not compiled three times.
+ */
+constexpr inline std::size_t isa_min_work = 4096;
+
+/**
+ * @brief Returns the highest variant the CPU and the operating system
+ * support, from CPUID. Never below what the build flags already require.
+ */
+Isa DetectedIsa();
+
+/**
+ * @brief Returns the variant the kernels run in.
+ *
+ * Chosen once, at the first call: `DetectedIsa()`, unless the environment
+ * variable `SGLTY_ISA` names a lower one (`"baseline"`, `"avx2"` or
+ * `"avx512"`), e.g. to compare variants on one machine. Names of variants the
+ * CPU lacks are lowered to `DetectedIsa()`; unknown names are ignored.
+ *
+ * Example Usage:
+ * ```
+ * std::cerr << "kernels: " << Sglty::Kernel::IsaName(ActiveIsa()) << '\n';
+ * // SGLTY_ISA=avx2 ./app  ->  kernels: avx2
+ * ```
+ */
+Isa ActiveIsa();
+
+/**
+ * @brief Returns the name of `_isa`, as accepted by `SGLTY_ISA`.
+ */
+std::string_view IsaName(Isa _isa);
+
+/// Passes a variant to the callable of `IsaDispatch()` as a type.
+template <Isa _isa>
+using IsaTag = std::integral_constant<Isa, _isa>;
+
+/**
+ * @brief Calls `_f(IsaTag<ActiveIsa()>{})` with `_f` compiled for that
+ * variant.
+ *
+ * Each variant is a wrapper with the variant's `target` attribute into
+ * which `_f` and everything it calls are inlined (`flatten`), so plain
+ * loops in `_f` are auto-vectorized for AVX2 or AVX-512. Multiply-adds are
+ * not contracted into FMA instructions, so floating-point results are the
+ * same in every variant. The wrapper is
+ * looked up once per callable type, in a function-local table, and then
+ * called through a pointer.
+ *
+ * Intrinsics cannot be used in `_f` directly: call functions declared with
+ * `SGLTY_TARGET()` from it instead.
+ *
+ * @param _f Callable taking an `IsaTag`.
+ * @return What `_f` returns; every variant must return the same type.
+ */
+template <typename _fn>
+decltype(auto) IsaDispatch(_fn&& _f);
+
+}  // namespace Sglty::Kernel
+
+#include "Impl/Isa.tpp"
+
+// Singularity/Kernel/Isa.hpp
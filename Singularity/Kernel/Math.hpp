@@ -0,0 +1,141 @@
+#pragma once
+
+#include <cstddef>
+
+#include "../Fwd.hpp"
+
+namespace Sglty::Kernel {
+
+/**
+ * @brief Element-wise functions used by `Expr::Func` and `Expr::PowScalar`.
+ *
+ * Each function is a stateless object with two entry points:
+ *
+ * - `operator()(x)` evaluates one element. `float` and `double` use the
+ *   polynomial approximations described below (also during constant
+ *   evaluation); 16-bit floating-point values are computed as `float` and
+ *   integers as `double`.
+ *
+ * - `Apply(_src, _dst, _n)` evaluates `_n` contiguous `float`s or `double`s
+ *   (`_src` may equal `_dst`). The same approximations run on packs of GCC
+ *   vector extensions (`SGLTY_HAS_VECTOR_EXTENSIONS`) as wide as the
+ *   registers of the `ActiveIsa()` variant (SSE2, AVX or AVX-512), so they
+ *   agree with `operator()` up to the contraction of multiply-adds into
+ *   FMAs.
+ *
+ * Accuracy over the whole input range, measured against a long double
+ * reference:
+ *
+ * | Function | `float` | `double`  | Notes                              |
+ * |----------|---------|-----------|------------------------------------|
+ * | `Exp`    | 1.5 ulp | 1.5 ulp   | subnormal results round once       |
+ * | `Log`    | 1.5 ulp | 1.5 ulp   | `-inf` at zero, NaN below          |
+ * | `Tanh`   | 3 ulp   | 3 ulp     |                                    |
+ * | `Sqrt`   | exact   | exact     | hardware square root               |
+ * | `Abs`    | exact   | exact     | clears the sign bit                |
+ * | `Pow`    | 0.5 ulp | 1.5 ulp   | exact for small integer exponents  |
+ *
+ * `float` powers are computed in `double` and rounded once. `double` powers
+ * are `exp(y log x)` with `log x` and the product carried to about twice
+ * the precision, so they are as accurate as `Exp` over the whole range.
+ * Exponents that are integers of magnitude up to 16 use repeated squaring
+ * at that precision instead, which is exact where the result is
+ * representable (`Pow(-2.0, 3.0) == -8.0`).
+ */
+struct Exp {
+  /// Estimated flops per element, for `Expr::Cost`.
+  constexpr static std::size_t flops = 16;
+
+  template <typename _Tp>
+  constexpr auto operator()(_Tp _x) const;
+
+  template <typename _Tp>
+  static void Apply(const _Tp* _src, _Tp* _dst, std::size_t _n);
+};
+
+/**
+ * @brief Natural logarithm. See `Exp` for accuracy and entry points.
+ */
+struct Log {
+  /// Estimated flops per element, for `Expr::Cost`.
+  constexpr static std::size_t flops = 24;
+
+  template <typename _Tp>
+  constexpr auto operator()(_Tp _x) const;
+
+  template <typename _Tp>
+  static void Apply(const _Tp* _src, _Tp* _dst, std::size_t _n);
+};
+
+/**
+ * @brief Hyperbolic tangent. See `Exp` for accuracy and entry points.
+ *
+ * Small arguments use an odd polynomial; larger ones `(1 - t) / (1 + t)`
+ * with `t = exp(-2|x|)`.
+ */
+struct Tanh {
+  /// Estimated flops per element, for `Expr::Cost`.
+  constexpr static std::size_t flops = 32;
+
+  template <typename _Tp>
+  constexpr auto operator()(_Tp _x) const;
+
+  template <typename _Tp>
+  static void Apply(const _Tp* _src, _Tp* _dst, std::size_t _n);
+};
+
+/**
+ * @brief Square root. See `Exp` for entry points.
+ *
+ * `Apply` uses the SSE2 / AVX / AVX-512 square root instructions.
+ */
+struct Sqrt {
+  /// Estimated flops per element, for `Expr::Cost`.
+  constexpr static std::size_t flops = 1;
+
+  template <typename _Tp>
+  constexpr auto operator()(_Tp _x) const;
+
+  template <typename _Tp>
+  static void Apply(const _Tp* _src, _Tp* _dst, std::size_t _n);
+};
+
+/**
+ * @brief Absolute value. See `Exp` for entry points.
+ */
+struct Abs {
+  /// Estimated flops per element, for `Expr::Cost`.
+  constexpr static std::size_t flops = 1;
+
+  template <typename _Tp>
+  constexpr auto operator()(_Tp _x) const;
+
+  template <typename _Tp>
+  static void Apply(const _Tp* _src, _Tp* _dst, std::size_t _n);
+};
+
+/**
+ * @brief Power `x^y`. See `Exp` for accuracy and entry points.
+ *
+ * Follows `std::pow` for the special cases: `x^0 == 1^y == (-1)^±inf == 1`;
+ * zero and infinite bases, and infinite exponents, give 0 or infinity by
+ * whether the result grows; finite negative bases need an integer exponent
+ * (otherwise NaN), and odd integer exponents keep the sign of the base,
+ * zeros and infinities included. `operator()` and `Apply()` agree.
+ */
+struct Pow {
+  /// Estimated flops per element, for `Expr::Cost`.
+  constexpr static std::size_t flops = 48;
+
+  template <typename _Tp, typename _Up>
+  constexpr auto operator()(_Tp _x, _Up _y) const;
+
+  template <typename _Tp, typename _Up>
+  static void Apply(const _Tp* _src, _Tp* _dst, std::size_t _n, _Up _y);
+};
+
+}  // namespace Sglty::Kernel
+
+#include "Impl/Math.tpp"
+
+// Singularity/Kernel/Math.hpp
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace Sglty::Kernel {
+
+/**
+ * @brief Philox4x32-10 counter-based random number generator.
+ *
+ * Maps a 128-bit counter and a 64-bit key to 128 random bits with ten rounds
+ * of multiply-xor mixing (Salmon et al., "Parallel Random Numbers: As Easy as
+ * 1, 2, 3", SC 2011). There is no state to advance: the output for a given
+ * counter is fixed, so elements can be generated independently, in any order
+ * and on any thread, and still reproduce the same matrix.
+ *
+ * `constexpr`, so random matrices can also be generated at compile time.
+ *
+ * @param _counter The counter block.
+ * @param _key     The key (seed).
+ * @return Four 32-bit random words.
+ */
+constexpr std::array<std::uint32_t, 4> Philox4x32(
+    std::array<std::uint32_t, 4> _counter,
+    std::array<std::uint32_t, 2> _key);
+
+}  // namespace Sglty::Kernel
+
+#include "Impl/Philox.tpp"
+
+// Singularity/Kernel/Philox.hpp
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "../Fwd.hpp"
+
+namespace Sglty::Kernel {
+
+/**
+ * @brief Checks whether `_Tp` is an 8-bit integer (`int8_t`, `uint8_t` or a
+ * plain `char`), i.e. a quantized value for `QGemm()`.
+ */
+template <typename _Tp>
+constexpr inline bool is_quantized_v = std::is_integral_v<_Tp> &&
+                                       !std::is_same_v<_Tp, bool> &&
+                                       sizeof(_Tp) == 1;
+
+/**
+ * @brief Granularity of the output scale of a requantized product.
+ */
+enum class QAxis {
+  /// One scale for the whole result.
+  Tensor,
+
+  /// One scale per result row (e.g. per output channel of `W * x`).
+  Row,
+
+  /// One scale per result column.
+  Col
+};
+
+/**
+ * @brief Quantization parameters of a product evaluated by `QGemm()`.
+ *
+ * With zero points `lhs_zero` and `rhs_zero`, the int32 accumulator is
+ * ```
+ * acc(i, j) = sum_k (l(i, k) - lhs_zero) * (r(k, j) - rhs_zero)
+ * ```
+ * and the stored result is `acc(i, j) * s + out_zero`, where `s` is
+ * `scale[0]`, `scale[i]` or `scale[j]` depending on `_axis`. Integral
+ * destinations round to nearest and saturate to their range.
+ *
+ * @tparam _axis  Which index selects the scale.
+ * @tparam _count Number of scales: 1, the result's rows or its columns.
+ */
+template <QAxis _axis = QAxis::Tensor, std::size_t _count = 1>
+struct QParams {
+  /// Which index selects the scale.
+  static constexpr QAxis axis = _axis;
+
+  /// Zero point of the left operand.
+  std::int32_t lhs_zero = 0;
+
+  /// Zero point of the right operand.
+  std::int32_t rhs_zero = 0;
+
+  /// Output scales.
+  std::array<float, _count> scale{};
+
+  /// Zero point of the result.
+  std::int32_t out_zero = 0;
+};
+
+/**
+ * @brief Evaluates the product of two 8-bit integer operands with int32
+ * accumulation.
+ *
+ * The left operand is packed row by row and the right one column by column,
+ * each into contiguous buffers padded to the vector width, so every result
+ * element is a unit-stride dot product. The dot products widen the 8-bit
+ * values to 16 bits and accumulate pairs of products into 32-bit lanes
+ * (`vpmaddwd`, or `vpdpwssd` when the build enables AVX-512 VNNI) four
+ * result columns at a time, in the AVX2 or AVX-512 variant `ActiveIsa()`
+ * picks; the baseline variant of a build without AVX2 uses a plain loop
+ * that the compiler vectorizes the same way. Results are exact, so they
+ * match `Expr::MulMatrix`.
+ *
+ * `Expr::Assign()` selects this kernel automatically for products of
+ * quantized operands (`is_quantized_v`) of at least `gemm_min_work`
+ * multiply-adds; each accumulator is converted to the destination type with
+ * `static_cast`.
+ *
+ * @tparam _core_impl The core implementation of the destination.
+ * @tparam _lhs       Left operand expression (`rows × inner`).
+ * @tparam _rhs       Right operand expression (`inner × cols`).
+ * @param _dst The destination matrix; must not alias the operands.
+ * @param _l   Left operand.
+ * @param _r   Right operand.
+ */
+template <typename _core_impl, typename _lhs, typename _rhs>
+void QGemm(Types::Matrix<_core_impl>& _dst, const _lhs& _l, const _rhs& _r);
+
+/**
+ * @brief Evaluates a requantized product of two 8-bit integer operands.
+ *
+ * Computes the int32 accumulators of `(l - lhs_zero) * (r - rhs_zero)` as
+ * above (zero points are folded in through row and column sums, so the
+ * inner loop is unchanged) and writes `acc * scale + out_zero` to `_dst`,
+ * rounded and saturated if `_dst` holds integers. Use a `float` destination
+ * to dequantize, or an 8-bit one to requantize for the next layer.
+ *
+ * @tparam _core_impl The core implementation of the destination.
+ * @tparam _lhs       Left operand expression (`rows × inner`).
+ * @tparam _rhs       Right operand expression (`inner × cols`).
+ * @tparam _axis      Granularity of the output scale.
+ * @tparam _count     Number of scales.
+ * @param _dst    The destination matrix; must not alias the operands.
+ * @param _l      Left operand.
+ * @param _r      Right operand.
+ * @param _params Zero points and output scales.
+ */
+template <typename _core_impl,
+          typename _lhs,
+          typename _rhs,
+          QAxis _axis,
+          std::size_t _count>
+void QGemm(Types::Matrix<_core_impl>& _dst,
+           const _lhs& _l,
+           const _rhs& _r,
+           const QParams<_axis, _count>& _params);
+
+}  // namespace Sglty::Kernel
+
+#include "Impl/QGemm.tpp"
+
+// Singularity/Kernel/QGemm.hpp
@@ -0,0 +1,289 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+#include "../Core/Enums.hpp"
+#include "../Fwd.hpp"
+
+namespace Sglty::Kernel {
+
+/**
+ * @brief Whether a `Backend` routine reads an operand as stored or
+ * transposed.
+ */
+enum class Trans {
+  /// op(A) = A.
+  No,
+
+  /// op(A) = Aᵀ.
+  Yes
+};
+
+/**
+ * @brief Which triangle of a square operand a `Backend` routine reads or
+ * writes.
+ */
+enum class Uplo {
+  /// Elements on and above the diagonal.
+  Upper,
+
+  /// Elements on and below the diagonal.
+  Lower
+};
+
+/**
+ * @brief Side of the triangular matrix in `Backend::Trsm()`.
+ */
+enum class Side {
+  /// op(A) X = alpha B.
+  Left,
+
+  /// X op(A) = alpha B.
+  Right
+};
+
+/**
+ * @brief Whether the triangular matrix in `Backend::Trsm()` has an implicit
+ * unit diagonal.
+ */
+enum class Diag {
+  /// The diagonal is read from the matrix.
+  NonUnit,
+
+  /// The diagonal is taken to be all ones and is not read.
+  Unit
+};
+
+/**
+ * @brief Default `Backend::MinWork()`: smallest `rows * cols * inner` of a
+ * product that is worth handing to a selected backend.
+ *
+ * Below it, the call overhead of an external library outweighs its faster
+ * inner kernels and the library's own `Gemm()` is used.
+ */
+constexpr inline std::size_t backend_min_work = 64 * 64 * 64;
+
+/**
+ * @brief Interface of a dense linear algebra backend.
+ *
+ * The routines follow the CBLAS conventions for `float` and `double`
+ * operands given as pointers, a layout (`Core::Major::Row` or `Col`) and a
+ * leading dimension, so an adapter over any CBLAS-compatible library is a
+ * thin forwarding layer:
+ *
+ * - `Gemm`: C = alpha op(A) op(B) + beta C, with op(A) `_m` × `_k`
+ * - `Gemv`: y = alpha op(A) x + beta y, with A `_m` × `_n` as stored
+ * - `Trsm`: B = alpha op(A)⁻¹ B (`Side::Left`) or alpha B op(A)⁻¹ (`Right`),
+ *   with A triangular
+ * - `Syrk`: C = alpha op(A) op(A)ᵀ + beta C on the `_uplo` triangle of C
+ *
+ * As in BLAS, `beta == 0` overwrites C (and y) without reading it.
+ *
+ * Backends are registered by name with `RegisterBackend()`, declared with
+ * the rest of the registry in `Kernel/Backend.hpp`. `Expr::Assign()`
+ * hands matrix products of `float` or `double` matrices with contiguous rows
+ * or columns (possibly padded, possibly read through `Trp`) to the backend
+ * chosen with `SelectBackend()` or forced with `BackendScope`: a vector
+ * result goes to `Gemv`, `x * Trp(x)` and `Trp(x) * x` to `Syrk`, anything
+ * else to `Gemm`. `Trsm` is available to callers directly.
+ *
+ * Implementations must be safe to call from several threads at once.
+ */
+class Backend {
+ public:
+  virtual ~Backend() = default;
+
+  /**
+   * @brief Returns the name the backend is registered under.
+   */
+  virtual std::string_view Name() const = 0;
+
+  /**
+   * @brief Returns the smallest `rows * cols * inner` of a product routed to
+   * this backend while it is selected (a forced backend gets every product).
+   */
+  virtual std::size_t MinWork() const;
+
+  virtual void Gemm(Core::Major _layout,
+                    Trans _ta,
+                    Trans _tb,
+                    std::size_t _m,
+                    std::size_t _n,
+                    std::size_t _k,
+                    float _alpha,
+                    const float* _a,
+                    std::size_t _lda,
+                    const float* _b,
+                    std::size_t _ldb,
+                    float _beta,
+                    float* _c,
+                    std::size_t _ldc) const = 0;
+
+  virtual void Gemm(Core::Major _layout,
+                    Trans _ta,
+                    Trans _tb,
+                    std::size_t _m,
+                    std::size_t _n,
+                    std::size_t _k,
+                    double _alpha,
+                    const double* _a,
+                    std::size_t _lda,
+                    const double* _b,
+                    std::size_t _ldb,
+                    double _beta,
+                    double* _c,
+                    std::size_t _ldc) const = 0;
+
+  virtual void Gemv(Core::Major _layout,
+                    Trans _ta,
+                    std::size_t _m,
+                    std::size_t _n,
+                    float _alpha,
+                    const float* _a,
+                    std::size_t _lda,
+                    const float* _x,
+                    std::size_t _incx,
+                    float _beta,
+                    float* _y,
+                    std::size_t _incy) const = 0;
+
+  virtual void Gemv(Core::Major _layout,
+                    Trans _ta,
+                    std::size_t _m,
+                    std::size_t _n,
+                    double _alpha,
+                    const double* _a,
+                    std::size_t _lda,
+                    const double* _x,
+                    std::size_t _incx,
+                    double _beta,
+                    double* _y,
+                    std::size_t _incy) const = 0;
+
+  virtual void Trsm(Core::Major _layout,
+                    Side _side,
+                    Uplo _uplo,
+                    Trans _ta,
+                    Diag _diag,
+                    std::size_t _m,
+                    std::size_t _n,
+                    float _alpha,
+                    const float* _a,
+                    std::size_t _lda,
+                    float* _b,
+                    std::size_t _ldb) const = 0;
+
+  virtual void Trsm(Core::Major _layout,
+                    Side _side,
+                    Uplo _uplo,
+                    Trans _ta,
+                    Diag _diag,
+                    std::size_t _m,
+                    std::size_t _n,
+                    double _alpha,
+                    const double* _a,
+                    std::size_t _lda,
+                    double* _b,
+                    std::size_t _ldb) const = 0;
+
+  virtual void Syrk(Core::Major _layout,
+                    Uplo _uplo,
+                    Trans _ta,
+                    std::size_t _n,
+                    std::size_t _k,
+                    float _alpha,
+                    const float* _a,
+                    std::size_t _lda,
+                    float _beta,
+                    float* _c,
+                    std::size_t _ldc) const = 0;
+
+  virtual void Syrk(Core::Major _layout,
+                    Uplo _uplo,
+                    Trans _ta,
+                    std::size_t _n,
+                    std::size_t _k,
+                    double _alpha,
+                    const double* _a,
+                    std::size_t _lda,
+                    double _beta,
+                    double* _c,
+                    std::size_t _ldc) const = 0;
+};
+
+/**
+ * @brief Chooses the backend that large products are routed to.
+ *
+ * Products of at least `_backend->MinWork()` multiply-adds go to it; smaller
+ * ones, and all of them with `nullptr`, stay on the library's own kernels.
+ * Applies to every thread. With `SGLTY_ENABLE_CBLAS` the CBLAS adapter is
+ * selected initially, otherwise none is.
+ *
+ * @param _backend The backend, or `nullptr`.
+ */
+void SelectBackend(const Backend* _backend);
+
+/**
+ * @brief Returns the backend chosen with `SelectBackend()`, or `nullptr`.
+ */
+const Backend* SelectedBackend();
+
+/**
+ * @brief Forces the products evaluated on the calling thread onto one
+ * backend while the scope is alive, regardless of their size.
+ *
+ * `nullptr` forces the library's own kernels even when a backend is
+ * selected. Scopes nest; the previous choice is restored on destruction.
+ * Meant for benchmarking the same expressions on different backends.
+ *
+ * Example Usage:
+ * ```
+ * {
+ *   Sglty::Kernel::BackendScope scope(Sglty::Kernel::FindBackend("cblas"));
+ *   c = a * b;  // cblas_sgemm
+ * }
+ * {
+ *   Sglty::Kernel::BackendScope scope(nullptr);
+ *   c = a * b;  // Kernel::Gemm()
+ * }
+ * ```
+ */
+class BackendScope {
+ public:
+  explicit BackendScope(const Backend* _backend);
+
+  BackendScope(const BackendScope&)            = delete;
+  BackendScope& operator=(const BackendScope&) = delete;
+
+  ~BackendScope();
+
+ private:
+  bool _m_previous_forced;
+  const Backend* _m_previous;
+};
+
+/**
+ * @brief Evaluates the matrix product `_l * _r` into `_dst` on the backend
+ * that applies to the calling thread, if any.
+ *
+ * Used by `Expr::Assign()` before `Gemm()`. Only products whose operands and
+ * destination share a `float` or `double` value type, and whose operands are
+ * matrices (or `Trp` of matrices) with contiguous, possibly padded, rows or
+ * columns, can be routed; everything else returns `false` at no cost.
+ *
+ * @param _dst  The destination matrix; must not alias the operands.
+ * @param _l    Left operand.
+ * @param _r    Right operand.
+ * @return `true` if a backend computed the product.
+ */
+template <typename _core_impl, typename _lhs, typename _rhs>
+bool BackendMul(Types::Matrix<_core_impl>& _dst,
+                const _lhs& _l,
+                const _rhs& _r);
+
+}  // namespace Sglty::Kernel
+
+#include "Impl/Route.tpp"
+
+// Singularity/Kernel/Route.hpp
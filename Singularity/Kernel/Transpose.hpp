@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstddef>
+
+#include "../Fwd.hpp"
+
+namespace Sglty::Kernel {
+
+/**
+ * @brief Side length of the square blocks `Transpose()` splits its input
+ * into, and of the block buffer used by `TransposeInPlace()`.
+ *
+ * A block of the source and its transposed copy stay in L1 while the block
+ * is transposed.
+ */
+constexpr inline std::size_t transpose_block = 32;
+
+/**
+ * @brief Transposes a strided `_rows` × `_cols` array.
+ *
+ * Equivalent to `_dst[j * _dst_stride + i] = _src[i * _src_stride + j]` for
+ * every i < `_rows`, j < `_cols`, where the strides are the distances between
+ * consecutive rows of each array.
+ *
+ * The larger side is halved recursively until both fit in
+ * `transpose_block`, so every level of the cache hierarchy sees square-ish
+ * blocks without being tuned for it (a cache-oblivious transpose). Each
+ * block is transposed into a buffer on the stack and copied out row by row,
+ * so only the reads are strided. With `SGLTY_ENABLE_X86_KERNELS` it is
+ * transposed in registers: 8×8 `float`-sized and 4×4 `double`-sized
+ * elements at a time with AVX (the AVX2 and AVX-512 variants of
+ * `ActiveIsa()`), 4×4 and 2×2 with SSE2. Otherwise, and for other element
+ * sizes and the edges of the array, elements are moved one at a time.
+ *
+ * `Expr::Assign()` uses it whenever a contiguous matrix is materialized in
+ * the other layout: `Trp(a)` into a matrix of the same major, `Reorder()`
+ * or a matrix converted to the other major.
+ *
+ * @tparam _Tp Element type.
+ * @param _src        Source array.
+ * @param _src_stride Elements between consecutive source rows.
+ * @param _dst        Destination array; must not overlap `_src`.
+ * @param _dst_stride Elements between consecutive destination rows.
+ * @param _rows       Source rows (destination columns).
+ * @param _cols       Source columns (destination rows).
+ */
+template <typename _Tp>
+void Transpose(const _Tp* _src,
+               std::size_t _src_stride,
+               _Tp* _dst,
+               std::size_t _dst_stride,
+               std::size_t _rows,
+               std::size_t _cols);
+
+/**
+ * @brief Transposes an `_n` × `_n` array in place.
+ *
+ * Mirror pairs of `transpose_block`-sized blocks are swapped through one
+ * block-sized buffer on the stack, with the same in-register kernels as
+ * `Transpose()`; no second `_n` × `_n` buffer is needed. Backs
+ * `Matrix::TransposeInPlace()`.
+ *
+ * @tparam _Tp Element type.
+ * @param _p      First element of the array.
+ * @param _n      Side length.
+ * @param _stride Elements between consecutive rows (at least `_n`).
+ */
+template <typename _Tp>
+void TransposeInPlace(_Tp* _p, std::size_t _n, std::size_t _stride);
+
+}  // namespace Sglty::Kernel
+
+#include "Impl/Transpose.tpp"
+
+// Singularity/Kernel/Transpose.hpp
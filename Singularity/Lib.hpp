@@ -1,5 +1,8 @@
 #pragma once
 
+#include "Config.hpp"
+#include "Fwd.hpp"
+
 #include "Types/Matrix.hpp"
 
 #include "Core/Enums.hpp"
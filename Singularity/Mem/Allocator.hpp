@@ -0,0 +1,111 @@
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+#include <type_traits>
+
+#include "Pool.hpp"
+
+namespace Sglty::Mem {
+
+/**
+ * @brief Returns the resource new `Allocator`s on this thread draw from.
+ *
+ * The innermost active `ArenaScope`'s arena, or `LocalPool()` if there is
+ * none.
+ */
+std::pmr::memory_resource* CurrentResource();
+
+/**
+ * @brief Default allocator of heap-backed cores.
+ *
+ * A stateful allocator bound to a `std::pmr::memory_resource`. A
+ * default-constructed allocator binds to `CurrentResource()`, which makes
+ * matrix storage come from the calling thread's pool, or from an arena while
+ * an `ArenaScope` is active. Copy-constructing a container picks up the
+ * resource that is current at that point rather than the source's, so copies
+ * made inside a scope are temporaries of that scope too.
+ *
+ * Storage is aligned to at least `Pool::alignment`.
+ *
+ * @tparam _Tp The value type.
+ */
+template <typename _Tp>
+class Allocator {
+ public:
+  using value_type = _Tp;
+
+  using propagate_on_container_copy_assignment = std::false_type;
+  using propagate_on_container_move_assignment = std::false_type;
+  using propagate_on_container_swap            = std::false_type;
+
+  /// Binds to `CurrentResource()`.
+  Allocator() noexcept;
+
+  /// Binds to `_resource`.
+  explicit Allocator(std::pmr::memory_resource* _resource) noexcept;
+
+  /// Rebinding copy; shares the resource.
+  template <typename _Up>
+  Allocator(const Allocator<_Up>& _other) noexcept;
+
+  /**
+   * @brief Allocates storage for `_n` objects.
+   *
+   * @throws std::bad_alloc if the resource is exhausted.
+   */
+  _Tp* allocate(std::size_t _n);
+
+  /// Returns storage obtained from `allocate(_n)`.
+  void deallocate(_Tp* _p, std::size_t _n);
+
+  /// Binds copies of a container to the then-current resource.
+  Allocator select_on_container_copy_construction() const;
+
+  /// Returns the bound resource.
+  std::pmr::memory_resource* Resource() const noexcept;
+
+  /// Alignment of every allocation.
+  constexpr static std::size_t alignment =
+      alignof(_Tp) > Pool::alignment ? alignof(_Tp) : Pool::alignment;
+
+ private:
+  std::pmr::memory_resource* _m_resource;
+};
+
+template <typename _Tp, typename _Up>
+bool operator==(const Allocator<_Tp>& _lhs, const Allocator<_Up>& _rhs);
+
+template <typename _Tp, typename _Up>
+bool operator!=(const Allocator<_Tp>& _lhs, const Allocator<_Up>& _rhs);
+
+/**
+ * @brief Whether cores should initialize storage from `_Alloc` in parallel.
+ *
+ * True if `_Alloc::parallel_first_touch` is true. Cores then value-initialize
+ * new storage with `Exec::ParallelFor()` over the outer dimension, the same
+ * partitioning parallel evaluation uses, so that under a first-touch NUMA
+ * policy each page is placed on the node of the thread that will process it.
+ *
+ * @tparam _Alloc The allocator type.
+ */
+template <typename _Alloc>
+extern const bool parallel_first_touch_v;
+
+namespace Impl {
+
+/**
+ * @brief Replaces this thread's current resource, returning the previous one.
+ *
+ * `nullptr` selects `LocalPool()`. Used by `ArenaScope`.
+ */
+std::pmr::memory_resource* SetCurrentResource(
+    std::pmr::memory_resource* _resource);
+
+}  // namespace Impl
+
+}  // namespace Sglty::Mem
+
+#include "Impl/Allocator.tpp"
+
+// Singularity/Mem/Allocator.hpp
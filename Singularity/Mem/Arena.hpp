@@ -0,0 +1,126 @@
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+#include "Pool.hpp"
+
+namespace Sglty::Mem {
+
+/**
+ * @brief Bump allocator for short-lived temporaries.
+ *
+ * Memory is carved sequentially out of large blocks obtained from an upstream
+ * resource; freeing is a no-op and space is reclaimed all at once by
+ * `Rewind()` or `Reset()`. Blocks are kept, so once an arena has grown to the
+ * working set of a loop body, further iterations allocate nothing.
+ *
+ * Usually used through `ArenaScope`. Not thread-safe: an arena belongs to one
+ * thread at a time.
+ */
+class Arena : public std::pmr::memory_resource {
+ public:
+  /// A position in the arena, see `Position()` and `Rewind()`.
+  struct Mark {
+    std::size_t block  = 0;
+    std::size_t offset = 0;
+  };
+
+  /**
+   * @brief Creates an empty arena.
+   *
+   * @param _block_size Minimum size of each block requested from upstream.
+   * @param _upstream   Resource the blocks come from; defaults to the calling
+   * thread's `LocalPool()`.
+   */
+  explicit Arena(std::size_t _block_size = 1 << 20,
+                 std::pmr::memory_resource* _upstream = nullptr);
+
+  Arena(const Arena&)            = delete;
+  Arena& operator=(const Arena&) = delete;
+
+  /// Returns all blocks to the upstream resource.
+  ~Arena() override;
+
+  /// Returns the current allocation position.
+  Mark Position() const;
+
+  /// Frees everything allocated after `_mark` was taken.
+  void Rewind(Mark _mark);
+
+  /// Frees everything, keeping the blocks for reuse.
+  void Reset();
+
+  /// Frees everything and returns the blocks to the upstream resource.
+  void Release();
+
+  /// Returns the usage counters; `cached` is the unused block capacity.
+  PoolStats Stats() const;
+
+ protected:
+  void* do_allocate(std::size_t _bytes, std::size_t _alignment) override;
+
+  void do_deallocate(void* _p,
+                     std::size_t _bytes,
+                     std::size_t _alignment) override;
+
+  bool do_is_equal(
+      const std::pmr::memory_resource& _other) const noexcept override;
+
+ private:
+  struct Chunk {
+    void* data;
+    std::size_t size;
+  };
+
+  std::size_t _m_block_size;
+  std::pmr::memory_resource* _m_upstream;
+  std::vector<Chunk> _m_blocks;
+  Mark _m_position;
+  PoolStats _m_stats;
+
+  std::size_t _m_Used() const;
+};
+
+/**
+ * @brief Routes the calling thread's temporaries into an arena.
+ *
+ * While a scope is alive, every `Mem::Allocator` created on this thread
+ * (and with it every `Core::Heap` matrix, including results of `Evaluate()`,
+ * `Cast()` and `Reorder()`) allocates from the arena. When the scope ends the
+ * previous resource is restored and the arena is rewound to where it was
+ * when the scope began, so scopes nest.
+ *
+ * Matrices allocated inside a scope must not outlive it.
+ *
+ * Example Usage:
+ * ```
+ * Sglty::Mem::Arena arena;
+ * for (int step = 0; step < steps; step++) {
+ *   Sglty::Mem::ArenaScope scope(arena);
+ *   auto tmp = Sglty::Evaluate(a * b);
+ *   acc += tmp;  // `acc` lives outside the scope and owns its own storage
+ * }
+ * ```
+ */
+class ArenaScope {
+ public:
+  explicit ArenaScope(Arena& _arena);
+
+  ArenaScope(const ArenaScope&)            = delete;
+  ArenaScope& operator=(const ArenaScope&) = delete;
+
+  ~ArenaScope();
+
+ private:
+  Arena& _m_arena;
+  Arena::Mark _m_mark;
+  std::pmr::memory_resource* _m_previous;
+};
+
+}  // namespace Sglty::Mem
+
+#include "Impl/Arena.tpp"
+
+// Singularity/Mem/Arena.hpp
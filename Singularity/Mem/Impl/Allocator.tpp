@@ -0,0 +1,85 @@
+#pragma once
+
+#include "../Allocator.hpp"
+
+namespace Sglty::Mem {
+
+namespace Impl {
+
+template <typename _Alloc, typename = void>
+struct ParallelFirstTouch : std::false_type {};
+
+template <typename _Alloc>
+struct ParallelFirstTouch<_Alloc,
+                          std::void_t<decltype(_Alloc::parallel_first_touch)>>
+    : std::bool_constant<_Alloc::parallel_first_touch> {};
+
+inline std::pmr::memory_resource*& CurrentResourceSlot() {
+  thread_local std::pmr::memory_resource* resource = nullptr;
+  return resource;
+}
+
+inline std::pmr::memory_resource* SetCurrentResource(
+    std::pmr::memory_resource* _resource) {
+  std::pmr::memory_resource* previous = CurrentResourceSlot();
+  CurrentResourceSlot()               = _resource;
+  return previous;
+}
+
+}  // namespace Impl
+
+template <typename _Alloc>
+constexpr inline bool parallel_first_touch_v =
+    Impl::ParallelFirstTouch<_Alloc>::value;
+
+inline std::pmr::memory_resource* CurrentResource() {
+  std::pmr::memory_resource* resource = Impl::CurrentResourceSlot();
+  return resource ? resource : &LocalPool();
+}
+
+template <typename _Tp>
+Allocator<_Tp>::Allocator() noexcept : _m_resource(CurrentResource()) {}
+
+template <typename _Tp>
+Allocator<_Tp>::Allocator(std::pmr::memory_resource* _resource) noexcept
+    : _m_resource(_resource) {}
+
+template <typename _Tp>
+template <typename _Up>
+Allocator<_Tp>::Allocator(const Allocator<_Up>& _other) noexcept
+    : _m_resource(_other.Resource()) {}
+
+template <typename _Tp>
+_Tp* Allocator<_Tp>::allocate(std::size_t _n) {
+  return static_cast<_Tp*>(_m_resource->allocate(_n * sizeof(_Tp), alignment));
+}
+
+template <typename _Tp>
+void Allocator<_Tp>::deallocate(_Tp* _p, std::size_t _n) {
+  _m_resource->deallocate(_p, _n * sizeof(_Tp), alignment);
+}
+
+template <typename _Tp>
+Allocator<_Tp> Allocator<_Tp>::select_on_container_copy_construction() const {
+  return Allocator();
+}
+
+template <typename _Tp>
+std::pmr::memory_resource* Allocator<_Tp>::Resource() const noexcept {
+  return _m_resource;
+}
+
+template <typename _Tp, typename _Up>
+bool operator==(const Allocator<_Tp>& _lhs, const Allocator<_Up>& _rhs) {
+  return _lhs.Resource() == _rhs.Resource() ||
+         _lhs.Resource()->is_equal(*_rhs.Resource());
+}
+
+template <typename _Tp, typename _Up>
+bool operator!=(const Allocator<_Tp>& _lhs, const Allocator<_Up>& _rhs) {
+  return !(_lhs == _rhs);
+}
+
+}  // namespace Sglty::Mem
+
+// Singularity/Mem/Impl/Allocator.tpp
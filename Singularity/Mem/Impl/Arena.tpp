@@ -0,0 +1,121 @@
+#pragma once
+
+#include "../Arena.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+#include "../Allocator.hpp"
+
+namespace Sglty::Mem {
+
+inline Arena::Arena(std::size_t _block_size,
+                    std::pmr::memory_resource* _upstream)
+    : _m_block_size(std::max<std::size_t>(_block_size, Pool::alignment)),
+      _m_upstream(_upstream ? _upstream : &LocalPool()) {}
+
+inline Arena::~Arena() {
+  Release();
+}
+
+inline Arena::Mark Arena::Position() const {
+  return _m_position;
+}
+
+inline void Arena::Rewind(Mark _mark) {
+  _m_position      = _mark;
+  _m_stats.in_use  = _m_Used();
+}
+
+inline void Arena::Reset() {
+  Rewind(Mark{});
+}
+
+inline void Arena::Release() {
+  for (const Chunk& chunk : _m_blocks) {
+    _m_upstream->deallocate(chunk.data, chunk.size, Pool::alignment);
+  }
+  _m_blocks.clear();
+  _m_position = Mark{};
+  _m_stats    = PoolStats{};
+}
+
+inline PoolStats Arena::Stats() const {
+  PoolStats stats = _m_stats;
+  stats.cached    = 0;
+  for (const Chunk& chunk : _m_blocks) {
+    stats.cached += chunk.size;
+  }
+  stats.cached -= stats.in_use;
+  return stats;
+}
+
+inline void* Arena::do_allocate(std::size_t _bytes, std::size_t _alignment) {
+  const auto fits = [&](std::size_t block, std::size_t& offset) {
+    const Chunk& chunk = _m_blocks[block];
+    const auto base    = reinterpret_cast<std::uintptr_t>(chunk.data);
+    const auto aligned = (base + offset + _alignment - 1) & ~(_alignment - 1);
+    offset             = aligned - base;
+    return offset <= chunk.size && _bytes <= chunk.size - offset;
+  };
+
+  // Later blocks are only reused from their start, so skipping ahead never
+  // overlaps memory that is still in use.
+  for (std::size_t b = _m_position.block; b < _m_blocks.size(); b++) {
+    std::size_t offset = b == _m_position.block ? _m_position.offset : 0;
+    if (fits(b, offset)) {
+      _m_position = {b, offset + _bytes};
+      break;
+    }
+    if (b + 1 == _m_blocks.size()) {
+      _m_position = {_m_blocks.size(), 0};
+    }
+  }
+
+  if (_m_position.block == _m_blocks.size()) {
+    const std::size_t size =
+        std::max(_m_block_size, _bytes + std::max(_alignment, Pool::alignment));
+    _m_blocks.push_back(
+        {_m_upstream->allocate(size, Pool::alignment), size});
+    _m_stats.system_allocations++;
+
+    std::size_t offset = 0;
+    fits(_m_blocks.size() - 1, offset);
+    _m_position = {_m_blocks.size() - 1, offset + _bytes};
+  }
+
+  _m_stats.in_use = _m_Used();
+  _m_stats.peak   = std::max(_m_stats.peak, _m_stats.in_use);
+
+  return static_cast<char*>(_m_blocks[_m_position.block].data) +
+         _m_position.offset - _bytes;
+}
+
+inline void Arena::do_deallocate(void*, std::size_t, std::size_t) {}
+
+inline bool Arena::do_is_equal(
+    const std::pmr::memory_resource& _other) const noexcept {
+  return this == &_other;
+}
+
+inline std::size_t Arena::_m_Used() const {
+  std::size_t used = 0;
+  for (std::size_t b = 0; b < _m_position.block && b < _m_blocks.size(); b++) {
+    used += _m_blocks[b].size;
+  }
+  return used + _m_position.offset;
+}
+
+inline ArenaScope::ArenaScope(Arena& _arena)
+    : _m_arena(_arena),
+      _m_mark(_arena.Position()),
+      _m_previous(Impl::SetCurrentResource(&_arena)) {}
+
+inline ArenaScope::~ArenaScope() {
+  Impl::SetCurrentResource(_m_previous);
+  _m_arena.Rewind(_m_mark);
+}
+
+}  // namespace Sglty::Mem
+
+// Singularity/Mem/Impl/Arena.tpp
@@ -0,0 +1,204 @@
+#pragma once
+
+#include "../Paged.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <new>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+
+namespace Sglty::Mem {
+
+namespace Impl {
+
+constexpr std::size_t huge_page_size = std::size_t(2) << 20;
+
+inline std::size_t PageSize() {
+  static const std::size_t size =
+      static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+  return size;
+}
+
+inline void* MapAnonymous(std::size_t _length, int _flags) {
+  void* addr = ::mmap(nullptr,
+                      _length,
+                      PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS | _flags,
+                      -1,
+                      0);
+  return addr == MAP_FAILED ? nullptr : addr;
+}
+
+/**
+ * @brief Maps `_length` bytes aligned to `huge_page_size` by over-mapping and
+ * trimming, and advises the kernel to back them with huge pages.
+ */
+inline void* MapTransparent(std::size_t _length) {
+  auto* raw = static_cast<char*>(MapAnonymous(_length + huge_page_size, 0));
+  if (!raw) {
+    return nullptr;
+  }
+
+  const auto base = reinterpret_cast<std::uintptr_t>(raw);
+  const std::size_t head =
+      (huge_page_size - base % huge_page_size) % huge_page_size;
+  char* addr = raw + head;
+
+  if (head != 0) {
+    ::munmap(raw, head);
+  }
+  ::munmap(addr + _length, huge_page_size - head);
+
+#if defined(MADV_HUGEPAGE)
+  ::madvise(addr, _length, MADV_HUGEPAGE);
+#endif
+  return addr;
+}
+
+/**
+ * @brief Interleaves a region over all nodes the process may use.
+ *
+ * Uses the raw system calls so no NUMA library is required; failures (no
+ * NUMA support, restricted containers) leave the default policy in place.
+ */
+inline void Interleave(void* _addr, std::size_t _length) {
+#if defined(__linux__) && defined(SYS_mbind) && defined(SYS_get_mempolicy)
+  constexpr int mpol_interleave     = 3;
+  constexpr int mpol_f_mems_allowed = 1 << 2;
+  constexpr unsigned long max_node  = 1024;
+
+  unsigned long mask[max_node / (8 * sizeof(unsigned long))] = {};
+  int mode = 0;
+  if (::syscall(SYS_get_mempolicy,
+                &mode,
+                mask,
+                max_node,
+                nullptr,
+                mpol_f_mems_allowed) != 0) {
+    return;
+  }
+  ::syscall(SYS_mbind, _addr, _length, mpol_interleave, mask, max_node, 0);
+#else
+  (void)_addr;
+  (void)_length;
+#endif
+}
+
+}  // namespace Impl
+
+inline PagedResource::PagedResource(Pages _pages, Numa _numa)
+    : _m_pages(_pages), _m_numa(_numa) {}
+
+inline PoolStats PagedResource::Stats() const {
+  std::lock_guard<std::mutex> lock(_m_mutex);
+  return _m_stats;
+}
+
+inline std::size_t PagedResource::HugePageFallbacks() const {
+  std::lock_guard<std::mutex> lock(_m_mutex);
+  return _m_fallbacks;
+}
+
+inline void* PagedResource::do_allocate(std::size_t _bytes,
+                                        std::size_t _alignment) {
+  const std::size_t length = _m_Length(_bytes);
+  if (_alignment > Impl::PageSize()) {
+    throw std::bad_alloc();
+  }
+
+  void* addr    = nullptr;
+  bool fallback = false;
+
+  if (_m_pages == Pages::Huge2M) {
+#if defined(MAP_HUGETLB) && defined(MAP_HUGE_SHIFT)
+    addr = Impl::MapAnonymous(length, MAP_HUGETLB | (21 << MAP_HUGE_SHIFT));
+#endif
+    fallback = addr == nullptr;
+  }
+  if (!addr) {
+    addr = _m_pages == Pages::Default ? Impl::MapAnonymous(length, 0)
+                                      : Impl::MapTransparent(length);
+  }
+  if (!addr) {
+    throw std::bad_alloc();
+  }
+
+  // Placement must be set before the first write faults the pages in.
+  if (_m_numa == Numa::Interleave) {
+    Impl::Interleave(addr, length);
+  }
+
+  std::lock_guard<std::mutex> lock(_m_mutex);
+  _m_fallbacks += fallback;
+  _m_stats.system_allocations++;
+  _m_stats.in_use += length;
+  _m_stats.peak = std::max(_m_stats.peak, _m_stats.in_use);
+  return addr;
+}
+
+inline void PagedResource::do_deallocate(void* _p,
+                                         std::size_t _bytes,
+                                         std::size_t) {
+  const std::size_t length = _m_Length(_bytes);
+  ::munmap(_p, length);
+
+  std::lock_guard<std::mutex> lock(_m_mutex);
+  _m_stats.in_use -= length;
+}
+
+inline bool PagedResource::do_is_equal(
+    const std::pmr::memory_resource& _other) const noexcept {
+  return this == &_other;
+}
+
+inline std::size_t PagedResource::_m_Length(std::size_t _bytes) const {
+  const std::size_t page =
+      _m_pages == Pages::Default ? Impl::PageSize() : Impl::huge_page_size;
+  return (std::max<std::size_t>(_bytes, 1) + page - 1) / page * page;
+}
+
+template <Pages _pages, Numa _numa>
+Pool& PagedPool() {
+  // Never destroyed: matrices in other static objects may release their
+  // storage during exit.
+  static Pool* pool = new Pool(new PagedResource(_pages, _numa));
+  return *pool;
+}
+
+template <typename _Tp, Pages _pages, Numa _numa>
+template <typename _Up>
+PagedAllocator<_Tp, _pages, _numa>::PagedAllocator(
+    const PagedAllocator<_Up, _pages, _numa>&) noexcept {}
+
+template <typename _Tp, Pages _pages, Numa _numa>
+_Tp* PagedAllocator<_Tp, _pages, _numa>::allocate(std::size_t _n) {
+  return static_cast<_Tp*>(
+      PagedPool<_pages, _numa>().allocate(_n * sizeof(_Tp), Pool::alignment));
+}
+
+template <typename _Tp, Pages _pages, Numa _numa>
+void PagedAllocator<_Tp, _pages, _numa>::deallocate(_Tp* _p, std::size_t _n) {
+  PagedPool<_pages, _numa>().deallocate(_p, _n * sizeof(_Tp), Pool::alignment);
+}
+
+template <typename _Tp, typename _Up, Pages _pages, Numa _numa>
+constexpr bool operator==(const PagedAllocator<_Tp, _pages, _numa>&,
+                          const PagedAllocator<_Up, _pages, _numa>&) {
+  return true;
+}
+
+template <typename _Tp, typename _Up, Pages _pages, Numa _numa>
+constexpr bool operator!=(const PagedAllocator<_Tp, _pages, _numa>&,
+                          const PagedAllocator<_Up, _pages, _numa>&) {
+  return false;
+}
+
+}  // namespace Sglty::Mem
+
+// Singularity/Mem/Impl/Paged.tpp
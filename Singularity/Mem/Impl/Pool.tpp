@@ -0,0 +1,189 @@
+#pragma once
+
+#include "../Pool.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace Sglty::Mem {
+
+namespace Impl {
+
+/**
+ * @brief Size class of a request: four classes per power of two, from
+ * `Pool::alignment` bytes up.
+ */
+struct SizeClass {
+  std::size_t index;
+  std::size_t bytes;
+};
+
+inline SizeClass ClassOf(std::size_t _bytes) {
+  const std::size_t n = std::max(_bytes, Pool::alignment) - 1;
+
+  std::size_t log2 = 0;
+  while ((n >> log2) > 1) {
+    log2++;
+  }
+
+  const std::size_t sub = (n >> (log2 - 2)) & 3;
+  return {(log2 - 5) * 4 + sub, (4 + sub + 1) << (log2 - 2)};
+}
+
+/// Inverse of `ClassOf()`: the block size of a class index.
+constexpr std::size_t ClassBytes(std::size_t _index) {
+  const std::size_t log2 = _index / 4 + 5;
+  return (4 + _index % 4 + 1) << (log2 - 2);
+}
+
+}  // namespace Impl
+
+inline Pool::Pool(std::pmr::memory_resource* _upstream)
+    : _m_upstream(_upstream ? _upstream : std::pmr::new_delete_resource()) {}
+
+inline Pool::~Pool() {
+  Trim();
+}
+
+inline PoolStats Pool::Stats() const {
+  std::lock_guard<std::mutex> lock(_m_mutex);
+  return _m_stats;
+}
+
+inline void Pool::ResetPeak() {
+  std::lock_guard<std::mutex> lock(_m_mutex);
+  _m_stats.peak = _m_stats.in_use;
+}
+
+inline void Pool::Trim() {
+  std::lock_guard<std::mutex> lock(_m_mutex);
+  for (std::size_t c = 0; c < class_count; c++) {
+    while (Block* block = _m_free[c]) {
+      _m_free[c] = block->next;
+      _m_upstream->deallocate(block, Impl::ClassBytes(c), alignment);
+    }
+  }
+  _m_stats.cached = 0;
+}
+
+inline void* Pool::do_allocate(std::size_t _bytes, std::size_t _alignment) {
+  if (_alignment > alignment) {
+    {
+      std::lock_guard<std::mutex> lock(_m_mutex);
+      _m_stats.system_allocations++;
+    }
+    return _m_upstream->allocate(_bytes, _alignment);
+  }
+
+  const Impl::SizeClass size = Impl::ClassOf(_bytes);
+
+  std::lock_guard<std::mutex> lock(_m_mutex);
+  _m_stats.in_use += size.bytes;
+  _m_stats.peak = std::max(_m_stats.peak, _m_stats.in_use);
+
+  if (Block* block = _m_free[size.index]) {
+    _m_free[size.index] = block->next;
+    _m_stats.cached -= size.bytes;
+    return block;
+  }
+
+  _m_stats.system_allocations++;
+  try {
+    return _m_upstream->allocate(size.bytes, alignment);
+  } catch (...) {
+    _m_stats.in_use -= size.bytes;
+    throw;
+  }
+}
+
+inline void Pool::do_deallocate(void* _p,
+                                std::size_t _bytes,
+                                std::size_t _alignment) {
+  if (_alignment > alignment) {
+    _m_upstream->deallocate(_p, _bytes, _alignment);
+    return;
+  }
+
+  const Impl::SizeClass size = Impl::ClassOf(_bytes);
+
+  std::lock_guard<std::mutex> lock(_m_mutex);
+  auto* block         = static_cast<Block*>(_p);
+  block->next         = _m_free[size.index];
+  _m_free[size.index] = block;
+  _m_stats.in_use -= size.bytes;
+  _m_stats.cached += size.bytes;
+}
+
+inline bool Pool::do_is_equal(
+    const std::pmr::memory_resource& _other) const noexcept {
+  return this == &_other;
+}
+
+namespace Impl {
+
+/**
+ * @brief Process-wide pool the thread pools draw from and return their
+ * cached blocks to.
+ *
+ * Never destroyed, like the idle pools below: threads, including the workers
+ * of `Exec::ParallelFor()`, may still exit during static destruction.
+ */
+inline Pool& SharedPool() {
+  static Pool* pool = new Pool;
+  return *pool;
+}
+
+/// Pools of exited threads, reused by the threads started after them.
+struct IdlePools {
+  std::mutex mutex;
+  std::vector<Pool*> pools;
+
+  /// Number of pools created; `pools` has room for all of them.
+  std::size_t created = 0;
+};
+
+inline IdlePools& Idle() {
+  static IdlePools* idle = new IdlePools;
+  return *idle;
+}
+
+/// Retires the pool of an exiting thread.
+struct RetirePool {
+  void operator()(Pool* _pool) const noexcept {
+    _pool->Trim();
+
+    IdlePools& idle = Idle();
+    std::lock_guard<std::mutex> lock(idle.mutex);
+    idle.pools.push_back(_pool);
+  }
+};
+
+/// Returns an idle pool, or a new one if every pool is in use.
+inline std::unique_ptr<Pool, RetirePool> AcquirePool() {
+  IdlePools& idle = Idle();
+  std::lock_guard<std::mutex> lock(idle.mutex);
+  if (!idle.pools.empty()) {
+    Pool* pool = idle.pools.back();
+    idle.pools.pop_back();
+    return std::unique_ptr<Pool, RetirePool>(pool);
+  }
+
+  // Reserve first so retiring the pool never allocates.
+  idle.pools.reserve(idle.created + 1);
+  auto pool = std::unique_ptr<Pool, RetirePool>(new Pool(&SharedPool()));
+  idle.created++;
+  return pool;
+}
+
+}  // namespace Impl
+
+inline Pool& LocalPool() {
+  thread_local std::unique_ptr<Pool, Impl::RetirePool> pool =
+      Impl::AcquirePool();
+  return *pool;
+}
+
+}  // namespace Sglty::Mem
+
+// Singularity/Mem/Impl/Pool.tpp
@@ -0,0 +1,111 @@
+#pragma once
+
+#include "../Scratch.hpp"
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+namespace Sglty::Mem {
+
+namespace Impl {
+
+/// The calling thread's scratch block.
+struct ScratchBlock {
+  unsigned char* data = nullptr;
+  std::size_t size    = 0;
+  bool busy           = false;
+
+  ~ScratchBlock() { Free(data); }
+
+  static unsigned char* Allocate(std::size_t _bytes) {
+    return static_cast<unsigned char*>(
+        ::operator new(_bytes, std::align_val_t(Scratch::alignment)));
+  }
+
+  static void Free(unsigned char* _data) {
+    ::operator delete(_data, std::align_val_t(Scratch::alignment));
+  }
+
+  static ScratchBlock& Local() {
+    thread_local ScratchBlock block;
+    return block;
+  }
+};
+
+}  // namespace Impl
+
+template <typename _Tp>
+constexpr std::size_t Scratch::Bytes(std::size_t _count) {
+  return (_count * sizeof(_Tp) + alignment - 1) / alignment * alignment;
+}
+
+inline Scratch::Scratch(std::size_t _bytes)
+    : _m_data(nullptr), _m_used(0), _m_owned(false) {
+  Impl::ScratchBlock& block = Impl::ScratchBlock::Local();
+  if (block.busy) {
+    _m_data  = Impl::ScratchBlock::Allocate(_bytes);
+    _m_owned = true;
+    return;
+  }
+
+  if (block.size < _bytes) {
+    Impl::ScratchBlock::Free(block.data);
+    block.data = nullptr;
+    block.size = 0;
+    block.data = Impl::ScratchBlock::Allocate(_bytes);
+    block.size = _bytes;
+  }
+  block.busy = true;
+  _m_data    = block.data;
+}
+
+inline Scratch::~Scratch() {
+  if (_m_owned) {
+    Impl::ScratchBlock::Free(_m_data);
+  } else {
+    Impl::ScratchBlock::Local().busy = false;
+  }
+}
+
+inline void* Scratch::Take(std::size_t _bytes) {
+  void* ret = _m_data + _m_used;
+  _m_used += _bytes;
+  return ret;
+}
+
+template <typename _Tp>
+ScratchArray<_Tp>::ScratchArray(Scratch& _scratch, std::size_t _count)
+    : _m_data(static_cast<_Tp*>(
+          _scratch.Take(Scratch::Bytes<_Tp>(_count)))),
+      _m_count(_count) {
+  static_assert(alignof(_Tp) <= Scratch::alignment,
+                "Error: `_Tp` is over-aligned for `Scratch`.");
+
+  for (std::size_t i = 0; i < _count; i++) {
+    ::new (static_cast<void*>(_m_data + i)) _Tp();
+  }
+}
+
+template <typename _Tp>
+ScratchArray<_Tp>::~ScratchArray() {
+  if constexpr (!std::is_trivially_destructible_v<_Tp>) {
+    for (std::size_t i = 0; i < _m_count; i++) {
+      _m_data[i].~_Tp();
+    }
+  }
+}
+
+template <typename _Tp>
+_Tp* ScratchArray<_Tp>::data() const {
+  return _m_data;
+}
+
+template <typename _Tp>
+_Tp& ScratchArray<_Tp>::operator[](std::size_t _index) const {
+  return _m_data[_index];
+}
+
+}  // namespace Sglty::Mem
+
+// Singularity/Mem/Impl/Scratch.tpp
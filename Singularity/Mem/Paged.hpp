@@ -0,0 +1,180 @@
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+#include <mutex>
+#include <type_traits>
+
+#include "Pool.hpp"
+
+namespace Sglty::Mem {
+
+/**
+ * @brief Page size policy of a `PagedResource`.
+ */
+enum class Pages {
+  /// Regular pages.
+  Default,
+
+  /// Regular mapping, 2 MB aligned and advised for transparent huge pages
+  /// (`MADV_HUGEPAGE`).
+  Transparent,
+
+  /// Explicit 2 MB pages (`MAP_HUGETLB`). Falls back to `Transparent` if the
+  /// system has no free huge pages.
+  Huge2M
+};
+
+/**
+ * @brief NUMA placement policy of a `PagedResource`.
+ */
+enum class Numa {
+  /// System policy: a page lands on the node of the thread that first writes
+  /// it.
+  Default,
+
+  /// Pages are spread round-robin over all allowed nodes, for data that every
+  /// thread reads.
+  Interleave,
+
+  /// System policy, and cores initialize new storage in parallel with the
+  /// same partitioning as parallel evaluation (contiguous ranges of the outer
+  /// dimension via `Exec::ParallelFor()`), so each page lands on the node of
+  /// the thread that will later process it.
+  FirstTouch
+};
+
+/**
+ * @brief Memory resource that maps storage directly from the kernel.
+ *
+ * Every request becomes its own `mmap` region, rounded up to the page size of
+ * the policy, with huge page and NUMA placement applied before the memory is
+ * first touched. Placement requests the kernel rejects (e.g. without NUMA
+ * support) are ignored; the memory is still usable.
+ *
+ * Mapping is expensive, so the resource is normally used as the upstream of a
+ * `Pool`, see `PagedPool()`. Thread-safe. POSIX only; huge pages and NUMA
+ * placement require Linux.
+ */
+class PagedResource : public std::pmr::memory_resource {
+ public:
+  /**
+   * @brief Creates a resource with the given policies.
+   *
+   * @param _pages Page size policy.
+   * @param _numa  NUMA placement policy.
+   */
+  PagedResource(Pages _pages, Numa _numa);
+
+  PagedResource(const PagedResource&)            = delete;
+  PagedResource& operator=(const PagedResource&) = delete;
+
+  /// Returns the usage counters; `system_allocations` counts mappings.
+  PoolStats Stats() const;
+
+  /// Number of `Huge2M` requests that fell back to transparent huge pages.
+  std::size_t HugePageFallbacks() const;
+
+ protected:
+  void* do_allocate(std::size_t _bytes, std::size_t _alignment) override;
+
+  void do_deallocate(void* _p,
+                     std::size_t _bytes,
+                     std::size_t _alignment) override;
+
+  bool do_is_equal(
+      const std::pmr::memory_resource& _other) const noexcept override;
+
+ private:
+  Pages _m_pages;
+  Numa _m_numa;
+
+  mutable std::mutex _m_mutex;
+  PoolStats _m_stats;
+  std::size_t _m_fallbacks = 0;
+
+  std::size_t _m_Length(std::size_t _bytes) const;
+};
+
+/**
+ * @brief Returns the process-wide pool of mapped storage for a policy.
+ *
+ * A `Pool` on top of a `PagedResource`, so recycled blocks skip the kernel.
+ * Both live until the process exits.
+ *
+ * @tparam _pages Page size policy.
+ * @tparam _numa  NUMA placement policy.
+ */
+template <Pages _pages, Numa _numa>
+Pool& PagedPool();
+
+/**
+ * @brief Allocator policy for heap-backed cores with huge page and NUMA
+ * placement.
+ *
+ * A stateless allocator drawing from `PagedPool<_pages, _numa>()`. The
+ * policies are part of the type and survive `std::allocator_traits`
+ * rebinding, so `Cast()`, `Reorder()` and expression results of a
+ * `Core::Heap` using it keep the placement. Blocks are at least one (huge)
+ * page, so this is meant for large matrices.
+ *
+ * Example Usage:
+ * ```
+ * using Alloc = Sglty::Mem::PagedAllocator<float,
+ *                                          Sglty::Mem::Pages::Transparent,
+ *                                          Sglty::Mem::Numa::FirstTouch>;
+ * Sglty::Types::Matrix<Sglty::Core::Heap<float, 8192, 8192, Major::Row,
+ *                                        Alloc>> weights;
+ * ```
+ *
+ * @tparam _Tp    The value type.
+ * @tparam _pages Page size policy.
+ * @tparam _numa  NUMA placement policy.
+ */
+template <typename _Tp,
+          Pages _pages = Pages::Transparent,
+          Numa _numa   = Numa::Default>
+class PagedAllocator {
+ public:
+  using value_type = _Tp;
+
+  using propagate_on_container_move_assignment = std::true_type;
+  using is_always_equal                        = std::true_type;
+
+  template <typename _Up>
+  struct rebind {
+    using other = PagedAllocator<_Up, _pages, _numa>;
+  };
+
+  /// Whether cores should initialize new storage in parallel.
+  constexpr static bool parallel_first_touch = _numa == Numa::FirstTouch;
+
+  PagedAllocator() noexcept = default;
+
+  template <typename _Up>
+  PagedAllocator(const PagedAllocator<_Up, _pages, _numa>&) noexcept;
+
+  /**
+   * @brief Allocates storage for `_n` objects.
+   *
+   * @throws std::bad_alloc if the memory cannot be mapped.
+   */
+  _Tp* allocate(std::size_t _n);
+
+  /// Returns storage obtained from `allocate(_n)`.
+  void deallocate(_Tp* _p, std::size_t _n);
+};
+
+template <typename _Tp, typename _Up, Pages _pages, Numa _numa>
+constexpr bool operator==(const PagedAllocator<_Tp, _pages, _numa>&,
+                          const PagedAllocator<_Up, _pages, _numa>&);
+
+template <typename _Tp, typename _Up, Pages _pages, Numa _numa>
+constexpr bool operator!=(const PagedAllocator<_Tp, _pages, _numa>&,
+                          const PagedAllocator<_Up, _pages, _numa>&);
+
+}  // namespace Sglty::Mem
+
+#include "Impl/Paged.tpp"
+
+// Singularity/Mem/Paged.hpp
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+#include <mutex>
+
+namespace Sglty::Mem {
+
+/**
+ * @brief Usage counters of a `Pool` or `Arena`.
+ */
+struct PoolStats {
+  /// Bytes currently handed out.
+  std::size_t in_use = 0;
+
+  /// Highest `in_use` since construction or the last `ResetPeak()`.
+  std::size_t peak = 0;
+
+  /// Bytes held for reuse and not handed out.
+  std::size_t cached = 0;
+
+  /// Number of requests forwarded to the system (or upstream) allocator.
+  std::size_t system_allocations = 0;
+};
+
+/**
+ * @brief Size-class memory pool for matrix storage.
+ *
+ * Requests are rounded up to one of four size classes per power of two (at
+ * most 25% slack) and served from per-class free lists. Freed blocks are kept
+ * for reuse instead of being returned to the system, so a loop that keeps
+ * creating and destroying matrices of the same shapes allocates from the
+ * system only during its first iteration. Blocks are aligned to
+ * `Pool::alignment`; requests for a stricter alignment bypass the pool.
+ *
+ * All member functions are thread-safe, so blocks may be freed on a different
+ * thread than the one that allocated them.
+ *
+ * @see LocalPool()
+ */
+class Pool : public std::pmr::memory_resource {
+ public:
+  /// Alignment of every pooled block (one cache line).
+  constexpr static std::size_t alignment = 64;
+
+  /**
+   * @brief Creates an empty pool.
+   *
+   * @param _upstream Resource new blocks come from; defaults to
+   * `std::pmr::new_delete_resource()`.
+   */
+  explicit Pool(std::pmr::memory_resource* _upstream = nullptr);
+
+  Pool(const Pool&)            = delete;
+  Pool& operator=(const Pool&) = delete;
+
+  /// Releases all cached blocks. Blocks still in use must not be freed later.
+  ~Pool() override;
+
+  /// Returns the current usage counters.
+  PoolStats Stats() const;
+
+  /// Sets the peak usage to the current usage.
+  void ResetPeak();
+
+  /// Returns all cached blocks to the upstream resource.
+  void Trim();
+
+ protected:
+  void* do_allocate(std::size_t _bytes, std::size_t _alignment) override;
+
+  void do_deallocate(void* _p,
+                     std::size_t _bytes,
+                     std::size_t _alignment) override;
+
+  bool do_is_equal(
+      const std::pmr::memory_resource& _other) const noexcept override;
+
+ private:
+  constexpr static std::size_t class_count = 256;
+
+  struct Block {
+    Block* next;
+  };
+
+  std::pmr::memory_resource* _m_upstream;
+  mutable std::mutex _m_mutex;
+  Block* _m_free[class_count] = {};
+  PoolStats _m_stats;
+};
+
+/**
+ * @brief Returns the calling thread's pool.
+ *
+ * Each thread, including the workers of `Exec::ParallelFor()`, gets its own
+ * pool, so parallel evaluation does not contend on a shared free list. The
+ * thread pools draw their blocks from one process-wide pool. When a thread
+ * exits, its pool returns its cached blocks there and is handed to the next
+ * thread that starts. Blocks still in use stay valid and may be freed on
+ * any thread.
+ */
+Pool& LocalPool();
+
+}  // namespace Sglty::Mem
+
+#include "Impl/Pool.tpp"
+
+// Singularity/Mem/Pool.hpp
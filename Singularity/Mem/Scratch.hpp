@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstddef>
+
+namespace Sglty::Mem {
+
+/**
+ * @brief Working memory of one kernel call, reused across calls on the same
+ * thread.
+ *
+ * Each thread keeps one block that grows to the largest request and is
+ * never shrunk, so a kernel called in a loop with the same shapes allocates
+ * only on its first iteration. A `Scratch` claims the whole block for its
+ * lifetime; a nested one (a kernel called while another holds the block)
+ * allocates a block of its own and frees it on destruction. Arrays are
+ * carved from the block with `ScratchArray`, each aligned to
+ * `Scratch::alignment`.
+ *
+ * Lighter than `Mem::Allocator` (no `<memory_resource>`), so the kernels on
+ * the core evaluation path can use it.
+ */
+class Scratch {
+ public:
+  /// Alignment of every array carved from the block (one cache line).
+  constexpr static std::size_t alignment = 64;
+
+  /**
+   * @brief Returns the bytes a `ScratchArray<_Tp>` of `_count` elements
+   * takes from a `Scratch`, padding included.
+   */
+  template <typename _Tp>
+  constexpr static std::size_t Bytes(std::size_t _count);
+
+  /**
+   * @brief Claims at least `_bytes` bytes.
+   *
+   * @param _bytes The sum of `Bytes()` over the arrays to be carved.
+   */
+  explicit Scratch(std::size_t _bytes);
+
+  Scratch(const Scratch&)            = delete;
+  Scratch& operator=(const Scratch&) = delete;
+
+  /// Releases the block to the thread, or frees it if it was not the
+  /// thread's.
+  ~Scratch();
+
+  /**
+   * @brief Returns the next `_bytes` bytes of the block.
+   *
+   * @param _bytes A multiple of `alignment`.
+   */
+  void* Take(std::size_t _bytes);
+
+ private:
+  unsigned char* _m_data;
+  std::size_t _m_used;
+  bool _m_owned;
+};
+
+/**
+ * @brief `_count` value-initialized elements of a `Scratch`, destroyed with
+ * the array.
+ *
+ * @tparam _Tp The element type; its alignment must not exceed
+ * `Scratch::alignment`.
+ */
+template <typename _Tp>
+class ScratchArray {
+ public:
+  ScratchArray(Scratch& _scratch, std::size_t _count);
+
+  ScratchArray(const ScratchArray&)            = delete;
+  ScratchArray& operator=(const ScratchArray&) = delete;
+
+  ~ScratchArray();
+
+  _Tp* data() const;
+
+  _Tp& operator[](std::size_t _index) const;
+
+ private:
+  _Tp* _m_data;
+  std::size_t _m_count;
+};
+
+}  // namespace Sglty::Mem
+
+#include "Impl/Scratch.tpp"
+
+// Singularity/Mem/Scratch.hpp
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstddef>
+
+namespace Sglty::Op::Alg {
+
+/**
+ * @brief Computes the determinant of a small square matrix expression.
+ *
+ * Closed-form cofactor expansion for sizes 1 to 4. Every operand element is
+ * read once and the result uses only `+`, `-` and `*` without branching, so
+ * it also works element-type-generically: over a matrix of `Types::Lanes`
+ * it computes the determinants of all lanes at once, which is how
+ * `Types::Batch` vectorizes it.
+ *
+ * @tparam _expr A valid square expression with at most 4 rows.
+ * @param _e The matrix or expression.
+ * @return The determinant, of the expression's element type.
+ */
+template <typename _expr>
+constexpr auto Det(const _expr& _e);
+
+}  // namespace Sglty::Op::Alg
+
+#include "Impl/Det.tpp"
+
+// Singularity/Op/Alg/Det.hpp
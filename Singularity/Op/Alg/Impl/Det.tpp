@@ -0,0 +1,104 @@
+#pragma once
+
+#include "../Det.hpp"
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "../../../Traits/Expr.hpp"
+
+namespace Sglty::Op::Alg {
+
+namespace Impl {
+
+template <typename _expr>
+using Element = std::decay_t<decltype(std::declval<const _expr&>()(0, 0))>;
+
+template <typename _expr>
+using Square =
+    std::array<std::array<Element<_expr>, _expr::cols>, _expr::rows>;
+
+// Reads every element of `_e` once.
+template <typename _expr>
+constexpr Square<_expr> Load(const _expr& _e) {
+  Square<_expr> a{};
+  for (std::size_t i = 0; i < _expr::rows; i++) {
+    for (std::size_t j = 0; j < _expr::cols; j++) {
+      a[i][j] = _e(i, j);
+    }
+  }
+  return a;
+}
+
+template <typename _value>
+constexpr _value Det(const std::array<std::array<_value, 1>, 1>& a) {
+  return a[0][0];
+}
+
+template <typename _value>
+constexpr _value Det(const std::array<std::array<_value, 2>, 2>& a) {
+  return a[0][0] * a[1][1] - a[0][1] * a[1][0];
+}
+
+template <typename _value>
+constexpr _value Det(const std::array<std::array<_value, 3>, 3>& a) {
+  return a[0][0] * (a[1][1] * a[2][2] - a[1][2] * a[2][1]) -
+         a[0][1] * (a[1][0] * a[2][2] - a[1][2] * a[2][0]) +
+         a[0][2] * (a[1][0] * a[2][1] - a[1][1] * a[2][0]);
+}
+
+// 2×2 minors of the top (s) and bottom (c) row pairs; shared by the 4×4
+// determinant and inverse (Laplace expansion along the first two rows).
+template <typename _value>
+struct Minors4 {
+  _value s[6];
+  _value c[6];
+};
+
+template <typename _value>
+constexpr Minors4<_value> GetMinors4(
+    const std::array<std::array<_value, 4>, 4>& a) {
+  return {{a[0][0] * a[1][1] - a[1][0] * a[0][1],
+           a[0][0] * a[1][2] - a[1][0] * a[0][2],
+           a[0][0] * a[1][3] - a[1][0] * a[0][3],
+           a[0][1] * a[1][2] - a[1][1] * a[0][2],
+           a[0][1] * a[1][3] - a[1][1] * a[0][3],
+           a[0][2] * a[1][3] - a[1][2] * a[0][3]},
+          {a[2][0] * a[3][1] - a[3][0] * a[2][1],
+           a[2][0] * a[3][2] - a[3][0] * a[2][2],
+           a[2][0] * a[3][3] - a[3][0] * a[2][3],
+           a[2][1] * a[3][2] - a[3][1] * a[2][2],
+           a[2][1] * a[3][3] - a[3][1] * a[2][3],
+           a[2][2] * a[3][3] - a[3][2] * a[2][3]}};
+}
+
+template <typename _value>
+constexpr _value Det(const Minors4<_value>& m) {
+  return m.s[0] * m.c[5] - m.s[1] * m.c[4] + m.s[2] * m.c[3] +
+         m.s[3] * m.c[2] - m.s[4] * m.c[1] + m.s[5] * m.c[0];
+}
+
+template <typename _value>
+constexpr _value Det(const std::array<std::array<_value, 4>, 4>& a) {
+  return Det(GetMinors4(a));
+}
+
+}  // namespace Impl
+
+template <typename _expr>
+constexpr auto Det(const _expr& _e) {
+  static_assert(Traits::Expr::is_valid_v<_expr>,
+                "Error: `_expr` is not a valid expression type.");
+  static_assert(_expr::rows == _expr::cols,
+                "Error: a determinant requires a square matrix.");
+  static_assert(_expr::rows >= 1 && _expr::rows <= 4,
+                "Error: `Det` supports sizes 1 to 4 only.");
+
+  return Impl::Det(Impl::Load(_e));
+}
+
+}  // namespace Sglty::Op::Alg
+
+// Singularity/Op/Alg/Impl/Det.tpp
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "../Inv.hpp"
+
+#include <cstddef>
+#include <type_traits>
+
+#include "../Det.hpp"
+#include "../../../Fwd.hpp"
+#include "../../../Traits/Expr.hpp"
+#include "../../../Types/Matrix.hpp"
+
+namespace Sglty::Op::Alg {
+
+namespace Impl {
+
+// Floating-point scalars, including the 16-bit storage formats, and `Lanes`
+// of them.
+template <typename _Tp>
+struct IsFloatingElement : std::is_floating_point<_Tp> {};
+
+template <>
+struct IsFloatingElement<Types::Half> : std::true_type {};
+
+template <>
+struct IsFloatingElement<Types::BFloat16> : std::true_type {};
+
+template <typename _Tp, std::size_t _width>
+struct IsFloatingElement<Types::Lanes<_Tp, _width>>
+    : std::is_floating_point<_Tp> {};
+
+}  // namespace Impl
+
+template <typename _expr>
+constexpr auto Inv(const _expr& _e) {
+  static_assert(Traits::Expr::is_valid_v<_expr>,
+                "Error: `_expr` is not a valid expression type.");
+  static_assert(_expr::rows == _expr::cols,
+                "Error: an inverse requires a square matrix.");
+  static_assert(_expr::rows >= 1 && _expr::rows <= 4,
+                "Error: `Inv` supports sizes 1 to 4 only.");
+
+  using value_type = Impl::Element<_expr>;
+
+  static_assert(Impl::IsFloatingElement<value_type>::value,
+                "Error: `Inv` requires a floating-point element type.");
+
+  const auto a = Impl::Load(_e);
+  Types::Matrix<typename _expr::core_impl> ret;
+
+  if constexpr (_expr::rows == 1) {
+    ret(0, 0) = value_type(1) / a[0][0];
+  } else if constexpr (_expr::rows == 2) {
+    const value_type d = value_type(1) / Impl::Det(a);
+    ret(0, 0)          = a[1][1] * d;
+    ret(0, 1)          = -a[0][1] * d;
+    ret(1, 0)          = -a[1][0] * d;
+    ret(1, 1)          = a[0][0] * d;
+  } else if constexpr (_expr::rows == 3) {
+    const value_type d = value_type(1) / Impl::Det(a);
+    ret(0, 0)          = (a[1][1] * a[2][2] - a[1][2] * a[2][1]) * d;
+    ret(0, 1)          = (a[0][2] * a[2][1] - a[0][1] * a[2][2]) * d;
+    ret(0, 2)          = (a[0][1] * a[1][2] - a[0][2] * a[1][1]) * d;
+    ret(1, 0)          = (a[1][2] * a[2][0] - a[1][0] * a[2][2]) * d;
+    ret(1, 1)          = (a[0][0] * a[2][2] - a[0][2] * a[2][0]) * d;
+    ret(1, 2)          = (a[0][2] * a[1][0] - a[0][0] * a[1][2]) * d;
+    ret(2, 0)          = (a[1][0] * a[2][1] - a[1][1] * a[2][0]) * d;
+    ret(2, 1)          = (a[0][1] * a[2][0] - a[0][0] * a[2][1]) * d;
+    ret(2, 2)          = (a[0][0] * a[1][1] - a[0][1] * a[1][0]) * d;
+  } else {
+    const auto m       = Impl::GetMinors4(a);
+    const auto& s      = m.s;
+    const auto& c      = m.c;
+    const value_type d = value_type(1) / Impl::Det(m);
+    ret(0, 0) = (a[1][1] * c[5] - a[1][2] * c[4] + a[1][3] * c[3]) * d;
+    ret(0, 1) = (a[0][2] * c[4] - a[0][1] * c[5] - a[0][3] * c[3]) * d;
+    ret(0, 2) = (a[3][1] * s[5] - a[3][2] * s[4] + a[3][3] * s[3]) * d;
+    ret(0, 3) = (a[2][2] * s[4] - a[2][1] * s[5] - a[2][3] * s[3]) * d;
+    ret(1, 0) = (a[1][2] * c[2] - a[1][0] * c[5] - a[1][3] * c[1]) * d;
+    ret(1, 1) = (a[0][0] * c[5] - a[0][2] * c[2] + a[0][3] * c[1]) * d;
+    ret(1, 2) = (a[3][2] * s[2] - a[3][0] * s[5] - a[3][3] * s[1]) * d;
+    ret(1, 3) = (a[2][0] * s[5] - a[2][2] * s[2] + a[2][3] * s[1]) * d;
+    ret(2, 0) = (a[1][0] * c[4] - a[1][1] * c[2] + a[1][3] * c[0]) * d;
+    ret(2, 1) = (a[0][1] * c[2] - a[0][0] * c[4] - a[0][3] * c[0]) * d;
+    ret(2, 2) = (a[3][0] * s[4] - a[3][1] * s[2] + a[3][3] * s[0]) * d;
+    ret(2, 3) = (a[2][1] * s[2] - a[2][0] * s[4] - a[2][3] * s[0]) * d;
+    ret(3, 0) = (a[1][1] * c[1] - a[1][0] * c[3] - a[1][2] * c[0]) * d;
+    ret(3, 1) = (a[0][0] * c[3] - a[0][1] * c[1] + a[0][2] * c[0]) * d;
+    ret(3, 2) = (a[3][1] * s[1] - a[3][0] * s[3] - a[3][2] * s[0]) * d;
+    ret(3, 3) = (a[2][0] * s[3] - a[2][1] * s[1] + a[2][2] * s[0]) * d;
+  }
+
+  return ret;
+}
+
+}  // namespace Sglty::Op::Alg
+
+// Singularity/Op/Alg/Impl/Inv.tpp
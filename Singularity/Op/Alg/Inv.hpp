@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstddef>
+
+namespace Sglty::Op::Alg {
+
+/**
+ * @brief Computes the inverse of a small square matrix expression.
+ *
+ * Adjugate divided by the determinant, in closed form for sizes 1 to 4.
+ * Unlike `Trp()` the result is a concrete `Matrix<_expr::core_impl>`, since
+ * every element of an inverse depends on every operand element.
+ *
+ * There is no singularity check, keeping the computation branch-free so it
+ * vectorizes over `Types::Lanes` elements (as in `Types::Batch`); a singular
+ * input yields non-finite elements.
+ *
+ * @tparam _expr A valid square expression with at most 4 rows, whose
+ * elements are floating-point (`Types::Half` and `Types::BFloat16` included)
+ * or `Types::Lanes` of them.
+ * @param _e The matrix or expression.
+ * @return The inverse matrix.
+ */
+template <typename _expr>
+constexpr auto Inv(const _expr& _e);
+
+}  // namespace Sglty::Op::Alg
+
+#include "Impl/Inv.tpp"
+
+// Singularity/Op/Alg/Inv.hpp
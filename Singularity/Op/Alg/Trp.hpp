@@ -2,6 +2,8 @@
 
 #include <cstddef>
 
+#include "../../Expr/Cost.hpp"
+
 namespace Sglty::Expr {
 
 /**
@@ -64,6 +66,13 @@ struct Trp {
   template <typename>
   constexpr static bool is_valid_dimension = true;
 
+  /**
+   * @brief Cost of the transpose: a pure re-indexing, so only the operand's
+   * reads.
+   */
+  template <typename _operand>
+  constexpr static Cost cost = OperandCost<_operand>();
+
   /**
    * @brief Evaluates the transpose at a given coordinate.
    *
@@ -1,6 +1,9 @@
 #pragma once
 
 #include <cstddef>
+#include <type_traits>
+
+#include "../../Expr/Cost.hpp"
 
 namespace Sglty::Expr {
 
@@ -12,7 +15,7 @@ namespace Sglty::Expr {
  *
  * Both operands must:
  * - Be the same shape (`rows` and `cols` match)
- * - Have the same `core_impl` type
+ * - Produce the same result core (`core_impl` rebound to their shape)
  */
 struct Add {
   /**
@@ -40,20 +43,26 @@ struct Add {
   /**
    * @brief The core implementation used by the resulting expression.
    *
-   * Only valid if both operands share the same core implementation.
+   * The left-hand side core rebound to the result shape, so non-owning cores
+   * (e.g. `Core::Mapped`) produce an owning result.
    *
    * @tparam _lhs Left-hand side expression.
    * @tparam _rhs Right-hand side expression.
    */
   template <typename _lhs, typename _rhs>
-  using core_impl = typename _lhs::core_impl;
+  using core_impl =
+      typename _lhs::core_impl::template core_rebind_size<rows<_lhs, _rhs>,
+                                                          cols<_lhs, _rhs>>;
 
   /**
-   * @brief Verifies that both operands use the same core implementation.
+   * @brief Verifies that both operands produce the same result core.
    */
   template <typename _lhs, typename _rhs>
-  constexpr static bool is_valid_core_impl =
-      std::is_same_v<typename _lhs::core_impl, typename _rhs::core_impl>;
+  constexpr static bool is_valid_core_impl = std::is_same_v<
+      typename _lhs::core_impl::template core_rebind_size<_lhs::rows,
+                                                          _lhs::cols>,
+      typename _rhs::core_impl::template core_rebind_size<_rhs::rows,
+                                                          _rhs::cols>>;
 
   /**
    * @brief Verifies that both operands have the same shape.
@@ -62,6 +71,14 @@ struct Add {
   constexpr static bool is_valid_dimension =
       (_lhs::rows == _rhs::rows) && (_lhs::cols == _rhs::cols);
 
+  /**
+   * @brief Cost of the sum: one addition per element plus one read of each
+   * operand.
+   */
+  template <typename _lhs, typename _rhs>
+  constexpr static Cost cost = OperandCost<_lhs>() + OperandCost<_rhs>() +
+                               Cost{rows<_lhs, _rhs> * cols<_lhs, _rhs>};
+
   /**
    * @brief Evaluates the sum of two matrix expressions at a given position.
    *
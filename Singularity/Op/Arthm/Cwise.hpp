@@ -0,0 +1,199 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+#include "../../Expr/Cost.hpp"
+
+namespace Sglty::Expr {
+
+/**
+ * @brief Element-wise product, `l * r`.
+ */
+struct Multiplies {
+  template <typename _Tp, typename _Up>
+  constexpr auto operator()(const _Tp& _l, const _Up& _r) const;
+};
+
+/**
+ * @brief Element-wise quotient, `l / r`.
+ */
+struct Divides {
+  template <typename _Tp, typename _Up>
+  constexpr auto operator()(const _Tp& _l, const _Up& _r) const;
+};
+
+/**
+ * @brief Element-wise minimum, `r < l ? r : l`.
+ */
+struct Min {
+  template <typename _Tp, typename _Up>
+  constexpr auto operator()(const _Tp& _l, const _Up& _r) const;
+};
+
+/**
+ * @brief Element-wise maximum, `l < r ? r : l`.
+ */
+struct Max {
+  template <typename _Tp, typename _Up>
+  constexpr auto operator()(const _Tp& _l, const _Up& _r) const;
+};
+
+/**
+ * @brief Compile-time coefficient-wise binary operation with broadcasting.
+ *
+ * Combines two matrix expressions element by element with `_fn`, e.g.
+ * `Multiplies` for the Hadamard product. Used as the `op_type` in a
+ * `Binary<_lhs, _rhs, Cwise<_fn>>` expression node.
+ *
+ * Each dimension of the operands must either match or be 1 on one side; an
+ * operand with a single row (column) is repeated over every row (column) of
+ * the result, so a 1×N bias row combines with an M×N matrix without being
+ * materialized. The broadcast index is resolved at compile time, so the
+ * inner loop of an assignment stays a plain strided loop the compiler can
+ * vectorize.
+ *
+ * @tparam _fn Stateless binary function object applied to each pair of
+ * elements.
+ */
+template <typename _fn>
+struct Cwise {
+  /**
+   * @brief Row count of the result.
+   *
+   * The larger of the operands' row counts.
+   */
+  template <typename _lhs, typename _rhs>
+  constexpr static std::size_t rows =
+      _lhs::rows > _rhs::rows ? _lhs::rows : _rhs::rows;
+
+  /**
+   * @brief Column count of the result.
+   *
+   * The larger of the operands' column counts.
+   */
+  template <typename _lhs, typename _rhs>
+  constexpr static std::size_t cols =
+      _lhs::cols > _rhs::cols ? _lhs::cols : _rhs::cols;
+
+  /**
+   * @brief The core implementation used by the resulting expression.
+   *
+   * The left-hand side core rebound to the result shape.
+   */
+  template <typename _lhs, typename _rhs>
+  using core_impl =
+      typename _lhs::core_impl::template core_rebind_size<rows<_lhs, _rhs>,
+                                                          cols<_lhs, _rhs>>;
+
+  /**
+   * @brief Verifies that both operands produce the same result core once
+   * rebound to the result shape.
+   */
+  template <typename _lhs, typename _rhs>
+  constexpr static bool is_valid_core_impl =
+      std::is_same_v<core_impl<_lhs, _rhs>,
+                     typename _rhs::core_impl::
+                         template core_rebind_size<rows<_lhs, _rhs>,
+                                                   cols<_lhs, _rhs>>>;
+
+  /**
+   * @brief Verifies that each dimension matches or is 1 on one side.
+   */
+  template <typename _lhs, typename _rhs>
+  constexpr static bool is_valid_dimension =
+      (_lhs::rows == _rhs::rows || _lhs::rows == 1 || _rhs::rows == 1) &&
+      (_lhs::cols == _rhs::cols || _lhs::cols == 1 || _rhs::cols == 1);
+
+  /**
+   * @brief Cost of the operation: one flop per result element plus one read
+   * of each operand.
+   */
+  template <typename _lhs, typename _rhs>
+  constexpr static Cost cost = OperandCost<_lhs>() + OperandCost<_rhs>() +
+                               Cost{rows<_lhs, _rhs> * cols<_lhs, _rhs>};
+
+  /**
+   * @brief Evaluates the operation at a given position.
+   *
+   * Broadcast operands are read at row (column) 0.
+   *
+   * @param _l Left operand.
+   * @param _r Right operand.
+   * @param i Row index.
+   * @param j Column index.
+   * @return `_fn{}(l(i, j), r(i, j))`
+   */
+  template <typename _lhs, typename _rhs>
+  constexpr auto operator()(const _lhs& _l,
+                            const _rhs& _r,
+                            std::size_t i,
+                            std::size_t j) const;
+};
+
+}  // namespace Sglty::Expr
+
+namespace Sglty::Op::Arthm {
+
+/**
+ * @brief Coefficient-wise (Hadamard) product, `l(i, j) * r(i, j)`.
+ *
+ * Unlike `operator*`, which is the matrix product, this multiplies matching
+ * elements. Operands broadcast as described in `Expr::Cwise`.
+ *
+ * @tparam _lhs Left-hand side expression.
+ * @tparam _rhs Right-hand side expression.
+ * @param _l The left operand.
+ * @param _r The right operand.
+ * @return A `Binary<_lhs, _rhs, Expr::Cwise<Expr::Multiplies>>`.
+ */
+template <typename _lhs, typename _rhs>
+constexpr auto CwiseProduct(const _lhs& _l, const _rhs& _r);
+
+/**
+ * @brief Coefficient-wise quotient, `l(i, j) / r(i, j)`.
+ *
+ * Operands broadcast as described in `Expr::Cwise`.
+ *
+ * @tparam _lhs Left-hand side expression.
+ * @tparam _rhs Right-hand side expression.
+ * @param _l The dividend.
+ * @param _r The divisor.
+ * @return A `Binary<_lhs, _rhs, Expr::Cwise<Expr::Divides>>`.
+ */
+template <typename _lhs, typename _rhs>
+constexpr auto CwiseQuotient(const _lhs& _l, const _rhs& _r);
+
+/**
+ * @brief Coefficient-wise minimum.
+ *
+ * Operands broadcast as described in `Expr::Cwise`.
+ *
+ * @tparam _lhs Left-hand side expression.
+ * @tparam _rhs Right-hand side expression.
+ * @param _l The left operand.
+ * @param _r The right operand.
+ * @return A `Binary<_lhs, _rhs, Expr::Cwise<Expr::Min>>`.
+ */
+template <typename _lhs, typename _rhs>
+constexpr auto CwiseMin(const _lhs& _l, const _rhs& _r);
+
+/**
+ * @brief Coefficient-wise maximum.
+ *
+ * Operands broadcast as described in `Expr::Cwise`.
+ *
+ * @tparam _lhs Left-hand side expression.
+ * @tparam _rhs Right-hand side expression.
+ * @param _l The left operand.
+ * @param _r The right operand.
+ * @return A `Binary<_lhs, _rhs, Expr::Cwise<Expr::Max>>`.
+ */
+template <typename _lhs, typename _rhs>
+constexpr auto CwiseMax(const _lhs& _l, const _rhs& _r);
+
+}  // namespace Sglty::Op::Arthm
+
+#include "Impl/Cwise.tpp"
+
+// Singularity/Op/Arthm/Cwise.hpp
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "../Cwise.hpp"
+
+#include <cstddef>
+
+#include "../../../Expr/Binary.hpp"
+
+namespace Sglty::Expr {
+
+template <typename _Tp, typename _Up>
+constexpr auto Multiplies::operator()(const _Tp& _l, const _Up& _r) const {
+  return _l * _r;
+}
+
+template <typename _Tp, typename _Up>
+constexpr auto Divides::operator()(const _Tp& _l, const _Up& _r) const {
+  return _l / _r;
+}
+
+template <typename _Tp, typename _Up>
+constexpr auto Min::operator()(const _Tp& _l, const _Up& _r) const {
+  return _r < _l ? _r : _l;
+}
+
+template <typename _Tp, typename _Up>
+constexpr auto Max::operator()(const _Tp& _l, const _Up& _r) const {
+  return _l < _r ? _r : _l;
+}
+
+template <typename _fn>
+template <typename _lhs, typename _rhs>
+constexpr auto Cwise<_fn>::operator()(const _lhs& _l,
+                                      const _rhs& _r,
+                                      std::size_t i,
+                                      std::size_t j) const {
+  static_assert(is_valid_core_impl<_lhs, _rhs>,
+                "Error: `_lhs` and `_rhs` have different `core_impl` types.");
+  static_assert(is_valid_dimension<_lhs, _rhs>,
+                "Error: `_lhs` and `_rhs` have incompatible dimensions.");
+
+  return _fn{}(_l(_lhs::rows == 1 ? 0 : i, _lhs::cols == 1 ? 0 : j),
+               _r(_rhs::rows == 1 ? 0 : i, _rhs::cols == 1 ? 0 : j));
+}
+
+}  // namespace Sglty::Expr
+
+namespace Sglty::Op::Arthm {
+
+template <typename _lhs, typename _rhs>
+constexpr auto CwiseProduct(const _lhs& _l, const _rhs& _r) {
+  return Expr::Binary<_lhs, _rhs, Expr::Cwise<Expr::Multiplies>>(_l, _r);
+}
+
+template <typename _lhs, typename _rhs>
+constexpr auto CwiseQuotient(const _lhs& _l, const _rhs& _r) {
+  return Expr::Binary<_lhs, _rhs, Expr::Cwise<Expr::Divides>>(_l, _r);
+}
+
+template <typename _lhs, typename _rhs>
+constexpr auto CwiseMin(const _lhs& _l, const _rhs& _r) {
+  return Expr::Binary<_lhs, _rhs, Expr::Cwise<Expr::Min>>(_l, _r);
+}
+
+template <typename _lhs, typename _rhs>
+constexpr auto CwiseMax(const _lhs& _l, const _rhs& _r) {
+  return Expr::Binary<_lhs, _rhs, Expr::Cwise<Expr::Max>>(_l, _r);
+}
+
+}  // namespace Sglty::Op::Arthm
+
+// Singularity/Op/Arthm/Impl/Cwise.tpp
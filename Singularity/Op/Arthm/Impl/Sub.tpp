@@ -27,7 +27,7 @@ namespace Sglty::Op::Arthm {
 
 template <typename _lhs, typename _rhs>
 constexpr auto Sub(const _lhs& _l, const _rhs& _r) {
-  return Expr::Binary<_lhs, _rhs, Expr::Add>(_l, _r);
+  return Expr::Binary<_lhs, _rhs, Expr::Sub>(_l, _r);
 }
 
 }  // namespace Sglty::Op::Arthm
@@ -3,6 +3,11 @@
 #include <cstddef>
 #include <type_traits>
 
+#include "../../Expr/Cost.hpp"
+
+#include "../../Expr/Binary.hpp"
+#include "../../Traits/Expr.hpp"
+
 namespace Sglty::Expr {
 
 /**
@@ -31,10 +36,33 @@ struct MulScalar {
   /**
    * @brief Resulting core implementation.
    *
-   * Same as the matrix operand's core implementation.
+   * The matrix operand's core implementation rebound to its own shape, so
+   * non-owning cores produce an owning result.
+   */
+  template <typename _lhs, typename _rhs>
+  using core_impl =
+      typename _lhs::core_impl::template core_rebind_size<rows<_lhs, _rhs>,
+                                                          cols<_lhs, _rhs>>;
+
+  /**
+   * @brief Always valid—scaling preserves core layout.
+   */
+  template <typename, typename>
+  constexpr static bool is_valid_core_impl = true;
+
+  /**
+   * @brief Always valid—scaling does not change dimensions.
+   */
+  template <typename, typename>
+  constexpr static bool is_valid_dimension = true;
+
+  /**
+   * @brief Cost of the scaling: one multiplication per element plus one read
+   * of the matrix operand.
    */
   template <typename _lhs, typename _rhs>
-  using core_impl = typename _lhs::core_impl;
+  constexpr static Cost cost =
+      OperandCost<_lhs>() + Cost{rows<_lhs, _rhs> * cols<_lhs, _rhs>};
 
   /**
    * @brief Evaluates scalar multiplication at the given position.
@@ -107,6 +135,18 @@ struct MulMatrix {
   template <typename _lhs, typename _rhs>
   constexpr static bool is_valid_dimension = (_lhs::cols == _rhs::rows);
 
+  /**
+   * @brief Cost of the product.
+   *
+   * Each result element is a dot product of length `k` (`k` multiplications
+   * and `k - 1` additions). Every lhs element is re-read once per result
+   * column and every rhs element once per result row.
+   */
+  template <typename _lhs, typename _rhs>
+  constexpr static Cost cost =
+      OperandCost<_lhs>() * _rhs::cols + OperandCost<_rhs>() * _lhs::rows +
+      Cost{_lhs::rows * _rhs::cols * (2 * _lhs::cols - 1)};
+
   /**
    * @brief Computes the (i, j) element of the matrix product.
    *
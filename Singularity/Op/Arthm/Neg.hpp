@@ -2,6 +2,7 @@
 
 #include <cstddef>
 
+#include "../../Expr/Cost.hpp"
 #include "../../Expr/Unary.hpp"
 
 namespace Sglty::Expr {
@@ -34,10 +35,12 @@ struct Neg {
   /**
    * @brief Resulting core implementation.
    *
-   * Propagates the operand’s `core_impl` type.
+   * The operand’s `core_impl` rebound to its own shape, so non-owning cores
+   * produce an owning result.
    */
   template <typename _operand>
-  using core_impl = typename _operand::core_impl;
+  using core_impl = typename _operand::core_impl::
+      template core_rebind_size<rows<_operand>, cols<_operand>>;
 
   /**
    * @brief Always valid—negation preserves core layout.
@@ -51,6 +54,14 @@ struct Neg {
   template <typename>
   constexpr static bool is_valid_dimension = true;
 
+  /**
+   * @brief Cost of the negation: one flop per element plus one read of the
+   * operand.
+   */
+  template <typename _operand>
+  constexpr static Cost cost =
+      OperandCost<_operand>() + Cost{rows<_operand> * cols<_operand>};
+
   /**
    * @brief Computes the element-wise negation of the operand.
    *
@@ -1,6 +1,9 @@
 #pragma once
 
 #include <cstddef>
+#include <type_traits>
+
+#include "../../Expr/Cost.hpp"
 
 namespace Sglty::Expr {
 
@@ -28,19 +31,28 @@ struct Sub {
   constexpr static std::size_t cols = _lhs::cols;
 
   /**
-   * @brief Resulting core implementation.
+   * @brief The core implementation used by the resulting expression.
+   *
+   * The left-hand side core rebound to the result shape, so non-owning cores
+   * (e.g. `Core::Mapped`) produce an owning result.
    *
-   * Assumes both operands share the same `core_impl`.
+   * @tparam _lhs Left-hand side expression.
+   * @tparam _rhs Right-hand side expression.
    */
   template <typename _lhs, typename _rhs>
-  using core_impl = typename _lhs::core_impl;
+  using core_impl =
+      typename _lhs::core_impl::template core_rebind_size<rows<_lhs, _rhs>,
+                                                          cols<_lhs, _rhs>>;
 
   /**
-   * @brief Valid if both operands use the same core implementation.
+   * @brief Verifies that both operands produce the same result core.
    */
   template <typename _lhs, typename _rhs>
-  constexpr static bool is_valid_core_impl =
-      std::is_same_v<typename _lhs::core_impl, typename _rhs::core_impl>;
+  constexpr static bool is_valid_core_impl = std::is_same_v<
+      typename _lhs::core_impl::template core_rebind_size<_lhs::rows,
+                                                          _lhs::cols>,
+      typename _rhs::core_impl::template core_rebind_size<_rhs::rows,
+                                                          _rhs::cols>>;
 
   /**
    * @brief Valid if both operands have identical dimensions.
@@ -49,6 +61,14 @@ struct Sub {
   constexpr static bool is_valid_dimension =
       (_lhs::rows == _rhs::rows) && (_lhs::cols == _rhs::cols);
 
+  /**
+   * @brief Cost of the difference: one subtraction per element plus one read
+   * of each operand.
+   */
+  template <typename _lhs, typename _rhs>
+  constexpr static Cost cost = OperandCost<_lhs>() + OperandCost<_rhs>() +
+                               Cost{rows<_lhs, _rhs> * cols<_lhs, _rhs>};
+
   /**
    * @brief Computes the element-wise difference `_l(i, j) - _r(i, j)`.
    *
@@ -1,13 +1,44 @@
 #pragma once
 
+#include "../../Fwd.hpp"
+
 namespace Sglty::Op::Cmp {
 
+/**
+ * @brief Tests two matrix expressions for element-wise equality.
+ *
+ * The operands need the same shape but not the same type: their layouts may
+ * differ and either side may be an unevaluated expression, which is read in
+ * place. Elements are compared in the left operand's memory order and the
+ * scan stops at the first difference. At runtime, two contiguous matrices
+ * with the same arithmetic value type and layout are compared over `Data()`
+ * by `Kernel::Equal()`.
+ */
 template <typename _lhs, typename _rhs>
 constexpr bool IsEqual(const _lhs& _l, const _rhs& _r);
 
 template <typename _lhs, typename _rhs>
 constexpr bool IsNotEqual(const _lhs& _l, const _rhs& _r);
 
+/**
+ * @brief Tests two matrix expressions for equality within a tolerance.
+ *
+ * Every pair of elements must satisfy `Kernel::IsClose(l, r, _rel, _abs)`,
+ * i.e. differ by at most `max(_abs, _rel * max(|l|, |r|))`. Operands are
+ * accepted and scanned as in `IsEqual()`; the contiguous fast path is
+ * `Kernel::Approx()`.
+ *
+ * @param _l   Left operand.
+ * @param _r   Right operand.
+ * @param _rel Relative tolerance.
+ * @param _abs Absolute tolerance, for elements near zero.
+ */
+template <typename _lhs, typename _rhs>
+constexpr bool IsApprox(const _lhs& _l,
+                        const _rhs& _r,
+                        double _rel = 1e-5,
+                        double _abs = 0.0);
+
 }  // namespace Sglty::Op::Cmp
 
 namespace Sglty::Types {
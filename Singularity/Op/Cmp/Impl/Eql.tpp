@@ -6,16 +6,64 @@
 #include <cstddef>
 #include <type_traits>
 
+#include "../../../Config.hpp"
+#include "../../../Kernel/Compare.hpp"
+#include "../../../Traits/Core.hpp"
+#include "../../../Traits/Expr.hpp"
+
 namespace Sglty::Op::Cmp {
 
+namespace Impl {
+
+// Two contiguous matrices with the same arithmetic value type and layout,
+// comparable as flat arrays.
 template <typename _lhs, typename _rhs>
-constexpr bool IsEqual(const _lhs& _l, const _rhs& _r) {
-  static_assert(std::is_same_v<_lhs, _rhs>,
+struct IsFlatPair : std::false_type {};
+
+template <typename _lcore, typename _rcore>
+struct IsFlatPair<Types::Matrix<_lcore>, Types::Matrix<_rcore>>
+    : std::bool_constant<
+          Traits::Core::is_contiguous_v<_lcore> &&
+          Traits::Core::is_contiguous_v<_rcore> &&
+          Types::Matrix<_lcore>::core_major ==
+              Types::Matrix<_rcore>::core_major &&
+          std::is_same_v<typename Types::Matrix<_lcore>::value_type,
+                         typename Types::Matrix<_rcore>::value_type> &&
+          std::is_arithmetic_v<typename Types::Matrix<_lcore>::value_type>> {
+};
+
+template <typename _lhs, typename _rhs>
+constexpr void CheckOperands() {
+  static_assert(Traits::Expr::is_valid_v<_lhs> &&
+                    Traits::Expr::is_valid_v<_rhs>,
+                "Error: `_lhs` and `_rhs` must be valid expression types.");
+  static_assert(_lhs::rows == _rhs::rows && _lhs::cols == _rhs::cols,
                 "Error: `_lhs` and `_rhs` have different dimensions.");
+}
+
+template <typename _lhs>
+constexpr bool row_major_v =
+    _lhs::core_impl::core_traits::core_major == Core::Major::Row;
+
+template <typename _lhs>
+constexpr std::size_t outer_v = row_major_v<_lhs> ? _lhs::rows : _lhs::cols;
 
-  for (std::size_t i = 0; i < _lhs::rows; i++) {
-    for (std::size_t j = 0; j < _lhs::cols; j++) {
-      if (_l(i, j) != _r(i, j)) {
+template <typename _lhs>
+constexpr std::size_t inner_v = row_major_v<_lhs> ? _lhs::cols : _lhs::rows;
+
+// Compares the outer indices [_lo, _hi) of `_l` and `_r` with `_pred`, in
+// the left operand's memory order, stopping at the first failure.
+template <typename _lhs, typename _rhs, typename _pred>
+constexpr bool CompareOuter(const _lhs& _l,
+                            const _rhs& _r,
+                            std::size_t _lo,
+                            std::size_t _hi,
+                            const _pred& _p) {
+  for (std::size_t o = _lo; o < _hi; o++) {
+    for (std::size_t k = 0; k < inner_v<_lhs>; k++) {
+      const std::size_t i = row_major_v<_lhs> ? o : k;
+      const std::size_t j = row_major_v<_lhs> ? k : o;
+      if (!_p(_l(i, j), _r(i, j))) {
         return false;
       }
     }
@@ -23,11 +71,47 @@ constexpr bool IsEqual(const _lhs& _l, const _rhs& _r) {
   return true;
 }
 
+}  // namespace Impl
+
+template <typename _lhs, typename _rhs>
+constexpr bool IsEqual(const _lhs& _l, const _rhs& _r) {
+  Impl::CheckOperands<_lhs, _rhs>();
+
+  if constexpr (Impl::IsFlatPair<_lhs, _rhs>::value) {
+    if (!SGLTY_IS_CONSTANT_EVALUATED()) {
+      return Kernel::Equal(_l.Data(), _r.Data(), _lhs::rows * _lhs::cols);
+    }
+  }
+  return Impl::CompareOuter(
+      _l, _r, 0, Impl::outer_v<_lhs>, [](const auto& a, const auto& b) {
+        return a == b;
+      });
+}
+
 template <typename _lhs, typename _rhs>
 constexpr bool IsNotEqual(const _lhs& _l, const _rhs& _r) {
   return !IsEqual(_l, _r);
 }
 
+template <typename _lhs, typename _rhs>
+constexpr bool IsApprox(const _lhs& _l,
+                        const _rhs& _r,
+                        double _rel,
+                        double _abs) {
+  Impl::CheckOperands<_lhs, _rhs>();
+
+  if constexpr (Impl::IsFlatPair<_lhs, _rhs>::value) {
+    if (!SGLTY_IS_CONSTANT_EVALUATED()) {
+      return Kernel::Approx(
+          _l.Data(), _r.Data(), _lhs::rows * _lhs::cols, _rel, _abs);
+    }
+  }
+  return Impl::CompareOuter(
+      _l, _r, 0, Impl::outer_v<_lhs>, [&](const auto& a, const auto& b) {
+        return Kernel::IsClose(a, b, _rel, _abs);
+      });
+}
+
 }  // namespace Sglty::Op::Cmp
 
 namespace Sglty::Types {
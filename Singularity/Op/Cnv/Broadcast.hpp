@@ -0,0 +1,106 @@
+#pragma once
+
+#include <cstddef>
+
+#include "../../Expr/Cost.hpp"
+#include "../../Expr/Unary.hpp"
+
+namespace Sglty::Expr {
+
+/**
+ * @brief Compile-time broadcast of a row, column or scalar-sized matrix.
+ *
+ * Represents the operand repeated to a `_rows`×`_cols` shape: a 1×N row
+ * repeated over every row, an M×1 column over every column, or a 1×1 matrix
+ * over both. Reading through it re-indexes the operand and copies nothing,
+ * so `x + Op::Cnv::Broadcast<M, N>(bias)` adds the bias row to each row of
+ * `x` in the same pass that evaluates the sum.
+ *
+ * Used as `op_type` in `Unary<_operand, Broadcast<_rows, _cols>>` expression
+ * nodes.
+ *
+ * @tparam _rows Row count of the result.
+ * @tparam _cols Column count of the result.
+ */
+template <std::size_t _rows, std::size_t _cols>
+struct Broadcast {
+  /**
+   * @brief Row count of the result.
+   */
+  template <typename _operand>
+  constexpr static std::size_t rows = _rows;
+
+  /**
+   * @brief Column count of the result.
+   */
+  template <typename _operand>
+  constexpr static std::size_t cols = _cols;
+
+  /**
+   * @brief Resulting core implementation.
+   *
+   * The operand’s `core_impl` rebound to the broadcast shape.
+   */
+  template <typename _operand>
+  using core_impl = typename _operand::core_impl::
+      template core_rebind_size<rows<_operand>, cols<_operand>>;
+
+  /**
+   * @brief Always valid—the rebound core is checked by `Unary`.
+   */
+  template <typename>
+  constexpr static bool is_valid_core_impl = true;
+
+  /**
+   * @brief Always valid here—`Op::Cnv::Broadcast()` checks that each operand
+   * dimension is 1 or already matches.
+   */
+  template <typename>
+  constexpr static bool is_valid_dimension = true;
+
+  /**
+   * @brief Cost of the broadcast: no arithmetic, one read of the operand.
+   */
+  template <typename _operand>
+  constexpr static Cost cost = OperandCost<_operand>();
+
+  /**
+   * @brief Returns the operand's element for (i, j).
+   *
+   * @param op Operand expression.
+   * @param i Row index.
+   * @param j Column index.
+   * @return `op(i, j)`, with broadcast dimensions read at index 0.
+   */
+  template <typename _operand>
+  constexpr auto operator()(const _operand& op,
+                            std::size_t i,
+                            std::size_t j) const;
+};
+
+}  // namespace Sglty::Expr
+
+namespace Sglty::Op::Cnv {
+
+/**
+ * @brief Wraps a row, column or 1×1 expression in a lazy broadcast.
+ *
+ * Produces a `Unary<_operand, Expr::Broadcast<_rows, _cols>>`, which can be
+ * combined with any same-shape expression. Each dimension of `_operand` must
+ * be 1 or already equal to the target.
+ *
+ * @tparam _rows    Row count of the result.
+ * @tparam _cols    Column count of the result.
+ * @tparam _operand A valid matrix expression with 1 or `_rows` rows and 1 or
+ * `_cols` columns.
+ * @param _o Operand to broadcast.
+ * @return A unary broadcast expression.
+ */
+template <std::size_t _rows, std::size_t _cols, typename _operand>
+constexpr auto Broadcast(const _operand& _o);
+
+}  // namespace Sglty::Op::Cnv
+
+#include "Impl/Broadcast.tpp"
+
+// Singularity/Op/Cnv/Broadcast.hpp
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <cstddef>
+
+#include "../../Expr/Cost.hpp"
+#include "../../Expr/Unary.hpp"
+
+namespace Sglty::Expr {
+
+/**
+ * @brief Compile-time element type conversion.
+ *
+ * Represents `matrix.Cast<_Up>()`. Each element is converted with
+ * `static_cast<_Up>` when it is accessed, so a conversion feeding another
+ * operation (e.g. a product) is fused into that operation instead of
+ * materializing a converted copy.
+ *
+ * Used as `op_type` in `Unary<_operand, Cast<_Up>>` expression nodes.
+ *
+ * @tparam _Up The target value type.
+ */
+template <typename _Up>
+struct Cast {
+  /**
+   * @brief Row count of the result.
+   *
+   * Matches the input operand.
+   */
+  template <typename _operand>
+  constexpr static std::size_t rows = _operand::rows;
+
+  /**
+   * @brief Column count of the result.
+   *
+   * Matches the input operand.
+   */
+  template <typename _operand>
+  constexpr static std::size_t cols = _operand::cols;
+
+  /**
+   * @brief Resulting core implementation.
+   *
+   * The operand’s `core_impl` rebound to the target value type.
+   */
+  template <typename _operand>
+  using core_impl =
+      typename _operand::core_impl::template core_rebind_value<_Up>;
+
+  /**
+   * @brief Always valid—conversion preserves core layout.
+   */
+  template <typename>
+  constexpr static bool is_valid_core_impl = true;
+
+  /**
+   * @brief Always valid—conversion does not change dimensions.
+   */
+  template <typename>
+  constexpr static bool is_valid_dimension = true;
+
+  /**
+   * @brief Cost of the conversion: one operation per element plus one read of
+   * the operand.
+   */
+  template <typename _operand>
+  constexpr static Cost cost =
+      OperandCost<_operand>() + Cost{rows<_operand> * cols<_operand>};
+
+  /**
+   * @brief Converts the element at (i, j).
+   *
+   * @param op Operand expression.
+   * @param i Row index.
+   * @param j Column index.
+   * @return `static_cast<_Up>(op(i, j))`
+   */
+  template <typename _operand>
+  constexpr _Up operator()(const _operand& op,
+                           std::size_t i,
+                           std::size_t j) const;
+};
+
+}  // namespace Sglty::Expr
+
+namespace Sglty::Op::Cnv {
+
+/**
+ * @brief Wraps an expression in a lazy element type conversion.
+ *
+ * Produces a `Unary<_operand, Expr::Cast<_Up>>`; pass it to `Evaluate()` for
+ * a converted copy.
+ *
+ * @tparam _Up      The target value type (arithmetic, `Types::Half` or
+ * `Types::BFloat16`).
+ * @tparam _operand A valid matrix expression.
+ * @param _o Operand to convert.
+ * @return A unary conversion expression.
+ */
+template <typename _Up, typename _operand>
+constexpr auto Cast(const _operand& _o);
+
+}  // namespace Sglty::Op::Cnv
+
+#include "Impl/Cast.tpp"
+
+// Singularity/Op/Cnv/Cast.hpp
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "../Broadcast.hpp"
+
+#include <cstddef>
+
+#include "../../../Expr/Unary.hpp"
+
+namespace Sglty::Expr {
+
+template <std::size_t _rows, std::size_t _cols>
+template <typename _operand>
+constexpr auto Broadcast<_rows, _cols>::operator()(const _operand& op,
+                                                   std::size_t i,
+                                                   std::size_t j) const {
+  return op(_operand::rows == 1 ? 0 : i, _operand::cols == 1 ? 0 : j);
+}
+
+}  // namespace Sglty::Expr
+
+namespace Sglty::Op::Cnv {
+
+template <std::size_t _rows, std::size_t _cols, typename _operand>
+constexpr auto Broadcast(const _operand& _o) {
+  static_assert((_operand::rows == 1 || _operand::rows == _rows) &&
+                    (_operand::cols == 1 || _operand::cols == _cols),
+                "Error: `_operand` cannot be broadcast to this shape.");
+
+  return Expr::Unary<_operand, Expr::Broadcast<_rows, _cols>>(_o);
+}
+
+}  // namespace Sglty::Op::Cnv
+
+// Singularity/Op/Cnv/Impl/Broadcast.tpp
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "../Cast.hpp"
+
+#include <cstddef>
+#include <type_traits>
+
+#include "../../../Expr/Unary.hpp"
+#include "../../../Types/Float16.hpp"
+
+namespace Sglty::Expr {
+
+template <typename _Up>
+template <typename _operand>
+constexpr _Up Cast<_Up>::operator()(const _operand& op,
+                                    std::size_t i,
+                                    std::size_t j) const {
+  return static_cast<_Up>(op(i, j));
+}
+
+}  // namespace Sglty::Expr
+
+namespace Sglty::Op::Cnv {
+
+template <typename _Up, typename _operand>
+constexpr auto Cast(const _operand& _o) {
+  static_assert(std::is_arithmetic_v<_Up> || Types::is_float16_v<_Up>,
+                "Error: cannot cast to a non-arithmetic type.");
+
+  return Expr::Unary<_operand, Expr::Cast<_Up>>(_o);
+}
+
+}  // namespace Sglty::Op::Cnv
+
+// Singularity/Op/Cnv/Impl/Cast.tpp
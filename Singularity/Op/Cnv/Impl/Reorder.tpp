@@ -0,0 +1,30 @@
+#pragma once
+
+#include "../Reorder.hpp"
+
+#include <cstddef>
+
+#include "../../../Expr/Unary.hpp"
+
+namespace Sglty::Expr {
+
+template <Core::Major _major>
+template <typename _operand>
+constexpr auto Reorder<_major>::operator()(const _operand& op,
+                                           std::size_t i,
+                                           std::size_t j) const {
+  return op(i, j);
+}
+
+}  // namespace Sglty::Expr
+
+namespace Sglty::Op::Cnv {
+
+template <Core::Major _major, typename _operand>
+constexpr auto Reorder(const _operand& _o) {
+  return Expr::Unary<_operand, Expr::Reorder<_major>>(_o);
+}
+
+}  // namespace Sglty::Op::Cnv
+
+// Singularity/Op/Cnv/Impl/Reorder.tpp
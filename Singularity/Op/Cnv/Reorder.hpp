@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cstddef>
+
+#include "../../Core/Enums.hpp"
+#include "../../Expr/Cost.hpp"
+#include "../../Expr/Unary.hpp"
+
+namespace Sglty::Expr {
+
+/**
+ * @brief Compile-time change of memory layout.
+ *
+ * Represents `matrix.Reorder<_major>()`. Elements are addressed by logical
+ * (row, column) position, so the node only changes the layout of the core the
+ * expression evaluates into; reading through it re-indexes the operand on
+ * access and copies nothing.
+ *
+ * Used as `op_type` in `Unary<_operand, Reorder<_major>>` expression nodes.
+ *
+ * @tparam _major The target layout.
+ */
+template <Core::Major _major>
+struct Reorder {
+  /**
+   * @brief Row count of the result.
+   *
+   * Matches the input operand.
+   */
+  template <typename _operand>
+  constexpr static std::size_t rows = _operand::rows;
+
+  /**
+   * @brief Column count of the result.
+   *
+   * Matches the input operand.
+   */
+  template <typename _operand>
+  constexpr static std::size_t cols = _operand::cols;
+
+  /**
+   * @brief Resulting core implementation.
+   *
+   * The operand’s `core_impl` rebound to the target layout.
+   */
+  template <typename _operand>
+  using core_impl =
+      typename _operand::core_impl::template core_rebind_major<_major>;
+
+  /**
+   * @brief Always valid—the rebound core is checked by `Unary`.
+   */
+  template <typename>
+  constexpr static bool is_valid_core_impl = true;
+
+  /**
+   * @brief Always valid—reordering does not change dimensions.
+   */
+  template <typename>
+  constexpr static bool is_valid_dimension = true;
+
+  /**
+   * @brief Cost of the reorder: no arithmetic, one read of the operand.
+   */
+  template <typename _operand>
+  constexpr static Cost cost = OperandCost<_operand>();
+
+  /**
+   * @brief Returns the operand's element at (i, j).
+   *
+   * @param op Operand expression.
+   * @param i Row index.
+   * @param j Column index.
+   * @return `op(i, j)`
+   */
+  template <typename _operand>
+  constexpr auto operator()(const _operand& op,
+                            std::size_t i,
+                            std::size_t j) const;
+};
+
+}  // namespace Sglty::Expr
+
+namespace Sglty::Op::Cnv {
+
+/**
+ * @brief Wraps an expression in a lazy layout change.
+ *
+ * Produces a `Unary<_operand, Expr::Reorder<_major>>`; pass it to
+ * `Evaluate()` for a reordered copy.
+ *
+ * @tparam _major   The target layout.
+ * @tparam _operand A valid matrix expression.
+ * @param _o Operand to reorder.
+ * @return A unary reorder expression.
+ */
+template <Core::Major _major, typename _operand>
+constexpr auto Reorder(const _operand& _o);
+
+}  // namespace Sglty::Op::Cnv
+
+#include "Impl/Reorder.tpp"
+
+// Singularity/Op/Cnv/Reorder.hpp
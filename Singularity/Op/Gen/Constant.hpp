@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+#include "../../Expr/Cost.hpp"
+#include "../../Expr/Nullary.hpp"
+
+namespace Sglty::Expr {
+
+/**
+ * @brief Compile-time constant fill generator.
+ *
+ * Every element equals the stored value. `Matrix::Zero()` is a constant fill
+ * with `0`.
+ *
+ * Used as `op_type` in `Nullary<_matrix, Constant<_value>>` expression
+ * nodes.
+ *
+ * @tparam _value The generated value type.
+ */
+template <typename _value>
+struct Constant {
+  /**
+   * @brief Verifies that the core stores `_value`.
+   */
+  template <typename _core_impl>
+  constexpr static bool is_valid_core_impl =
+      std::is_same_v<typename _core_impl::type_traits::value_type, _value>;
+
+  /**
+   * @brief Always valid—any shape can be filled.
+   */
+  template <typename>
+  constexpr static bool is_valid_dimension = true;
+
+  /**
+   * @brief Cost of the fill: no arithmetic and no reads.
+   */
+  template <typename>
+  constexpr static Cost cost = Cost{};
+
+  /**
+   * @brief Returns the fill value.
+   *
+   * @param i Row index (ignored).
+   * @param j Column index (ignored).
+   * @return `_v`
+   */
+  constexpr _value operator()(std::size_t i, std::size_t j) const;
+
+  /// The fill value.
+  _value _v{};
+};
+
+}  // namespace Sglty::Expr
+
+namespace Sglty::Op::Gen {
+
+/**
+ * @brief Creates a lazy matrix with every element equal to `_v`.
+ *
+ * @tparam _matrix The matrix type whose shape and values are generated.
+ * @param _v The fill value.
+ * @return A `Nullary<_matrix, Expr::Constant<value_type>>` expression.
+ */
+template <typename _matrix>
+constexpr auto Constant(const typename _matrix::value_type& _v);
+
+}  // namespace Sglty::Op::Gen
+
+#include "Impl/Constant.tpp"
+
+// Singularity/Op/Gen/Constant.hpp
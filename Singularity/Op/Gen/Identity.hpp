@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+#include "../../Expr/Cost.hpp"
+#include "../../Expr/Nullary.hpp"
+
+namespace Sglty::Expr {
+
+/**
+ * @brief Compile-time identity generator.
+ *
+ * Diagonal elements are one and all others are zero. Because the result is
+ * known to be zero off the diagonal, `Expr::AddAssign()` only touches the
+ * diagonal for identity expressions (also when scaled, negated or cast), so
+ * `a += s * Matrix::Identity()` costs `rows` additions.
+ *
+ * Used as `op_type` in `Nullary<_matrix, Identity<_value>>` expression
+ * nodes.
+ *
+ * @tparam _value The generated value type.
+ */
+template <typename _value>
+struct Identity {
+  /**
+   * @brief Verifies that the core stores `_value`.
+   */
+  template <typename _core_impl>
+  constexpr static bool is_valid_core_impl =
+      std::is_same_v<typename _core_impl::type_traits::value_type, _value>;
+
+  /**
+   * @brief Verifies that the shape is square.
+   */
+  template <typename _core_impl>
+  constexpr static bool is_valid_dimension =
+      _core_impl::size_traits::rows == _core_impl::size_traits::cols;
+
+  /**
+   * @brief Cost of the identity: no arithmetic and no reads.
+   */
+  template <typename>
+  constexpr static Cost cost = Cost{};
+
+  /**
+   * @brief Returns the identity element at (i, j).
+   *
+   * @param i Row index.
+   * @param j Column index.
+   * @return `1` if `i == j`, `0` otherwise.
+   */
+  constexpr _value operator()(std::size_t i, std::size_t j) const;
+};
+
+}  // namespace Sglty::Expr
+
+namespace Sglty::Op::Gen {
+
+/**
+ * @brief Creates a lazy identity matrix.
+ *
+ * Only meaningful for square shapes — compiler error otherwise.
+ *
+ * @tparam _matrix The matrix type whose shape and values are generated.
+ * @return A `Nullary<_matrix, Expr::Identity<value_type>>` expression.
+ */
+template <typename _matrix>
+constexpr auto Identity();
+
+}  // namespace Sglty::Op::Gen
+
+#include "Impl/Identity.tpp"
+
+// Singularity/Op/Gen/Identity.hpp
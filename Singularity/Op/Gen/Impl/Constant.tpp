@@ -0,0 +1,30 @@
+#pragma once
+
+#include "../Constant.hpp"
+
+#include <cstddef>
+
+#include "../../../Expr/Nullary.hpp"
+
+namespace Sglty::Expr {
+
+template <typename _value>
+constexpr _value Constant<_value>::operator()(std::size_t,
+                                              std::size_t) const {
+  return _v;
+}
+
+}  // namespace Sglty::Expr
+
+namespace Sglty::Op::Gen {
+
+template <typename _matrix>
+constexpr auto Constant(const typename _matrix::value_type& _v) {
+  using value_type = typename _matrix::value_type;
+  return Expr::Nullary<_matrix, Expr::Constant<value_type>>(
+      Expr::Constant<value_type>{_v});
+}
+
+}  // namespace Sglty::Op::Gen
+
+// Singularity/Op/Gen/Impl/Constant.tpp
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "../Identity.hpp"
+
+#include <cstddef>
+
+#include "../../../Expr/Nullary.hpp"
+
+namespace Sglty::Expr {
+
+template <typename _value>
+constexpr _value Identity<_value>::operator()(std::size_t i,
+                                              std::size_t j) const {
+  return i == j ? _value(1) : _value(0);
+}
+
+}  // namespace Sglty::Expr
+
+namespace Sglty::Op::Gen {
+
+template <typename _matrix>
+constexpr auto Identity() {
+  using value_type = typename _matrix::value_type;
+  return Expr::Nullary<_matrix, Expr::Identity<value_type>>();
+}
+
+}  // namespace Sglty::Op::Gen
+
+// Singularity/Op/Gen/Impl/Identity.tpp
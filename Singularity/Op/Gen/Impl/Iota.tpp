@@ -0,0 +1,32 @@
+#pragma once
+
+#include "../Iota.hpp"
+
+#include <cstddef>
+
+#include "../../../Expr/Nullary.hpp"
+
+namespace Sglty::Expr {
+
+template <typename _value>
+constexpr _value Iota<_value>::operator()(std::size_t i, std::size_t j) const {
+  return static_cast<_value>(_start + static_cast<_value>(i) * _row_step +
+                             static_cast<_value>(j) * _col_step);
+}
+
+}  // namespace Sglty::Expr
+
+namespace Sglty::Op::Gen {
+
+template <typename _matrix>
+constexpr auto Iota(const typename _matrix::value_type& _start,
+                    const typename _matrix::value_type& _row_step,
+                    const typename _matrix::value_type& _col_step) {
+  using value_type = typename _matrix::value_type;
+  return Expr::Nullary<_matrix, Expr::Iota<value_type>>(
+      Expr::Iota<value_type>{_start, _row_step, _col_step});
+}
+
+}  // namespace Sglty::Op::Gen
+
+// Singularity/Op/Gen/Impl/Iota.tpp
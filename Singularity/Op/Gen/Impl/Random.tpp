@@ -0,0 +1,59 @@
+#pragma once
+
+#include "../Random.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "../../../Expr/Nullary.hpp"
+#include "../../../Kernel/Philox.hpp"
+
+namespace Sglty::Expr {
+
+template <typename _value>
+constexpr _value Random<_value>::operator()(std::size_t i,
+                                            std::size_t j) const {
+  const auto words = Kernel::Philox4x32(
+      {static_cast<std::uint32_t>(i),
+       static_cast<std::uint32_t>(std::uint64_t{i} >> 32),
+       static_cast<std::uint32_t>(j),
+       static_cast<std::uint32_t>(std::uint64_t{j} >> 32)},
+      {static_cast<std::uint32_t>(_seed),
+       static_cast<std::uint32_t>(_seed >> 32)});
+  const std::uint64_t bits = (std::uint64_t{words[0]} << 32) | words[1];
+
+  if constexpr (Types::is_float16_v<_value>) {
+    return _value(Random<float>{_seed, float(_lo), float(_hi)}(i, j));
+  } else if constexpr (std::is_same_v<_value, float>) {
+    const float u = static_cast<float>(bits >> 40) * 0x1.0p-24f;
+    return _lo + (_hi - _lo) * u;
+  } else if constexpr (std::is_floating_point_v<_value>) {
+    const double u = static_cast<double>(bits >> 11) * 0x1.0p-53;
+    return static_cast<_value>(_lo + (_hi - _lo) * u);
+  } else {
+    // Unsigned arithmetic wraps, so this also covers negative bounds; a range
+    // of 0 means all 2^64 values.
+    const std::uint64_t range =
+        static_cast<std::uint64_t>(_hi) - static_cast<std::uint64_t>(_lo) + 1;
+    const std::uint64_t offset = range == 0 ? bits : bits % range;
+    return static_cast<_value>(static_cast<std::uint64_t>(_lo) + offset);
+  }
+}
+
+}  // namespace Sglty::Expr
+
+namespace Sglty::Op::Gen {
+
+template <typename _matrix>
+constexpr auto Random(std::uint64_t _seed,
+                      const typename _matrix::value_type& _lo,
+                      const typename _matrix::value_type& _hi) {
+  using value_type = typename _matrix::value_type;
+  return Expr::Nullary<_matrix, Expr::Random<value_type>>(
+      Expr::Random<value_type>{_seed, _lo, _hi});
+}
+
+}  // namespace Sglty::Op::Gen
+
+// Singularity/Op/Gen/Impl/Random.tpp
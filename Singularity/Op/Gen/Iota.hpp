@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+#include "../../Expr/Cost.hpp"
+#include "../../Expr/Nullary.hpp"
+
+namespace Sglty::Expr {
+
+/**
+ * @brief Compile-time linear ramp generator.
+ *
+ * The element at (i, j) is `_start + i * _row_step + j * _col_step`. With
+ * `_row_step == cols` and `_col_step == 1` this numbers the elements in
+ * row-major order.
+ *
+ * Used as `op_type` in `Nullary<_matrix, Iota<_value>>` expression nodes.
+ *
+ * @tparam _value The generated value type.
+ */
+template <typename _value>
+struct Iota {
+  /**
+   * @brief Verifies that the core stores `_value`.
+   */
+  template <typename _core_impl>
+  constexpr static bool is_valid_core_impl =
+      std::is_same_v<typename _core_impl::type_traits::value_type, _value>;
+
+  /**
+   * @brief Always valid—any shape can be numbered.
+   */
+  template <typename>
+  constexpr static bool is_valid_dimension = true;
+
+  /**
+   * @brief Cost of the ramp: two multiplications and two additions per
+   * element.
+   */
+  template <typename _core_impl>
+  constexpr static Cost cost =
+      Cost{4 * _core_impl::size_traits::rows * _core_impl::size_traits::cols};
+
+  /**
+   * @brief Returns the ramp value at (i, j).
+   *
+   * @param i Row index.
+   * @param j Column index.
+   * @return `_start + i * _row_step + j * _col_step`
+   */
+  constexpr _value operator()(std::size_t i, std::size_t j) const;
+
+  /// Value of the element at (0, 0).
+  _value _start{};
+
+  /// Increment from one row to the next.
+  _value _row_step{};
+
+  /// Increment from one column to the next.
+  _value _col_step{};
+};
+
+}  // namespace Sglty::Expr
+
+namespace Sglty::Op::Gen {
+
+/**
+ * @brief Creates a lazy linear ramp `_start + i * _row_step + j * _col_step`.
+ *
+ * @tparam _matrix The matrix type whose shape and values are generated.
+ * @param _start    Value at (0, 0).
+ * @param _row_step Increment per row.
+ * @param _col_step Increment per column.
+ * @return A `Nullary<_matrix, Expr::Iota<value_type>>` expression.
+ */
+template <typename _matrix>
+constexpr auto Iota(const typename _matrix::value_type& _start,
+                    const typename _matrix::value_type& _row_step,
+                    const typename _matrix::value_type& _col_step);
+
+}  // namespace Sglty::Op::Gen
+
+#include "Impl/Iota.tpp"
+
+// Singularity/Op/Gen/Iota.hpp
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "../../Expr/Cost.hpp"
+#include "../../Expr/Nullary.hpp"
+#include "../../Types/Float16.hpp"
+
+namespace Sglty::Expr {
+
+/**
+ * @brief Compile-time counter-based uniform random generator.
+ *
+ * The element at (i, j) is derived from `Kernel::Philox4x32()` with the
+ * counter `(i, j)` and the key `_seed`, so it does not depend on the order in
+ * which elements are generated. The same seed always yields the same matrix,
+ * whether it is evaluated sequentially, with `Exec::Par` or at compile time.
+ *
+ * Floating-point values are uniform in `[_lo, _hi)` (up to rounding of the
+ * final scaling); integral values are uniform in `[_lo, _hi]`.
+ *
+ * Used as `op_type` in `Nullary<_matrix, Random<_value>>` expression
+ * nodes.
+ *
+ * @tparam _value The generated value type (arithmetic or a 16-bit float,
+ * which is generated as `float` and rounded).
+ */
+template <typename _value>
+struct Random {
+  static_assert(std::is_arithmetic_v<_value> || Types::is_float16_v<_value>,
+                "Error: `_value` must be an arithmetic type.");
+
+  /**
+   * @brief Verifies that the core stores `_value`.
+   */
+  template <typename _core_impl>
+  constexpr static bool is_valid_core_impl =
+      std::is_same_v<typename _core_impl::type_traits::value_type, _value>;
+
+  /**
+   * @brief Always valid—any shape can be filled.
+   */
+  template <typename>
+  constexpr static bool is_valid_dimension = true;
+
+  /**
+   * @brief Cost of the generator: ten Philox rounds of six integer operations
+   * per element, and no reads.
+   */
+  template <typename _core_impl>
+  constexpr static Cost cost =
+      Cost{60 * _core_impl::size_traits::rows * _core_impl::size_traits::cols};
+
+  /**
+   * @brief Returns the random value at (i, j).
+   *
+   * @param i Row index.
+   * @param j Column index.
+   * @return A value between `_lo` and `_hi`.
+   */
+  constexpr _value operator()(std::size_t i, std::size_t j) const;
+
+  /// Key of the generator; distinct seeds give independent matrices.
+  std::uint64_t _seed = 0;
+
+  /// Lower bound of the generated values.
+  _value _lo = _value(0);
+
+  /// Upper bound of the generated values.
+  _value _hi = _value(1);
+};
+
+}  // namespace Sglty::Expr
+
+namespace Sglty::Op::Gen {
+
+/**
+ * @brief Creates a lazy uniform random matrix.
+ *
+ * @tparam _matrix The matrix type whose shape and values are generated.
+ * @param _seed Key of the generator.
+ * @param _lo   Lower bound of the values.
+ * @param _hi   Upper bound of the values.
+ * @return A `Nullary<_matrix, Expr::Random<value_type>>` expression.
+ */
+template <typename _matrix>
+constexpr auto Random(std::uint64_t _seed,
+                      const typename _matrix::value_type& _lo,
+                      const typename _matrix::value_type& _hi);
+
+}  // namespace Sglty::Op::Gen
+
+#include "Impl/Random.tpp"
+
+// Singularity/Op/Gen/Random.hpp
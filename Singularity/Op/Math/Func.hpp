@@ -0,0 +1,149 @@
+#pragma once
+
+#include <cstddef>
+
+#include "../../Expr/Cost.hpp"
+#include "../../Expr/Unary.hpp"
+#include "../../Kernel/Math.hpp"
+
+namespace Sglty::Expr {
+
+/**
+ * @brief Compile-time element-wise function.
+ *
+ * Represents `f(matrix)` or `f(expression)` for one of the functions in
+ * `Kernel/Math.hpp` (`Kernel::Exp`, `Kernel::Log`, `Kernel::Tanh`,
+ * `Kernel::Sqrt`, `Kernel::Abs`). Each element is `_fn{}(op(i, j))`, so the
+ * function fuses into the surrounding expression like any other node.
+ *
+ * When a `Func` node is assigned to a contiguous `float` or `double` matrix,
+ * `Expr::Assign()` writes the operand into the destination a block of rows
+ * at a time and runs `_fn::Apply()` over each block, i.e. the SIMD version of
+ * the same approximation.
+ *
+ * Used as `op_type` in `Unary<_operand, Func<_fn>>` expression nodes.
+ *
+ * @tparam _fn The element-wise function (a `Kernel` math function object).
+ */
+template <typename _fn>
+struct Func {
+  /**
+   * @brief Row count of the result.
+   *
+   * Matches the input operand.
+   */
+  template <typename _operand>
+  constexpr static std::size_t rows = _operand::rows;
+
+  /**
+   * @brief Column count of the result.
+   *
+   * Matches the input operand.
+   */
+  template <typename _operand>
+  constexpr static std::size_t cols = _operand::cols;
+
+  /**
+   * @brief Resulting core implementation.
+   *
+   * The operand’s `core_impl` rebound to its own shape; the value type is
+   * kept, so e.g. `Exp` of an integer matrix is truncated on store.
+   */
+  template <typename _operand>
+  using core_impl = typename _operand::core_impl::
+      template core_rebind_size<rows<_operand>, cols<_operand>>;
+
+  /**
+   * @brief Always valid—element-wise functions preserve core layout.
+   */
+  template <typename>
+  constexpr static bool is_valid_core_impl = true;
+
+  /**
+   * @brief Always valid—element-wise functions do not change dimensions.
+   */
+  template <typename>
+  constexpr static bool is_valid_dimension = true;
+
+  /**
+   * @brief Cost of the function: `_fn::flops` per element plus one read of
+   * the operand.
+   */
+  template <typename _operand>
+  constexpr static Cost cost =
+      OperandCost<_operand>() +
+      Cost{rows<_operand> * cols<_operand> * _fn::flops};
+
+  /**
+   * @brief Applies the function to the element at (i, j).
+   *
+   * @param op Operand expression.
+   * @param i Row index.
+   * @param j Column index.
+   * @return `_fn{}(op(i, j))`
+   */
+  template <typename _operand>
+  constexpr auto operator()(const _operand& op,
+                            std::size_t i,
+                            std::size_t j) const;
+};
+
+}  // namespace Sglty::Expr
+
+namespace Sglty::Op::Math {
+
+/**
+ * @brief Element-wise exponential, `e^x`.
+ *
+ * @tparam _operand A valid matrix expression.
+ * @param _o Operand.
+ * @return A `Unary<_operand, Expr::Func<Kernel::Exp>>`.
+ */
+template <typename _operand>
+constexpr auto Exp(const _operand& _o);
+
+/**
+ * @brief Element-wise natural logarithm.
+ *
+ * @tparam _operand A valid matrix expression.
+ * @param _o Operand.
+ * @return A `Unary<_operand, Expr::Func<Kernel::Log>>`.
+ */
+template <typename _operand>
+constexpr auto Log(const _operand& _o);
+
+/**
+ * @brief Element-wise hyperbolic tangent.
+ *
+ * @tparam _operand A valid matrix expression.
+ * @param _o Operand.
+ * @return A `Unary<_operand, Expr::Func<Kernel::Tanh>>`.
+ */
+template <typename _operand>
+constexpr auto Tanh(const _operand& _o);
+
+/**
+ * @brief Element-wise square root.
+ *
+ * @tparam _operand A valid matrix expression.
+ * @param _o Operand.
+ * @return A `Unary<_operand, Expr::Func<Kernel::Sqrt>>`.
+ */
+template <typename _operand>
+constexpr auto Sqrt(const _operand& _o);
+
+/**
+ * @brief Element-wise absolute value.
+ *
+ * @tparam _operand A valid matrix expression.
+ * @param _o Operand.
+ * @return A `Unary<_operand, Expr::Func<Kernel::Abs>>`.
+ */
+template <typename _operand>
+constexpr auto Abs(const _operand& _o);
+
+}  // namespace Sglty::Op::Math
+
+#include "Impl/Func.tpp"
+
+// Singularity/Op/Math/Func.hpp
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "../Func.hpp"
+
+#include <cstddef>
+#include <type_traits>
+
+#include "../../../Expr/Assign.hpp"
+#include "../../../Expr/Unary.hpp"
+#include "../../../Kernel/Math.hpp"
+
+namespace Sglty::Expr {
+
+template <typename _fn>
+template <typename _operand>
+constexpr auto Func<_fn>::operator()(const _operand& op,
+                                     std::size_t i,
+                                     std::size_t j) const {
+  return _fn{}(op(i, j));
+}
+
+namespace Impl {
+
+template <typename _operand, typename _fn>
+struct IsMathFunc<Unary<_operand, Func<_fn>>> : std::true_type {
+  template <typename _Tp>
+  constexpr static bool is_lane_v = Kernel::Impl::is_math_lane_v<_Tp>;
+
+  constexpr static const _operand& Operand(
+      const Unary<_operand, Func<_fn>>& _e) {
+    return _e._o;
+  }
+
+  template <typename _Tp>
+  static void Apply(const Unary<_operand, Func<_fn>>&,
+                    _Tp* _p,
+                    std::size_t _n) {
+    _fn::Apply(_p, _p, _n);
+  }
+};
+
+}  // namespace Impl
+
+}  // namespace Sglty::Expr
+
+namespace Sglty::Op::Math {
+
+template <typename _operand>
+constexpr auto Exp(const _operand& _o) {
+  return Expr::Unary<_operand, Expr::Func<Kernel::Exp>>(_o);
+}
+
+template <typename _operand>
+constexpr auto Log(const _operand& _o) {
+  return Expr::Unary<_operand, Expr::Func<Kernel::Log>>(_o);
+}
+
+template <typename _operand>
+constexpr auto Tanh(const _operand& _o) {
+  return Expr::Unary<_operand, Expr::Func<Kernel::Tanh>>(_o);
+}
+
+template <typename _operand>
+constexpr auto Sqrt(const _operand& _o) {
+  return Expr::Unary<_operand, Expr::Func<Kernel::Sqrt>>(_o);
+}
+
+template <typename _operand>
+constexpr auto Abs(const _operand& _o) {
+  return Expr::Unary<_operand, Expr::Func<Kernel::Abs>>(_o);
+}
+
+}  // namespace Sglty::Op::Math
+
+// Singularity/Op/Math/Impl/Func.tpp
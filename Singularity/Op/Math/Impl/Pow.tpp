@@ -0,0 +1,59 @@
+#pragma once
+
+#include "../Pow.hpp"
+
+#include <cstddef>
+#include <type_traits>
+
+#include "../../../Expr/Assign.hpp"
+#include "../../../Expr/Binary.hpp"
+#include "../../../Kernel/Math.hpp"
+#include "../../../Traits/Expr.hpp"
+
+namespace Sglty::Expr {
+
+template <typename _lhs, typename _rhs>
+constexpr auto PowScalar::operator()(const _lhs& _l,
+                                     const _rhs& _r,
+                                     std::size_t i,
+                                     std::size_t j) const {
+  return Kernel::Pow{}(_l(i, j), _r);
+}
+
+namespace Impl {
+
+template <typename _lhs, typename _rhs>
+struct IsMathFunc<Binary<_lhs, _rhs, PowScalar>> : std::true_type {
+  template <typename _Tp>
+  constexpr static bool is_lane_v = Kernel::Impl::is_math_lane_v<_Tp>;
+
+  constexpr static const _lhs& Operand(
+      const Binary<_lhs, _rhs, PowScalar>& _e) {
+    return _e._l;
+  }
+
+  template <typename _Tp>
+  static void Apply(const Binary<_lhs, _rhs, PowScalar>& _e,
+                    _Tp* _p,
+                    std::size_t _n) {
+    Kernel::Pow::Apply(_p, _p, _n, _e._r);
+  }
+};
+
+}  // namespace Impl
+
+}  // namespace Sglty::Expr
+
+namespace Sglty::Op::Math {
+
+template <typename _lhs, typename _rhs>
+constexpr auto Pow(const _lhs& _l, const _rhs& _r)
+    -> std::enable_if_t<Traits::Expr::is_valid_v<_lhs> &&
+                            std::is_arithmetic_v<_rhs>,
+                        Expr::Binary<_lhs, _rhs, Expr::PowScalar>> {
+  return Expr::Binary<_lhs, _rhs, Expr::PowScalar>(_l, _r);
+}
+
+}  // namespace Sglty::Op::Math
+
+// Singularity/Op/Math/Impl/Pow.tpp
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+#include "../../Expr/Binary.hpp"
+#include "../../Expr/Cost.hpp"
+#include "../../Kernel/Math.hpp"
+#include "../../Traits/Expr.hpp"
+
+namespace Sglty::Expr {
+
+/**
+ * @brief Compile-time element-wise power with a scalar exponent.
+ *
+ * Represents `matrix^s` element by element, evaluated with `Kernel::Pow`.
+ * Like `Func`, an assignment to a contiguous `float` or `double` matrix runs
+ * `Kernel::Pow::Apply()` over the destination.
+ *
+ * Used as `op_type` in a `Binary<_lhs, _rhs, PowScalar>` expression node,
+ * with the exponent as `_rhs`.
+ */
+struct PowScalar {
+  /**
+   * @brief Row count of the result.
+   *
+   * Matches the row count of the matrix.
+   */
+  template <typename _lhs, typename _rhs>
+  constexpr static std::size_t rows = _lhs::rows;
+
+  /**
+   * @brief Column count of the result.
+   *
+   * Matches the column count of the matrix.
+   */
+  template <typename _lhs, typename _rhs>
+  constexpr static std::size_t cols = _lhs::cols;
+
+  /**
+   * @brief Resulting core implementation.
+   *
+   * The matrix operand's core implementation rebound to its own shape, so
+   * non-owning cores produce an owning result.
+   */
+  template <typename _lhs, typename _rhs>
+  using core_impl =
+      typename _lhs::core_impl::template core_rebind_size<rows<_lhs, _rhs>,
+                                                          cols<_lhs, _rhs>>;
+
+  /**
+   * @brief Always valid—powers preserve core layout.
+   */
+  template <typename, typename>
+  constexpr static bool is_valid_core_impl = true;
+
+  /**
+   * @brief Always valid—powers do not change dimensions.
+   */
+  template <typename, typename>
+  constexpr static bool is_valid_dimension = true;
+
+  /**
+   * @brief Cost of the power: `Kernel::Pow::flops` per element plus one read
+   * of the matrix operand.
+   */
+  template <typename _lhs, typename _rhs>
+  constexpr static Cost cost =
+      OperandCost<_lhs>() +
+      Cost{rows<_lhs, _rhs> * cols<_lhs, _rhs> * Kernel::Pow::flops};
+
+  /**
+   * @brief Raises the element at (i, j) to the scalar exponent.
+   *
+   * @param _l Matrix operand.
+   * @param _r Exponent.
+   * @param i Row index.
+   * @param j Column index.
+   * @return `Kernel::Pow{}(_l(i, j), _r)`
+   */
+  template <typename _lhs, typename _rhs>
+  constexpr auto operator()(const _lhs& _l,
+                            const _rhs& _r,
+                            std::size_t i,
+                            std::size_t j) const;
+};
+
+}  // namespace Sglty::Expr
+
+namespace Sglty::Op::Math {
+
+/**
+ * @brief Raises every element of a matrix expression to a scalar power.
+ *
+ * @tparam _lhs A valid matrix expression.
+ * @tparam _rhs An arithmetic exponent.
+ * @param _l Base.
+ * @param _r Exponent.
+ * @return A `Binary<_lhs, _rhs, Expr::PowScalar>`.
+ */
+template <typename _lhs, typename _rhs>
+constexpr auto Pow(const _lhs& _l, const _rhs& _r)
+    -> std::enable_if_t<Traits::Expr::is_valid_v<_lhs> &&
+                            std::is_arithmetic_v<_rhs>,
+                        Expr::Binary<_lhs, _rhs, Expr::PowScalar>>;
+
+}  // namespace Sglty::Op::Math
+
+#include "Impl/Pow.tpp"
+
+// Singularity/Op/Math/Pow.hpp
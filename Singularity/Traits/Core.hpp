@@ -1,5 +1,9 @@
 #pragma once
 
+#include "../Config.hpp"
+
+#include <cstddef>
+
 #include "../Core/Enums.hpp"
 
 namespace Sglty::Traits::Core {
@@ -181,6 +185,10 @@ extern const bool has_member_functions_v;
  *
  * Required for all core implementations used.
  *
+ * When `SGLTY_HAS_CONCEPTS` is set, each check is also available as a C++20
+ * concept of the same name in PascalCase (e.g. `Sglty::Traits::Core::IsValid`),
+ * and the `_v` variables are defined in terms of those concepts.
+ *
  * @tparam _core_impl Core implementation type being validated.
  *
  * @see `Sglty::Traits::Core::has_size_traits_v`
@@ -192,6 +200,101 @@ extern const bool has_member_functions_v;
 template <typename _core_impl>
 extern const bool is_valid_v;
 
+/**
+ * @brief Distance, in elements, between (i, j) and (i + 1, j) in `Data()`.
+ *
+ * Taken from `_core_impl::core_row_stride` if the core defines it; otherwise
+ * derived from `core_major` for densely packed storage (`cols` for row-major,
+ * `1` for column-major).
+ *
+ * @tparam _core_impl Core implementation type being inspected.
+ */
+template <typename _core_impl>
+extern const std::size_t row_stride_v;
+
+/**
+ * @brief Distance, in elements, between (i, j) and (i, j + 1) in `Data()`.
+ *
+ * Taken from `_core_impl::core_col_stride` if the core defines it; otherwise
+ * derived from `core_major` (`1` for row-major, `rows` for column-major).
+ *
+ * @tparam _core_impl Core implementation type being inspected.
+ */
+template <typename _core_impl>
+extern const std::size_t col_stride_v;
+
+/**
+ * @brief Checks whether a core stores its elements densely packed in
+ * `core_major` order, i.e. whether `Data()` is a single array of
+ * `rows * cols` elements.
+ *
+ * Code that reads or writes `Data()` directly (I/O, snapshots, `memcpy`-style
+ * kernels) requires it; strided cores such as `Sglty::Core::Map` with padding
+ * are only accessed through `At()`.
+ *
+ * @tparam _core_impl Core implementation type being inspected.
+ *
+ * @see Sglty::Traits::Core::row_stride_v
+ * @see Sglty::Traits::Core::col_stride_v
+ */
+template <typename _core_impl>
+extern const bool is_contiguous_v;
+
+/**
+ * @brief Distance, in elements, between the starts of consecutive rows
+ * (row-major) or columns (column-major) in `Data()`: the leading dimension.
+ *
+ * Equal to `cols` or `rows` for packed storage, larger for padded cores such
+ * as `Sglty::Core::Padded`.
+ *
+ * @tparam _core_impl Core implementation type being inspected.
+ */
+template <typename _core_impl>
+extern const std::size_t outer_stride_v;
+
+/**
+ * @brief Checks whether each row (row-major) or column (column-major) of a
+ * core is a contiguous run of elements in `Data()`, possibly followed by
+ * padding up to `outer_stride_v`.
+ *
+ * Weaker than `is_contiguous_v`: kernels that work line by line (copies,
+ * transposes, packing for products) accept it and step by `outer_stride_v`.
+ *
+ * @tparam _core_impl Core implementation type being inspected.
+ */
+template <typename _core_impl>
+extern const bool is_inner_contiguous_v;
+
+/**
+ * @brief Checks whether copies of a core share its storage until one of
+ * them is written, i.e. whether the core provides `Unique()` and `Discard()`
+ * (e.g. `Sglty::Core::Shared`).
+ *
+ * Mutable `At()` and `Data()` of such a core may copy the storage, so code
+ * that writes many elements takes `Data()` once instead.
+ *
+ * @tparam _core_impl Core implementation type being inspected.
+ */
+template <typename _core_impl>
+extern const bool is_copy_on_write_v;
+
+/**
+ * @brief Checks whether expression nodes hold matrices of a core by
+ * reference instead of by value.
+ *
+ * Taken from `_core_impl::core_held_by_reference` if the core defines it;
+ * otherwise `false`. Cores whose copies are expensive or not usable in
+ * constant expressions set it (`Sglty::Core::Heap`, `Sglty::Core::Padded`,
+ * `Sglty::Core::Shared`, `Sglty::Core::Mapped`); `Sglty::Core::Dense` keeps
+ * by-value operands so its expressions stay `constexpr`.
+ *
+ * @tparam _core_impl Core implementation type being inspected.
+ *
+ * @see Sglty::Expr::operand_t
+ */
+template <typename _core_impl>
+extern const bool is_held_by_reference_v;
+
 }  // namespace Sglty::Traits::Core
 
 #include "Impl/Core.tpp"
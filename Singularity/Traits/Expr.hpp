@@ -1,5 +1,7 @@
 #pragma once
 
+#include "../Config.hpp"
+
 namespace Sglty::Traits::Expr {
 
 /**
@@ -53,6 +55,9 @@ extern const bool has_interface_v;
  *
  * Required for all expression types used.
  *
+ * When `SGLTY_HAS_CONCEPTS` is set, each check is also available as a C++20
+ * concept (`HasTagBase`, `HasInterface`, `IsValid`) in this namespace.
+ *
  * @tparam _expr Expression type being validated.
  *
  * Note that `static_asserts` may be present to validate passed Operations
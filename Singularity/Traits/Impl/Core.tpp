@@ -2,7 +2,13 @@
 
 #include "../Core.hpp"
 
+#include <cstddef>
 #include <type_traits>
+#include <utility>
+
+#if SGLTY_HAS_CONCEPTS
+#include <concepts>
+#endif
 
 namespace Sglty::Traits::Core {
 
@@ -20,6 +26,83 @@ struct Get {
       "Error: Invalid combination of `_core_type` and `_core_major` passed.");
 };
 
+#if SGLTY_HAS_CONCEPTS
+
+template <typename _core_impl>
+concept HasSizeTraits = requires {
+  requires std::is_integral_v<decltype(_core_impl::size_traits::rows)>;
+  requires std::is_integral_v<decltype(_core_impl::size_traits::cols)>;
+};
+
+template <typename _core_impl>
+concept HasTypeTraits = requires {
+  typename _core_impl::type_traits;
+  typename _core_impl::type_traits::size_type;
+  typename _core_impl::type_traits::value_type;
+  typename _core_impl::type_traits::difference_type;
+  typename _core_impl::type_traits::reference;
+  typename _core_impl::type_traits::const_reference;
+  typename _core_impl::type_traits::pointer;
+  typename _core_impl::type_traits::const_pointer;
+};
+
+template <typename _core_impl>
+concept HasCoreTraits = requires {
+  requires std::is_same_v<decltype(_core_impl::core_traits::core_type),
+                          const Sglty::Core::Type>;
+  requires std::is_same_v<decltype(_core_impl::core_traits::core_major),
+                          const Sglty::Core::Major>;
+};
+
+template <typename _core_impl>
+concept HasRebindSizeTraits = requires {
+  typename _core_impl::core_base;
+  typename _core_impl::template core_rebind_size<0, 0>;
+};
+
+template <typename _core_impl>
+concept HasMemberFunctions =
+    HasTypeTraits<_core_impl> &&
+    requires(_core_impl& _c, const _core_impl& _cc, std::size_t _i) {
+      {
+        _c.At(_i, _i)
+      } -> std::same_as<typename _core_impl::type_traits::reference>;
+      {
+        _cc.At(_i, _i)
+      } -> std::same_as<typename _core_impl::type_traits::const_reference>;
+      { _c.Data() } -> std::same_as<typename _core_impl::type_traits::pointer>;
+      {
+        _cc.Data()
+      } -> std::same_as<typename _core_impl::type_traits::const_pointer>;
+    };
+
+template <typename _core_impl>
+concept IsValid = HasSizeTraits<_core_impl> && HasTypeTraits<_core_impl> &&
+                  HasCoreTraits<_core_impl> &&
+                  HasRebindSizeTraits<_core_impl> &&
+                  HasMemberFunctions<_core_impl>;
+
+template <typename _core_impl>
+constexpr inline bool has_size_traits_v = HasSizeTraits<_core_impl>;
+
+template <typename _core_impl>
+constexpr inline bool has_type_traits_v = HasTypeTraits<_core_impl>;
+
+template <typename _core_impl>
+constexpr inline bool has_core_traits_v = HasCoreTraits<_core_impl>;
+
+template <typename _core_impl>
+constexpr inline bool has_rebind_size_traits_v =
+    HasRebindSizeTraits<_core_impl>;
+
+template <typename _core_impl>
+constexpr inline bool has_member_functions_v = HasMemberFunctions<_core_impl>;
+
+template <typename _core_impl>
+constexpr inline bool is_valid_v = IsValid<_core_impl>;
+
+#else
+
 namespace Impl {
 
 template <typename, typename _enable = void>
@@ -149,6 +232,88 @@ constexpr inline bool has_member_functions_v =
 template <typename _core_impl>
 constexpr bool is_valid_v = Impl::IsValid<_core_impl>::value;
 
+#endif  // SGLTY_HAS_CONCEPTS
+
+namespace Impl {
+
+/// Strides of densely packed storage in `core_major` order.
+template <typename _core_impl>
+struct PackedStrides {
+  static constexpr bool row_major =
+      _core_impl::core_traits::core_major == Sglty::Core::Major::Row;
+
+  static constexpr std::size_t row =
+      row_major ? std::size_t(_core_impl::size_traits::cols) : 1;
+  static constexpr std::size_t col =
+      row_major ? 1 : std::size_t(_core_impl::size_traits::rows);
+};
+
+template <typename _core_impl, typename _enable = void>
+struct Strides : PackedStrides<_core_impl> {};
+
+/// Strides declared by the core itself.
+template <typename _core_impl>
+struct Strides<_core_impl,
+               std::void_t<decltype(_core_impl::core_row_stride),
+                           decltype(_core_impl::core_col_stride)>> {
+  static constexpr std::size_t row = _core_impl::core_row_stride;
+  static constexpr std::size_t col = _core_impl::core_col_stride;
+};
+
+template <typename _core_impl, typename _enable = void>
+struct IsCopyOnWrite : std::false_type {};
+
+template <typename _core_impl>
+struct IsCopyOnWrite<
+    _core_impl,
+    std::void_t<decltype(std::declval<const _core_impl&>().Unique()),
+                decltype(std::declval<_core_impl&>().Discard())>>
+    : std::true_type {};
+
+template <typename _core_impl, typename _enable = void>
+struct IsHeldByReference : std::false_type {};
+
+template <typename _core_impl>
+struct IsHeldByReference<
+    _core_impl,
+    std::void_t<decltype(_core_impl::core_held_by_reference)>>
+    : std::bool_constant<_core_impl::core_held_by_reference> {};
+
+}  // namespace Impl
+
+template <typename _core_impl>
+constexpr inline std::size_t row_stride_v = Impl::Strides<_core_impl>::row;
+
+template <typename _core_impl>
+constexpr inline std::size_t col_stride_v = Impl::Strides<_core_impl>::col;
+
+template <typename _core_impl>
+constexpr inline bool is_contiguous_v =
+    _core_impl::core_traits::core_type == Sglty::Core::Type::Dense &&
+    row_stride_v<_core_impl> == Impl::PackedStrides<_core_impl>::row &&
+    col_stride_v<_core_impl> == Impl::PackedStrides<_core_impl>::col;
+
+template <typename _core_impl>
+constexpr inline std::size_t outer_stride_v =
+    _core_impl::core_traits::core_major == Sglty::Core::Major::Row
+        ? row_stride_v<_core_impl>
+        : col_stride_v<_core_impl>;
+
+template <typename _core_impl>
+constexpr inline bool is_inner_contiguous_v =
+    _core_impl::core_traits::core_type == Sglty::Core::Type::Dense &&
+    (_core_impl::core_traits::core_major == Sglty::Core::Major::Row
+         ? col_stride_v<_core_impl>
+         : row_stride_v<_core_impl>) == 1;
+
+template <typename _core_impl>
+constexpr inline bool is_copy_on_write_v =
+    Impl::IsCopyOnWrite<_core_impl>::value;
+
+template <typename _core_impl>
+constexpr inline bool is_held_by_reference_v =
+    Impl::IsHeldByReference<_core_impl>::value;
+
 }  // namespace Sglty::Traits::Core
 
 // Singularity/Traits/Impl/Core.tpp
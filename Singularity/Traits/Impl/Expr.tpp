@@ -13,6 +13,33 @@ struct Tag;  // forward declaration
 
 namespace Sglty::Traits::Expr {
 
+#if SGLTY_HAS_CONCEPTS
+
+template <typename _expr>
+concept HasTagBase = std::is_base_of_v<Sglty::Expr::Tag, _expr>;
+
+template <typename _expr>
+concept HasInterface = requires(const _expr& _e, std::size_t _i) {
+  static_cast<std::size_t>(_expr::rows);
+  static_cast<std::size_t>(_expr::cols);
+  typename _expr::core_impl;
+  _e(_i, _i);
+};
+
+template <typename _expr>
+concept IsValid = HasTagBase<_expr> && HasInterface<_expr>;
+
+template <typename _expr>
+constexpr inline bool has_tag_base_v = HasTagBase<_expr>;
+
+template <typename _expr>
+constexpr inline bool has_interface_v = HasInterface<_expr>;
+
+template <typename _expr>
+constexpr inline bool is_valid_v = IsValid<_expr>;
+
+#else
+
 namespace Impl {
 
 template <typename _expr, typename _enable = void>
@@ -47,6 +74,8 @@ constexpr inline bool has_interface_v = Impl::HasInterface<_expr>::value;
 template <typename _expr>
 constexpr inline bool is_valid_v = Impl::IsValid<_expr>::value;
 
+#endif  // SGLTY_HAS_CONCEPTS
+
 }  // namespace Sglty::Traits::Expr
 
 // Singularity/Traits/Impl/Expr.tpp
@@ -2,14 +2,85 @@
 
 #include "../Op.hpp"
 
+#include <cstddef>
 #include <type_traits>
+#include <utility>
 
+#include "../../Core/Dummy.hpp"
 #include "../../Expr/Dummy.hpp"
 
 namespace Sglty::Traits::Op {
 
+#if SGLTY_HAS_CONCEPTS
+
+template <typename _op>
+concept IsNullary = requires(const _op& _o, std::size_t _i) {
+  _op::template is_valid_core_impl<Sglty::Core::Dummy>;
+  _op::template is_valid_dimension<Sglty::Core::Dummy>;
+  _o(_i, _i);
+};
+
+template <typename _op>
+concept IsUnary = requires(const _op& _o,
+                           const Sglty::Expr::Dummy& _d,
+                           std::size_t _i) {
+  _op::template rows<Sglty::Expr::Dummy>;
+  _op::template cols<Sglty::Expr::Dummy>;
+  typename _op::template core_impl<Sglty::Expr::Dummy>;
+  _op::template is_valid_core_impl<Sglty::Expr::Dummy>;
+  _op::template is_valid_dimension<Sglty::Expr::Dummy>;
+  _o(_d, _i, _i);
+};
+
+template <typename _op>
+concept IsBinary = requires(const _op& _o,
+                            const Sglty::Expr::Dummy& _d,
+                            std::size_t _i) {
+  _op::template rows<Sglty::Expr::Dummy, Sglty::Expr::Dummy>;
+  _op::template cols<Sglty::Expr::Dummy, Sglty::Expr::Dummy>;
+  typename _op::template core_impl<Sglty::Expr::Dummy, Sglty::Expr::Dummy>;
+  _op::template is_valid_core_impl<Sglty::Expr::Dummy, Sglty::Expr::Dummy>;
+  _op::template is_valid_dimension<Sglty::Expr::Dummy, Sglty::Expr::Dummy>;
+  _o(_d, _d, _i, _i);
+};
+
+template <typename _op>
+concept IsValid = IsNullary<_op> || IsUnary<_op> || IsBinary<_op>;
+
+template <typename _op>
+constexpr inline bool is_nullary_v = IsNullary<_op>;
+
+template <typename _op>
+constexpr inline bool is_unary_v = IsUnary<_op>;
+
+template <typename _op>
+constexpr inline bool is_binary_v = IsBinary<_op>;
+
+template <typename _op>
+constexpr inline bool is_valid_v = IsValid<_op>;
+
+template <typename _op, typename... _operands>
+concept HasCost = requires { _op::template cost<_operands...>; };
+
+template <typename _op, typename... _operands>
+constexpr inline bool has_cost_v = HasCost<_op, _operands...>;
+
+#else
+
 namespace Impl {
 
+template <typename _op, typename _enable = void>
+struct IsNullary : std::false_type {};
+
+template <typename _op>
+struct IsNullary<
+    _op,
+    std::void_t<decltype(_op::template is_valid_core_impl<Sglty::Core::Dummy>),
+                decltype(_op::template is_valid_dimension<Sglty::Core::Dummy>),
+                decltype(std::declval<_op>().operator()(std::size_t{},
+                                                        std::size_t{}))>>
+    : std::true_type {};
+
 template <typename _op, typename _enable = void>
 struct IsUnary : std::false_type {};
 
@@ -48,10 +119,22 @@ struct IsBinary<
             std::size_t{}))>> : std::true_type {};
 
 template <typename _op>
-struct IsValid : std::disjunction<IsUnary<_op>, IsBinary<_op>> {};
+struct IsValid
+    : std::disjunction<IsNullary<_op>, IsUnary<_op>, IsBinary<_op>> {};
+
+template <typename _enable, typename _op, typename... _operands>
+struct HasCost : std::false_type {};
+
+template <typename _op, typename... _operands>
+struct HasCost<std::void_t<decltype(_op::template cost<_operands...>)>,
+               _op,
+               _operands...> : std::true_type {};
 
 }  // namespace Impl
 
+template <typename _op>
+constexpr inline bool is_nullary_v = Impl::IsNullary<_op>::value;
+
 template <typename _op>
 constexpr inline bool is_unary_v = Impl::IsUnary<_op>::value;
 
@@ -61,6 +144,12 @@ constexpr inline bool is_binary_v = Impl::IsBinary<_op>::value;
 template <typename _op>
 constexpr inline bool is_valid_v = Impl::IsValid<_op>::value;
 
+template <typename _op, typename... _operands>
+constexpr inline bool has_cost_v =
+    Impl::HasCost<void, _op, _operands...>::value;
+
+#endif  // SGLTY_HAS_CONCEPTS
+
 }  // namespace Sglty::Traits::Op
 
 // Singularity/Traits/Impl/Op.tpp
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "../Config.hpp"
+
 namespace Sglty::Traits::Op {
 
 /**
@@ -79,10 +81,47 @@ template <typename _op>
 extern const bool is_binary_v;
 
 /**
- * @brief Checks whether an operator satisfies either unary or binary semantics.
+ * @brief Checks whether an operator satisfies nullary (generator) semantics.
+ *
+ * A nullary operator has no operand; the shape and core come from the
+ * `Sglty::Expr::Nullary` node holding it. A valid nullary operator is of the
+ * form:
+ * ```
+ * struct SomeOp {
+ *   template <typename _core_impl>
+ *   static constexpr bool is_valid_core_impl = // some value //;
+ *
+ *   template <typename _core_impl>
+ *   static constexpr bool is_valid_dimension = // some value //;
+ *
+ *   auto operator()(std::size_t, std::size_t) const;
+ * };
+ * ```
+ *
+ * - `is_valid_core_impl` ensures the generated values suit the core, e.g.
+ *    that the value types match.
+ *
+ * - `is_valid_dimension` ensures the core's shape is valid for this
+ *    generator.
+ *
+ * Nullary operators may carry state (a fill value, a seed), so the node
+ * stores them by value.
+ *
+ * @tparam _op Operator type being inspected.
+ *
+ * @see Sglty::Traits::Op::is_valid_v
+ */
+template <typename _op>
+extern const bool is_nullary_v;
+
+/**
+ * @brief Checks whether an operator satisfies nullary, unary or binary
+ * semantics.
  *
  * Combines:
  *
+ * - `is_nullary_v`
+ *
  * - `is_unary_op_v`
  *
  * - `is_binary_op_v`
@@ -90,6 +129,10 @@ extern const bool is_binary_v;
  * This is the primary check used for validating operator objects in expression
  * templates.
  *
+ * When `SGLTY_HAS_CONCEPTS` is set, each check is also available as a C++20
+ * concept (`IsNullary`, `IsUnary`, `IsBinary`, `IsValid`, `HasCost`) in this
+ * namespace.
+ *
  * @tparam _op Operator type being validated.
  *
  * @see Sglty::Traits::Expr::is_unary_op_v
@@ -98,6 +141,33 @@ extern const bool is_binary_v;
 template <typename _op>
 extern const bool is_valid_v;
 
+/**
+ * @brief Checks whether an operator provides a cost estimate for the given
+ * operands.
+ *
+ * The `cost` member is optional. When present it is of the form:
+ * ```
+ * struct SomeOp {
+ *   template <typename _lhs, typename _rhs>
+ *   static constexpr Sglty::Expr::Cost cost = // some value //;
+ * };
+ * ```
+ * with one template parameter per operand. It describes the work done by the
+ * operation itself plus the reads of its operands (usually via
+ * `Sglty::Expr::OperandCost`). Expression nodes add the result write-back and
+ * their own size on top.
+ *
+ * Operations without `cost` are estimated as one flop per result element
+ * plus one read of every operand.
+ *
+ * @tparam _op       Operator type being inspected.
+ * @tparam _operands Operand expression types.
+ *
+ * @see Sglty::Expr::Cost
+ */
+template <typename _op, typename... _operands>
+extern const bool has_cost_v;
+
 }  // namespace Sglty::Traits::Op
 
 #include "Impl/Op.tpp"
@@ -0,0 +1,195 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "../Fwd.hpp"
+#include "Lanes.hpp"
+
+namespace Sglty::Types {
+
+/**
+ * @brief A batch of `_count` same-shaped small matrices stored interleaved.
+ *
+ * Matrices are grouped into blocks of `_lanes`. Each block is a regular
+ * row-major `Matrix` whose elements are `Lanes<_Tp, _lanes>`, so element
+ * (i, j) of `_lanes` consecutive matrices is contiguous (structure of arrays
+ * within a block, blocks stored one after another). Running an ordinary
+ * expression on a block, e.g. `Block(b) * other.Block(b)`, uses the existing
+ * operations (`Expr::Add`, `Expr::MulMatrix`, `Expr::Trp`, ...) with every
+ * arithmetic instruction covering `_lanes` matrices, which is what makes 3×3
+ * or 4×4 work vectorize.
+ *
+ * `Transform()` applies such an expression to every block; the arithmetic
+ * operators, `Trp()`, `Det()` and `Inv()` are built on it. If `_count` is not
+ * a multiple of `_lanes` the unused lanes of the last block are processed
+ * along with the rest. They start as identity matrices (zero ones if the
+ * shape is not square), and `Inv()` resets them to identity first, so they
+ * never produce non-finite values or floating-point exceptions.
+ *
+ * Blocks are allocated through `Mem::Allocator`.
+ *
+ * @tparam _Tp    The element type.
+ * @tparam _rows  Rows of each matrix.
+ * @tparam _cols  Columns of each matrix.
+ * @tparam _count Number of matrices.
+ * @tparam _lanes Matrices per block; defaults to one 64-byte vector of
+ * `_Tp`.
+ */
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          std::size_t _count,
+          std::size_t _lanes = default_lanes_v<_Tp>>
+class Batch {
+ public:
+  /// The element type of each matrix.
+  using value_type = _Tp;
+
+  /// The element type of a block.
+  using lanes_type = Lanes<_Tp, _lanes>;
+
+  /// A block of `lanes` interleaved matrices.
+  using block_type =
+      Matrix<Core::Dense<lanes_type, _rows, _cols, Core::Major::Row>>;
+
+  /// A single matrix of the batch, as returned by `Get()`.
+  using matrix_type =
+      Matrix<Core::Dense<_Tp, _rows, _cols, Core::Major::Row>>;
+
+  /// Rows of each matrix.
+  constexpr static std::size_t rows = _rows;
+
+  /// Columns of each matrix.
+  constexpr static std::size_t cols = _cols;
+
+  /// Number of matrices.
+  constexpr static std::size_t count = _count;
+
+  /// Matrices per block.
+  constexpr static std::size_t lanes = _lanes;
+
+  /// Number of blocks.
+  constexpr static std::size_t blocks = (_count + _lanes - 1) / _lanes;
+
+  /**
+   * @brief Constructs a batch of zero matrices.
+   *
+   * The unused lanes of a square batch hold identity matrices.
+   */
+  Batch();
+
+  /**
+   * @brief Accesses block `_b`, holding matrices `_b * lanes` onwards.
+   */
+  block_type& Block(std::size_t _b);
+
+  /**
+   * @brief Accesses block `_b` (const version).
+   */
+  const block_type& Block(std::size_t _b) const;
+
+  /**
+   * @brief Accesses element (i, j) of matrix `_k`.
+   */
+  value_type& operator()(std::size_t _k, std::size_t _i, std::size_t _j);
+
+  /**
+   * @brief Accesses element (i, j) of matrix `_k` (const version).
+   */
+  const value_type& operator()(std::size_t _k,
+                               std::size_t _i,
+                               std::size_t _j) const;
+
+  /**
+   * @brief Copies matrix `_k` out of the batch.
+   *
+   * @param _k Index of the matrix.
+   * @return The matrix as a `Dense` matrix.
+   */
+  matrix_type Get(std::size_t _k) const;
+
+  /**
+   * @brief Stores a matrix or expression as matrix `_k`.
+   *
+   * @tparam _expr A valid expression of shape `rows × cols`.
+   * @param _k Index of the matrix.
+   * @param _e The values to store.
+   */
+  template <typename _expr>
+  void Set(std::size_t _k, const _expr& _e);
+
+ private:
+  std::vector<block_type, Mem::Allocator<block_type>> _m_blocks;
+};
+
+/**
+ * @brief Applies a block-wise function to one or more batches.
+ *
+ * `_fn` is called with the corresponding blocks of every batch and may return
+ * any matrix expression over them (`[](const auto& a, const auto& b) {
+ * return a * b + a; }`), which is evaluated into the result block, or a
+ * single `Lanes` value (as `Op::Alg::Det` does), giving a batch of 1×1
+ * matrices. Fusing several operations into one call avoids the intermediate
+ * batches the operators below create.
+ *
+ * @tparam Func    Callable taking one `block_type` per batch.
+ * @tparam _batch  The first batch type.
+ * @tparam _others Further batch types with the same count and lane width.
+ * @param _fn The function.
+ * @param _b  The first batch.
+ * @param _os The remaining batches.
+ * @return A new batch holding the results.
+ */
+template <typename Func, typename _batch, typename... _others>
+auto Transform(Func&& _fn, const _batch& _b, const _others&... _os);
+
+/// Batched sum of corresponding matrices.
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          std::size_t _count,
+          std::size_t _lanes>
+auto operator+(const Batch<_Tp, _rows, _cols, _count, _lanes>& _l,
+               const Batch<_Tp, _rows, _cols, _count, _lanes>& _r);
+
+/// Batched difference of corresponding matrices.
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          std::size_t _count,
+          std::size_t _lanes>
+auto operator-(const Batch<_Tp, _rows, _cols, _count, _lanes>& _l,
+               const Batch<_Tp, _rows, _cols, _count, _lanes>& _r);
+
+/// Batched product of corresponding matrices.
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _inner,
+          std::size_t _cols,
+          std::size_t _count,
+          std::size_t _lanes>
+auto operator*(const Batch<_Tp, _rows, _inner, _count, _lanes>& _l,
+               const Batch<_Tp, _inner, _cols, _count, _lanes>& _r);
+
+/// Batched transpose.
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          std::size_t _count,
+          std::size_t _lanes>
+auto Trp(const Batch<_Tp, _rows, _cols, _count, _lanes>& _b);
+
+/// Batched determinant, as a batch of 1×1 matrices.
+template <typename _Tp, std::size_t _n, std::size_t _count, std::size_t _lanes>
+auto Det(const Batch<_Tp, _n, _n, _count, _lanes>& _b);
+
+/// Batched inverse (see `Op::Alg::Inv`).
+template <typename _Tp, std::size_t _n, std::size_t _count, std::size_t _lanes>
+auto Inv(const Batch<_Tp, _n, _n, _count, _lanes>& _b);
+
+}  // namespace Sglty::Types
+
+#include "Impl/Batch.tpp"
+
+// Singularity/Types/Batch.hpp
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+#include "../Config.hpp"
+
+namespace Sglty::Types {
+
+// The storage types live in their own namespace so argument-dependent lookup
+// does not find the matrix expression operators declared in `Types`.
+namespace Scalar {
+
+/**
+ * @brief IEEE 754 binary16 ("fp16") storage type.
+ *
+ * `Half` stores a value in 16 bits (1 sign, 5 exponent, 10 mantissa bits) and
+ * computes in `float`: it converts implicitly to `float`, and from `float`
+ * with round-to-nearest-even. Arithmetic on halves therefore yields `float`,
+ * so expression nodes accumulate in fp32 (a product of two `Half` matrices
+ * sums `float`s) and round once when the result is stored.
+ *
+ * Conversions use F16C instructions when the target has them and bit
+ * manipulation otherwise (always during constant evaluation). Large blocks
+ * are converted with `Kernel::Convert()`, which `Cast()` and `Kernel::Gemm()`
+ * use so the halved bandwidth is not spent on per-element conversions.
+ */
+struct Half {
+  /// Raw binary16 representation.
+  std::uint16_t bits = 0;
+
+  /**
+   * @brief Constructs positive zero.
+   */
+  constexpr Half() = default;
+
+  /**
+   * @brief Rounds `_v` to the nearest representable half.
+   *
+   * Values beyond the half range become infinities; NaNs stay NaNs.
+   */
+  constexpr Half(float _v);
+
+  /**
+   * @brief Converts to `float` exactly.
+   */
+  constexpr operator float() const;
+
+  /**
+   * @brief Constructs a half from its raw representation.
+   */
+  constexpr static Half FromBits(std::uint16_t _bits);
+
+  constexpr Half& operator+=(float _o);
+  constexpr Half& operator-=(float _o);
+  constexpr Half& operator*=(float _o);
+  constexpr Half& operator/=(float _o);
+};
+
+/**
+ * @brief bfloat16 ("brain float") storage type.
+ *
+ * `BFloat16` keeps the 8-bit exponent of `float` and truncates the mantissa
+ * to 7 bits, so it has the range of fp32 at reduced precision. It behaves
+ * like `Half`: converts implicitly to `float` (exactly) and from `float`
+ * (round-to-nearest-even), and arithmetic yields `float`.
+ */
+struct BFloat16 {
+  /// Raw bfloat16 representation (the upper 16 bits of a `float`).
+  std::uint16_t bits = 0;
+
+  /**
+   * @brief Constructs positive zero.
+   */
+  constexpr BFloat16() = default;
+
+  /**
+   * @brief Rounds `_v` to the nearest representable bfloat16.
+   */
+  constexpr BFloat16(float _v);
+
+  /**
+   * @brief Converts to `float` exactly.
+   */
+  constexpr operator float() const;
+
+  /**
+   * @brief Constructs a bfloat16 from its raw representation.
+   */
+  constexpr static BFloat16 FromBits(std::uint16_t _bits);
+
+  constexpr BFloat16& operator+=(float _o);
+  constexpr BFloat16& operator-=(float _o);
+  constexpr BFloat16& operator*=(float _o);
+  constexpr BFloat16& operator/=(float _o);
+};
+
+}  // namespace Scalar
+
+using Scalar::BFloat16;
+using Scalar::Half;
+
+/**
+ * @brief Checks whether `_Tp` is one of the 16-bit floating-point storage
+ * types (`Half`, `BFloat16`).
+ *
+ * Such types are accepted wherever an arithmetic value type is required
+ * (`Cast()`, generators, I/O) and are computed with in `float`.
+ */
+template <typename _Tp>
+constexpr inline bool is_float16_v =
+    std::is_same_v<std::remove_cv_t<_Tp>, Half> ||
+    std::is_same_v<std::remove_cv_t<_Tp>, BFloat16>;
+
+}  // namespace Sglty::Types
+
+#include "Impl/Float16.tpp"
+
+// Singularity/Types/Float16.hpp
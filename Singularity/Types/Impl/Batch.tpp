@@ -0,0 +1,236 @@
+#pragma once
+
+#include "../Batch.hpp"
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "../Matrix.hpp"
+#include "../../Core/Dense.hpp"
+#include "../../Mem/Allocator.hpp"
+#include "../../Op/Alg/Det.hpp"
+#include "../../Op/Alg/Inv.hpp"
+#include "../../Op/Alg/Trp.hpp"
+#include "../../Op/Arthm/Add.hpp"
+#include "../../Op/Arthm/Mul.hpp"
+#include "../../Op/Arthm/Sub.hpp"
+#include "../../Traits/Expr.hpp"
+
+namespace Sglty::Types {
+
+namespace Impl {
+
+// The batch type holding the per-block results `_result` of `Transform()`.
+template <typename _result, std::size_t _count, typename _enable = void>
+struct BatchOf {
+  static_assert(Traits::Expr::is_valid_v<_result>,
+                "Error: the function must return an expression or `Lanes`.");
+
+  using lanes_type = typename _result::core_impl::type_traits::value_type;
+
+  using type = Batch<typename lanes_type::value_type,
+                     _result::rows,
+                     _result::cols,
+                     _count,
+                     lanes_type::width>;
+};
+
+template <typename _Tp, std::size_t _width, std::size_t _count>
+struct BatchOf<Lanes<_Tp, _width>, _count> {
+  using type = Batch<_Tp, 1, 1, _count, _width>;
+};
+
+// Sets lanes `_used` onwards of a square block to the identity matrix.
+template <typename _block>
+void PadWithIdentity(_block& _m, std::size_t _used) {
+  using lane_type = typename _block::value_type::value_type;
+
+  for (std::size_t i = 0; i < _block::rows; i++) {
+    for (std::size_t j = 0; j < _block::cols; j++) {
+      for (std::size_t k = _used; k < _block::value_type::width; k++) {
+        _m(i, j)[k] = lane_type(i == j ? 1 : 0);
+      }
+    }
+  }
+}
+
+}  // namespace Impl
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          std::size_t _count,
+          std::size_t _lanes>
+Batch<_Tp, _rows, _cols, _count, _lanes>::Batch() : _m_blocks(blocks) {
+  if constexpr (_rows == _cols && _count % _lanes != 0) {
+    Impl::PadWithIdentity(_m_blocks[blocks - 1], _count % _lanes);
+  }
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          std::size_t _count,
+          std::size_t _lanes>
+typename Batch<_Tp, _rows, _cols, _count, _lanes>::block_type&
+Batch<_Tp, _rows, _cols, _count, _lanes>::Block(std::size_t _b) {
+  return _m_blocks[_b];
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          std::size_t _count,
+          std::size_t _lanes>
+const typename Batch<_Tp, _rows, _cols, _count, _lanes>::block_type&
+Batch<_Tp, _rows, _cols, _count, _lanes>::Block(std::size_t _b) const {
+  return _m_blocks[_b];
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          std::size_t _count,
+          std::size_t _lanes>
+typename Batch<_Tp, _rows, _cols, _count, _lanes>::value_type&
+Batch<_Tp, _rows, _cols, _count, _lanes>::operator()(std::size_t _k,
+                                                     std::size_t _i,
+                                                     std::size_t _j) {
+  return _m_blocks[_k / _lanes](_i, _j)[_k % _lanes];
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          std::size_t _count,
+          std::size_t _lanes>
+const typename Batch<_Tp, _rows, _cols, _count, _lanes>::value_type&
+Batch<_Tp, _rows, _cols, _count, _lanes>::operator()(std::size_t _k,
+                                                     std::size_t _i,
+                                                     std::size_t _j) const {
+  return _m_blocks[_k / _lanes](_i, _j)[_k % _lanes];
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          std::size_t _count,
+          std::size_t _lanes>
+typename Batch<_Tp, _rows, _cols, _count, _lanes>::matrix_type
+Batch<_Tp, _rows, _cols, _count, _lanes>::Get(std::size_t _k) const {
+  matrix_type ret;
+  for (std::size_t i = 0; i < _rows; i++) {
+    for (std::size_t j = 0; j < _cols; j++) {
+      ret(i, j) = (*this)(_k, i, j);
+    }
+  }
+  return ret;
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          std::size_t _count,
+          std::size_t _lanes>
+template <typename _expr>
+void Batch<_Tp, _rows, _cols, _count, _lanes>::Set(std::size_t _k,
+                                                   const _expr& _e) {
+  static_assert(Traits::Expr::is_valid_v<_expr>,
+                "Error: `_expr` is not a valid expression type.");
+  static_assert(_expr::rows == _rows && _expr::cols == _cols,
+                "Error: dimension mismatch.");
+
+  for (std::size_t i = 0; i < _rows; i++) {
+    for (std::size_t j = 0; j < _cols; j++) {
+      (*this)(_k, i, j) = static_cast<value_type>(_e(i, j));
+    }
+  }
+}
+
+template <typename Func, typename _batch, typename... _others>
+auto Transform(Func&& _fn, const _batch& _b, const _others&... _os) {
+  static_assert(((_others::count == _batch::count &&
+                  _others::lanes == _batch::lanes) &&
+                 ...),
+                "Error: batches differ in count or lane width.");
+
+  using result = std::decay_t<decltype(_fn(_b.Block(0), _os.Block(0)...))>;
+
+  typename Impl::BatchOf<result, _batch::count>::type ret;
+  for (std::size_t b = 0; b < _batch::blocks; b++) {
+    if constexpr (Traits::Expr::is_valid_v<result>) {
+      ret.Block(b) = _fn(_b.Block(b), _os.Block(b)...);
+    } else {
+      ret.Block(b)(0, 0) = _fn(_b.Block(b), _os.Block(b)...);
+    }
+  }
+  return ret;
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          std::size_t _count,
+          std::size_t _lanes>
+auto operator+(const Batch<_Tp, _rows, _cols, _count, _lanes>& _l,
+               const Batch<_Tp, _rows, _cols, _count, _lanes>& _r) {
+  return Transform([](const auto& l, const auto& r) { return l + r; }, _l, _r);
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          std::size_t _count,
+          std::size_t _lanes>
+auto operator-(const Batch<_Tp, _rows, _cols, _count, _lanes>& _l,
+               const Batch<_Tp, _rows, _cols, _count, _lanes>& _r) {
+  return Transform([](const auto& l, const auto& r) { return l - r; }, _l, _r);
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _inner,
+          std::size_t _cols,
+          std::size_t _count,
+          std::size_t _lanes>
+auto operator*(const Batch<_Tp, _rows, _inner, _count, _lanes>& _l,
+               const Batch<_Tp, _inner, _cols, _count, _lanes>& _r) {
+  return Transform([](const auto& l, const auto& r) { return l * r; }, _l, _r);
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _cols,
+          std::size_t _count,
+          std::size_t _lanes>
+auto Trp(const Batch<_Tp, _rows, _cols, _count, _lanes>& _b) {
+  return Transform([](const auto& m) { return Op::Alg::Trp(m); }, _b);
+}
+
+template <typename _Tp, std::size_t _n, std::size_t _count, std::size_t _lanes>
+auto Det(const Batch<_Tp, _n, _n, _count, _lanes>& _b) {
+  return Transform([](const auto& m) { return Op::Alg::Det(m); }, _b);
+}
+
+template <typename _Tp, std::size_t _n, std::size_t _count, std::size_t _lanes>
+auto Inv(const Batch<_Tp, _n, _n, _count, _lanes>& _b) {
+  using batch = Batch<_Tp, _n, _n, _count, _lanes>;
+
+  batch ret;
+  for (std::size_t b = 0; b < batch::blocks; b++) {
+    if (b + 1 == batch::blocks && _count % _lanes != 0) {
+      // Earlier operations may have left the padding singular.
+      auto last = _b.Block(b);
+      Impl::PadWithIdentity(last, _count % _lanes);
+      ret.Block(b) = Op::Alg::Inv(last);
+    } else {
+      ret.Block(b) = Op::Alg::Inv(_b.Block(b));
+    }
+  }
+  return ret;
+}
+
+}  // namespace Sglty::Types
+
+// Singularity/Types/Impl/Batch.tpp
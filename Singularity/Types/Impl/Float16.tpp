@@ -0,0 +1,193 @@
+#pragma once
+
+#include "../Float16.hpp"
+
+#include <cstdint>
+#include <cstring>
+
+#if defined(__cpp_lib_bit_cast)
+#include <bit>
+#endif
+
+#if SGLTY_HAS_X86_KERNELS && defined(__F16C__)
+#include <immintrin.h>
+#endif
+
+namespace Sglty::Types {
+
+namespace Impl {
+
+template <typename _to, typename _from>
+constexpr _to BitCast(const _from& _v) {
+#if defined(__cpp_lib_bit_cast)
+  return std::bit_cast<_to>(_v);
+#elif defined(__has_builtin)
+#if __has_builtin(__builtin_bit_cast)
+  return __builtin_bit_cast(_to, _v);
+#else
+  _to ret;
+  std::memcpy(&ret, &_v, sizeof(_to));
+  return ret;
+#endif
+#else
+  _to ret;
+  std::memcpy(&ret, &_v, sizeof(_to));
+  return ret;
+#endif
+}
+
+constexpr float HalfToFloat(std::uint16_t _h) {
+  const std::uint32_t sign = std::uint32_t(_h & 0x8000) << 16;
+  const std::uint32_t exp  = (_h >> 10) & 0x1F;
+  std::uint32_t man        = _h & 0x3FF;
+
+  std::uint32_t bits = 0;
+  if (exp == 0x1F) {
+    // Infinity, or a NaN quieted as `vcvtph2ps` does.
+    bits = sign | 0x7F800000 | ((man != 0 ? man | 0x200 : 0) << 13);
+  } else if (exp != 0) {
+    bits = sign | ((exp + 112) << 23) | (man << 13);
+  } else if (man == 0) {
+    bits = sign;
+  } else {
+    // Subnormal: shift the leading one into the implicit position.
+    std::uint32_t shift = 0;
+    while ((man & 0x400) == 0) {
+      man <<= 1;
+      shift++;
+    }
+    bits = sign | ((113 - shift) << 23) | ((man & 0x3FF) << 13);
+  }
+  return BitCast<float>(bits);
+}
+
+constexpr std::uint16_t FloatToHalf(float _v) {
+  std::uint32_t u          = BitCast<std::uint32_t>(_v);
+  const std::uint32_t sign = (u >> 16) & 0x8000;
+  u &= 0x7FFFFFFF;
+
+  if (u >= 0x7F800000) {
+    // Infinity, or a NaN kept quiet with its upper payload bits.
+    const std::uint32_t nan = u > 0x7F800000 ? 0x200 | ((u >> 13) & 0x3FF) : 0;
+    return std::uint16_t(sign | 0x7C00 | nan);
+  }
+  if (u >= 0x477FF000) {
+    // At least 65520, which rounds past the largest half (65504).
+    return std::uint16_t(sign | 0x7C00);
+  }
+  if (u < 0x38800000) {
+    // Below 2^-14: a subnormal half in units of 2^-24.
+    if (u < 0x33000000) {
+      return std::uint16_t(sign);
+    }
+    const std::uint32_t shift = 126 - (u >> 23);
+    const std::uint32_t man   = (u & 0x7FFFFF) | 0x800000;
+    std::uint32_t r           = man >> shift;
+    const std::uint32_t rem   = man & ((1u << shift) - 1);
+    const std::uint32_t half  = 1u << (shift - 1);
+    if (rem > half || (rem == half && (r & 1))) {
+      r++;
+    }
+    return std::uint16_t(sign | r);
+  }
+
+  // Rebias the exponent from 127 to 15 and round the dropped 13 bits to
+  // nearest even; a carry into the exponent is the correct result.
+  std::uint32_t r         = (u - 0x38000000) >> 13;
+  const std::uint32_t rem = u & 0x1FFF;
+  if (rem > 0x1000 || (rem == 0x1000 && (r & 1))) {
+    r++;
+  }
+  return std::uint16_t(sign | r);
+}
+
+constexpr float BFloat16ToFloat(std::uint16_t _b) {
+  return BitCast<float>(std::uint32_t(_b) << 16);
+}
+
+constexpr std::uint16_t FloatToBFloat16(float _v) {
+  const std::uint32_t u = BitCast<std::uint32_t>(_v);
+  if ((u & 0x7FFFFFFF) > 0x7F800000) {
+    return std::uint16_t((u >> 16) | 0x40);
+  }
+  return std::uint16_t((u + 0x7FFF + ((u >> 16) & 1)) >> 16);
+}
+
+}  // namespace Impl
+
+namespace Scalar {
+
+constexpr Half::Half(float _v) : bits() {
+#if SGLTY_HAS_X86_KERNELS && defined(__F16C__)
+  if (!SGLTY_IS_CONSTANT_EVALUATED()) {
+    bits = static_cast<std::uint16_t>(_cvtss_sh(_v, _MM_FROUND_TO_NEAREST_INT));
+    return;
+  }
+#endif
+  bits = Impl::FloatToHalf(_v);
+}
+
+constexpr Half::operator float() const {
+#if SGLTY_HAS_X86_KERNELS && defined(__F16C__)
+  if (!SGLTY_IS_CONSTANT_EVALUATED()) {
+    return _cvtsh_ss(bits);
+  }
+#endif
+  return Impl::HalfToFloat(bits);
+}
+
+constexpr Half Half::FromBits(std::uint16_t _bits) {
+  Half ret;
+  ret.bits = _bits;
+  return ret;
+}
+
+constexpr Half& Half::operator+=(float _o) {
+  return *this = Half(float(*this) + _o);
+}
+
+constexpr Half& Half::operator-=(float _o) {
+  return *this = Half(float(*this) - _o);
+}
+
+constexpr Half& Half::operator*=(float _o) {
+  return *this = Half(float(*this) * _o);
+}
+
+constexpr Half& Half::operator/=(float _o) {
+  return *this = Half(float(*this) / _o);
+}
+
+constexpr BFloat16::BFloat16(float _v) : bits(Impl::FloatToBFloat16(_v)) {}
+
+constexpr BFloat16::operator float() const {
+  return Impl::BFloat16ToFloat(bits);
+}
+
+constexpr BFloat16 BFloat16::FromBits(std::uint16_t _bits) {
+  BFloat16 ret;
+  ret.bits = _bits;
+  return ret;
+}
+
+constexpr BFloat16& BFloat16::operator+=(float _o) {
+  return *this = BFloat16(float(*this) + _o);
+}
+
+constexpr BFloat16& BFloat16::operator-=(float _o) {
+  return *this = BFloat16(float(*this) - _o);
+}
+
+constexpr BFloat16& BFloat16::operator*=(float _o) {
+  return *this = BFloat16(float(*this) * _o);
+}
+
+constexpr BFloat16& BFloat16::operator/=(float _o) {
+  return *this = BFloat16(float(*this) / _o);
+}
+
+}  // namespace Scalar
+
+}  // namespace Sglty::Types
+
+// Singularity/Types/Impl/Float16.tpp
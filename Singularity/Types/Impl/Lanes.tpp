@@ -0,0 +1,149 @@
+#pragma once
+
+#include "../Lanes.hpp"
+
+#include <cstddef>
+
+namespace Sglty::Types {
+
+template <typename _Tp, std::size_t _width>
+constexpr Lanes<_Tp, _width>::Lanes(_Tp _s) {
+#if SGLTY_HAS_VECTOR_EXTENSIONS
+  _v = _v + _s;
+#else
+  for (std::size_t k = 0; k < _width; k++) {
+    _v[k] = _s;
+  }
+#endif
+}
+
+template <typename _Tp, std::size_t _width>
+constexpr _Tp& Lanes<_Tp, _width>::operator[](std::size_t _lane) {
+  return _v[_lane];
+}
+
+template <typename _Tp, std::size_t _width>
+constexpr const _Tp& Lanes<_Tp, _width>::operator[](std::size_t _lane) const {
+  return _v[_lane];
+}
+
+template <typename _Tp, std::size_t _width>
+constexpr Lanes<_Tp, _width>& Lanes<_Tp, _width>::operator+=(const Lanes& _o) {
+#if SGLTY_HAS_VECTOR_EXTENSIONS
+  _v += _o._v;
+#else
+  for (std::size_t k = 0; k < _width; k++) {
+    _v[k] += _o._v[k];
+  }
+#endif
+  return *this;
+}
+
+template <typename _Tp, std::size_t _width>
+constexpr Lanes<_Tp, _width>& Lanes<_Tp, _width>::operator-=(const Lanes& _o) {
+#if SGLTY_HAS_VECTOR_EXTENSIONS
+  _v -= _o._v;
+#else
+  for (std::size_t k = 0; k < _width; k++) {
+    _v[k] -= _o._v[k];
+  }
+#endif
+  return *this;
+}
+
+template <typename _Tp, std::size_t _width>
+constexpr Lanes<_Tp, _width>& Lanes<_Tp, _width>::operator*=(const Lanes& _o) {
+#if SGLTY_HAS_VECTOR_EXTENSIONS
+  _v *= _o._v;
+#else
+  for (std::size_t k = 0; k < _width; k++) {
+    _v[k] *= _o._v[k];
+  }
+#endif
+  return *this;
+}
+
+template <typename _Tp, std::size_t _width>
+constexpr Lanes<_Tp, _width>& Lanes<_Tp, _width>::operator/=(const Lanes& _o) {
+#if SGLTY_HAS_VECTOR_EXTENSIONS
+  _v /= _o._v;
+#else
+  for (std::size_t k = 0; k < _width; k++) {
+    _v[k] /= _o._v[k];
+  }
+#endif
+  return *this;
+}
+
+template <typename _Tp, std::size_t _width>
+constexpr Lanes<_Tp, _width> operator+(const Lanes<_Tp, _width>& _l,
+                                       const Lanes<_Tp, _width>& _r) {
+  Lanes<_Tp, _width> ret = _l;
+  return ret += _r;
+}
+
+template <typename _Tp, std::size_t _width>
+constexpr Lanes<_Tp, _width> operator-(const Lanes<_Tp, _width>& _l,
+                                       const Lanes<_Tp, _width>& _r) {
+  Lanes<_Tp, _width> ret = _l;
+  return ret -= _r;
+}
+
+template <typename _Tp, std::size_t _width>
+constexpr Lanes<_Tp, _width> operator*(const Lanes<_Tp, _width>& _l,
+                                       const Lanes<_Tp, _width>& _r) {
+  Lanes<_Tp, _width> ret = _l;
+  return ret *= _r;
+}
+
+template <typename _Tp, std::size_t _width>
+constexpr Lanes<_Tp, _width> operator/(const Lanes<_Tp, _width>& _l,
+                                       const Lanes<_Tp, _width>& _r) {
+  Lanes<_Tp, _width> ret = _l;
+  return ret /= _r;
+}
+
+template <typename _Tp, std::size_t _width>
+constexpr Lanes<_Tp, _width> operator-(const Lanes<_Tp, _width>& _o) {
+  Lanes<_Tp, _width> ret;
+#if SGLTY_HAS_VECTOR_EXTENSIONS
+  ret._v = -_o._v;
+#else
+  for (std::size_t k = 0; k < _width; k++) {
+    ret._v[k] = -_o._v[k];
+  }
+#endif
+  return ret;
+}
+
+template <typename _Tp, std::size_t _width, typename _scalar, typename>
+constexpr Lanes<_Tp, _width> operator*(const Lanes<_Tp, _width>& _l,
+                                       _scalar _s) {
+  return _l * Lanes<_Tp, _width>(static_cast<_Tp>(_s));
+}
+
+template <typename _Tp, std::size_t _width, typename _scalar, typename>
+constexpr Lanes<_Tp, _width> operator*(_scalar _s,
+                                       const Lanes<_Tp, _width>& _r) {
+  return Lanes<_Tp, _width>(static_cast<_Tp>(_s)) * _r;
+}
+
+template <typename _Tp, std::size_t _width>
+constexpr bool operator==(const Lanes<_Tp, _width>& _l,
+                          const Lanes<_Tp, _width>& _r) {
+  bool ret = true;
+  for (std::size_t k = 0; k < _width; k++) {
+    ret &= _l._v[k] == _r._v[k];
+  }
+  return ret;
+}
+
+template <typename _Tp, std::size_t _width>
+constexpr bool operator!=(const Lanes<_Tp, _width>& _l,
+                          const Lanes<_Tp, _width>& _r) {
+  return !(_l == _r);
+}
+
+}  // namespace Sglty::Types
+
+// Singularity/Types/Impl/Lanes.tpp
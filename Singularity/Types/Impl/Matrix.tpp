@@ -2,12 +2,25 @@
 
 #include "../Matrix.hpp"
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
 #include <type_traits>
 #include <utility>
 
+#include "../../Config.hpp"
+#include "../../Expr/Assign.hpp"
+#include "../../IO/TextWriter.hpp"
+#include "../../Kernel/Transpose.hpp"
 #include "../../Traits/Expr.hpp"
 #include "../../Op/Arthm/Neg.hpp"
+#include "../../Op/Cnv/Cast.hpp"
+#include "../../Op/Cnv/Reorder.hpp"
+#include "../../Op/Gen/Constant.hpp"
+#include "../../Op/Gen/Identity.hpp"
+#include "../../Op/Gen/Iota.hpp"
+#include "../../Op/Gen/Random.hpp"
 
 namespace Sglty::Types {
 
@@ -23,8 +36,7 @@ constexpr Matrix<_core_impl>::Matrix(const Matrix<_core_other>& _other) {
           Matrix<core_impl>::cols == Matrix<_core_other>::cols,
       "Error: dimension mismatch between `core_impl` and `_core_other`.");
 
-  Traverse(*this,
-           [&](std::size_t i, std::size_t j) { (*this)(i, j) = _other(i, j); });
+  Expr::Assign(*this, _other);
 }
 
 template <typename _core_impl>
@@ -34,8 +46,7 @@ constexpr Matrix<_core_impl>::Matrix(const _expr& _e) {
       std::is_same_v<typename Matrix::core_impl, typename _expr::core_impl>,
       "Error: `core_impl` mismatch.");
 
-  Traverse(*this,
-           [&](std::size_t i, std::size_t j) { (*this)(i, j) = _e(i, j); });
+  Expr::Assign(*this, _e);
 }
 
 template <typename _core_impl>
@@ -46,10 +57,12 @@ constexpr Matrix<_core_impl>& Matrix<_core_impl>::operator=(
                     Matrix<core_impl>::cols == Matrix<_core_other>::cols,
                 "Error: dimension mismatch.");
 
-  Matrix<_core_other> temp(_other);
-
-  Traverse(*this,
-           [&](std::size_t i, std::size_t j) { (*this)(i, j) = temp(i, j); });
+  if constexpr (Traits::Core::is_copy_on_write_v<core_impl>) {
+    if (!Expr::Impl::Overlaps(*this, _other)) {
+      _m_data.Discard();
+    }
+  }
+  Expr::Assign(*this, _other);
 
   return *this;
 }
@@ -60,8 +73,14 @@ constexpr Matrix<_core_impl>& Matrix<_core_impl>::operator=(const _expr& _e) {
   static_assert(rows == _expr::rows && cols == _expr::cols,
                 "Error: dimension mismatch.");
 
-  Traverse(*this,
-           [&](std::size_t i, std::size_t j) { (*this)(i, j) = _e(i, j); });
+  // Every element is overwritten, so shared storage need not be copied
+  // first unless the expression reads it.
+  if constexpr (Traits::Core::is_copy_on_write_v<core_impl>) {
+    if (!Expr::Impl::Overlaps(*this, _e)) {
+      _m_data.Discard();
+    }
+  }
+  Expr::Assign(*this, _e);
 
   return *this;
 }
@@ -75,6 +94,15 @@ constexpr Matrix<_core_impl>::Matrix(Args&&... args)
       "Error: `core_impl` is not constructible with the passed arguments.");
 }
 
+template <typename _core_impl>
+constexpr Expr::Cost Matrix<_core_impl>::cost() {
+  Expr::Cost ret;
+  ret.bytes_read    = rows * cols * sizeof(value_type);
+  ret.bytes_written = rows * cols * sizeof(value_type);
+  ret.expr_size     = sizeof(Matrix);
+  return ret;
+}
+
 template <typename _core_impl>
 constexpr typename Matrix<_core_impl>::size_type Matrix<_core_impl>::Rows()
     const {
@@ -98,61 +126,58 @@ constexpr Sglty::Core::Major Matrix<_core_impl>::Major() const {
 }
 
 template <typename _core_impl>
-template <typename _Up>
-constexpr Matrix<typename _core_impl::core_rebind_value<_Up>>
-Matrix<_core_impl>::Cast() const {
-  static_assert(std::is_arithmetic_v<_Up>,
-                "Error: cannot cast to a non-arithmetic type.");
-
-  using result_core = typename core_impl::core_rebind_value<_Up>;
+constexpr typename Matrix<_core_impl>::size_type
+Matrix<_core_impl>::OuterStride() {
+  return Traits::Core::outer_stride_v<_core_impl>;
+}
 
-  Matrix<result_core> result;
-  Traverse(result, [&](std::size_t i, std::size_t j) {
-    result(i, j) = static_cast<_Up>((*this)(i, j));
-  });
-  return result;
+template <typename _core_impl>
+template <typename _Up>
+constexpr auto Matrix<_core_impl>::Cast() const {
+  return Op::Cnv::Cast<_Up>(*this);
 }
 
 template <typename _core_impl>
 template <Core::Major _major>
-constexpr Matrix<typename _core_impl::core_rebind_major<_major>>
-Matrix<_core_impl>::Reorder() const {
-  {
-    Traits::Core::Get<core_type,
-                      _major>
-        _;  // to assert correctness of new major
-  }
-
-  using result_core = typename core_impl::core_rebind_major<_major>;
-
-  Matrix<result_core> result;
-  Traverse(result,
-           [&](std::size_t i, std::size_t j) { result(i, j) = (*this)(i, j); });
-  return result;
+constexpr auto Matrix<_core_impl>::Reorder() const {
+  return Op::Cnv::Reorder<_major>(*this);
 }
 
 template <typename _core_impl>
-constexpr Matrix<_core_impl> Matrix<_core_impl>::Zero() {
-  Matrix<_core_impl> result;
-  Traverse(result, [&](std::size_t i, std::size_t j) { result(i, j) = 0; });
-  return result;
+constexpr auto Matrix<_core_impl>::Zero() {
+  return Op::Gen::Constant<Matrix>(value_type(0));
 }
 
 template <typename _core_impl>
-constexpr Matrix<_core_impl> Matrix<_core_impl>::Identity() {
+constexpr auto Matrix<_core_impl>::Identity() {
   static_assert(Matrix<core_impl>::rows == Matrix<core_impl>::cols,
                 "Error: an Identity matrix must be a square matrix.");
-  Matrix<core_impl> result;
-  for (size_type i = 0; i < Matrix<core_impl>::rows; i++) {
-    result(i, i) = Matrix<core_impl>::value_type(1);
-  }
-  return result;
+  return Op::Gen::Identity<Matrix>();
+}
+
+template <typename _core_impl>
+constexpr auto Matrix<_core_impl>::Constant(const value_type& _v) {
+  return Op::Gen::Constant<Matrix>(_v);
+}
+
+template <typename _core_impl>
+constexpr auto Matrix<_core_impl>::Iota(const value_type& _start,
+                                        const value_type& _row_step,
+                                        const value_type& _col_step) {
+  return Op::Gen::Iota<Matrix>(_start, _row_step, _col_step);
+}
+
+template <typename _core_impl>
+constexpr auto Matrix<_core_impl>::Random(std::uint64_t _seed,
+                                          const value_type& _lo,
+                                          const value_type& _hi) {
+  return Op::Gen::Random<Matrix>(_seed, _lo, _hi);
 }
 
 template <typename _core_impl>
 constexpr typename Matrix<_core_impl>::reference Matrix<_core_impl>::operator()(
     const size_type _row, const size_type _col) {
-  return const_cast<reference>(std::as_const(*this).operator()(_row, _col));
+  return _m_data.At(_row, _col);
 }
 
 template <typename _core_impl>
@@ -162,6 +187,61 @@ Matrix<_core_impl>::operator()(const size_type _row,
   return _m_data.At(_row, _col);
 }
 
+template <typename _core_impl>
+constexpr typename Matrix<_core_impl>::pointer Matrix<_core_impl>::Data() {
+  return _m_data.Data();
+}
+
+template <typename _core_impl>
+constexpr typename Matrix<_core_impl>::const_pointer Matrix<_core_impl>::Data()
+    const {
+  return _m_data.Data();
+}
+
+template <typename _core_impl>
+constexpr bool Matrix<_core_impl>::Unique() const {
+  if constexpr (Traits::Core::is_copy_on_write_v<core_impl>) {
+    return _m_data.Unique();
+  } else {
+    return true;
+  }
+}
+
+#if SGLTY_HAS_MDSPAN
+namespace Impl {
+
+template <typename _core_impl, typename _pointer>
+auto AsMdspan(_pointer _data) {
+  static_assert(_core_impl::core_traits::core_type == Core::Type::Dense,
+                "Error: only dense cores can be viewed as an `mdspan`.");
+
+  using extents_type = std::extents<std::size_t,
+                                    _core_impl::size_traits::rows,
+                                    _core_impl::size_traits::cols>;
+  using mapping_type = std::layout_stride::mapping<extents_type>;
+
+  const std::array<std::size_t, 2> strides{
+      Traits::Core::row_stride_v<_core_impl>,
+      Traits::Core::col_stride_v<_core_impl>};
+  return std::mdspan<std::remove_pointer_t<_pointer>,
+                     extents_type,
+                     std::layout_stride>(_data,
+                                         mapping_type(extents_type{}, strides));
+}
+
+}  // namespace Impl
+
+template <typename _core_impl>
+auto Matrix<_core_impl>::AsMdspan() {
+  return Impl::AsMdspan<core_impl>(Data());
+}
+
+template <typename _core_impl>
+auto Matrix<_core_impl>::AsMdspan() const {
+  return Impl::AsMdspan<core_impl>(Data());
+}
+#endif
+
 template <typename _core_impl>
 template <typename _expr>
 constexpr Matrix<_core_impl>& Matrix<_core_impl>::operator+=(const _expr& _e) {
@@ -170,8 +250,7 @@ constexpr Matrix<_core_impl>& Matrix<_core_impl>::operator+=(const _expr& _e) {
   static_assert(Matrix::rows == _expr::rows && Matrix::cols == _expr::cols,
                 "Error: dimension mismatch.");
 
-  TraverseIndices(
-      [&](std::size_t i, std::size_t j) { (*this)(i, j) += _e(i, j); });
+  Expr::AddAssign(*this, _e);
   return (*this);
 }
 
@@ -182,8 +261,8 @@ constexpr Matrix<_core_impl>& Matrix<_core_impl>::operator*=(
   static_assert(std::is_arithmetic_v<_scalar>,
                 "Error: non-integral value passed.");
 
-  TraverseIndices(
-      [&](std::size_t i, std::size_t j) { (*this)(i, j) *= _other; });
+  Traverse(*this,
+           [&](std::size_t i, std::size_t j) { (*this)(i, j) *= _other; });
   return (*this);
 }
 
@@ -198,14 +277,38 @@ constexpr Matrix<_core_impl>& Matrix<_core_impl>::operator-=(const _expr& _e) {
   return (*this) += -_e;
 }
 
+template <typename _core_impl>
+constexpr Matrix<_core_impl>& Matrix<_core_impl>::TransposeInPlace() {
+  static_assert(rows == cols,
+                "Error: `TransposeInPlace()` needs a square matrix.");
+
+  if constexpr (Traits::Core::is_inner_contiguous_v<core_impl>) {
+    if (!SGLTY_IS_CONSTANT_EVALUATED()) {
+      Kernel::TransposeInPlace(Data(), rows, OuterStride());
+      return (*this);
+    }
+  }
+  for (size_type i = 0; i < rows; i++) {
+    for (size_type j = i + 1; j < cols; j++) {
+      value_type t  = (*this)(i, j);
+      (*this)(i, j) = (*this)(j, i);
+      (*this)(j, i) = t;
+    }
+  }
+  return (*this);
+}
+
 template <typename _core_impl>
 void Matrix<_core_impl>::Print() const {
+  IO::TextWriter out(std::cout);
   for (size_type i = 0; i < Rows(); i++) {
     for (size_type j = 0; j < Cols(); j++) {
-      std::cout << (*this)(i, j) << ' ';
+      out.Write((*this)(i, j));
+      out.Write(' ');
     }
-    std::cout << '\n';
+    out.Write('\n');
   }
+  out.Flush();
 }
 
 namespace Impl {
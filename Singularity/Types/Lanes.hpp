@@ -0,0 +1,145 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+#include "../Config.hpp"
+
+namespace Sglty::Types {
+
+/**
+ * @brief Default number of lanes for `_Tp`: as many as fill 64 bytes.
+ *
+ * That is one cache line and one AVX-512 register (16 `float`s or 8
+ * `double`s).
+ */
+template <typename _Tp>
+constexpr inline std::size_t default_lanes_v = 64 / sizeof(_Tp);
+
+/**
+ * @brief A fixed-width pack of values operated on lane by lane.
+ *
+ * `Lanes` behaves like an arithmetic scalar whose operators apply to each of
+ * its `_width` values independently, in fixed-length loops the compiler turns
+ * into SIMD instructions. Used as the `value_type` of a matrix, element
+ * (i, j) holds the (i, j) elements of `_width` independent matrices side by
+ * side, so the existing operations (`Expr::Add`, `Expr::MulMatrix`,
+ * `Expr::Trp`, ...) evaluate all of them at once. This is the storage of
+ * `Types::Batch`.
+ *
+ * With `SGLTY_HAS_VECTOR_EXTENSIONS` the lanes are a native compiler vector,
+ * so every operation is a single SIMD expression regardless of optimization
+ * level; otherwise they are an array processed by fixed-length loops.
+ *
+ * Comparisons are true only if they hold in every lane.
+ *
+ * @tparam _Tp    The arithmetic type of each lane (not `bool`).
+ * @tparam _width The number of lanes (a power of two).
+ */
+template <typename _Tp, std::size_t _width>
+struct alignas(sizeof(_Tp) * _width) Lanes {
+  static_assert(std::is_arithmetic_v<_Tp> && !std::is_same_v<_Tp, bool>,
+                "Error: `_Tp` must be a non-bool arithmetic type.");
+
+  static_assert(_width != 0 && (_width & (_width - 1)) == 0,
+                "Error: `_width` must be a power of two.");
+
+  /// The type of each lane.
+  using value_type = _Tp;
+
+  /// Number of lanes.
+  constexpr static std::size_t width = _width;
+
+  /**
+   * @brief Constructs a pack with every lane zero.
+   */
+  constexpr Lanes() = default;
+
+  /**
+   * @brief Constructs a pack with every lane equal to `_s`.
+   *
+   * @param _s The value to broadcast.
+   */
+  constexpr explicit Lanes(_Tp _s);
+
+  /**
+   * @brief Accesses lane `_lane`.
+   */
+  constexpr _Tp& operator[](std::size_t _lane);
+
+  /**
+   * @brief Accesses lane `_lane` (const version).
+   */
+  constexpr const _Tp& operator[](std::size_t _lane) const;
+
+  /// Lane-wise compound arithmetic.
+  constexpr Lanes& operator+=(const Lanes& _o);
+  constexpr Lanes& operator-=(const Lanes& _o);
+  constexpr Lanes& operator*=(const Lanes& _o);
+  constexpr Lanes& operator/=(const Lanes& _o);
+
+#if SGLTY_HAS_VECTOR_EXTENSIONS
+  /// Native vector type holding the lanes.
+  typedef _Tp vector_type __attribute__((vector_size(sizeof(_Tp) * _width)));
+
+  /// The lanes.
+  vector_type _v{};
+#else
+  /// The lanes.
+  _Tp _v[_width]{};
+#endif
+};
+
+/// Lane-wise arithmetic between packs.
+template <typename _Tp, std::size_t _width>
+constexpr Lanes<_Tp, _width> operator+(const Lanes<_Tp, _width>& _l,
+                                       const Lanes<_Tp, _width>& _r);
+
+template <typename _Tp, std::size_t _width>
+constexpr Lanes<_Tp, _width> operator-(const Lanes<_Tp, _width>& _l,
+                                       const Lanes<_Tp, _width>& _r);
+
+template <typename _Tp, std::size_t _width>
+constexpr Lanes<_Tp, _width> operator*(const Lanes<_Tp, _width>& _l,
+                                       const Lanes<_Tp, _width>& _r);
+
+template <typename _Tp, std::size_t _width>
+constexpr Lanes<_Tp, _width> operator/(const Lanes<_Tp, _width>& _l,
+                                       const Lanes<_Tp, _width>& _r);
+
+/// Lane-wise negation.
+template <typename _Tp, std::size_t _width>
+constexpr Lanes<_Tp, _width> operator-(const Lanes<_Tp, _width>& _o);
+
+/**
+ * @brief Scales every lane by an arithmetic scalar (e.g. for `MulScalar`).
+ */
+template <typename _Tp,
+          std::size_t _width,
+          typename _scalar,
+          typename = std::enable_if_t<std::is_arithmetic_v<_scalar>>>
+constexpr Lanes<_Tp, _width> operator*(const Lanes<_Tp, _width>& _l,
+                                       _scalar _s);
+
+template <typename _Tp,
+          std::size_t _width,
+          typename _scalar,
+          typename = std::enable_if_t<std::is_arithmetic_v<_scalar>>>
+constexpr Lanes<_Tp, _width> operator*(_scalar _s,
+                                       const Lanes<_Tp, _width>& _r);
+
+/// True if every lane compares equal.
+template <typename _Tp, std::size_t _width>
+constexpr bool operator==(const Lanes<_Tp, _width>& _l,
+                          const Lanes<_Tp, _width>& _r);
+
+/// True if any lane differs.
+template <typename _Tp, std::size_t _width>
+constexpr bool operator!=(const Lanes<_Tp, _width>& _l,
+                          const Lanes<_Tp, _width>& _r);
+
+}  // namespace Sglty::Types
+
+#include "Impl/Lanes.tpp"
+
+// Singularity/Types/Lanes.hpp
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <cstdint>
 #include <type_traits>
 
+#include "../Expr/Cost.hpp"
 #include "../Expr/Tag.hpp"
 #include "../Traits/Core.hpp"
 #include "../Traits/Expr.hpp"
@@ -131,6 +133,16 @@ class Matrix : public Expr::Tag {
   /// The memory layout of the matrix (e.g., row-major or column-major).
   constexpr static auto core_major = core_traits::core_major;
 
+  /**
+   * @brief Estimates the cost of evaluating this matrix as an expression.
+   *
+   * A matrix used as an expression is a plain copy: every element is read
+   * once and written once, with no arithmetic.
+   *
+   * @return The compile-time cost descriptor.
+   */
+  constexpr static Expr::Cost cost();
+
   /**
    * @brief Default-constructs a Matrix.
    *
@@ -142,7 +154,9 @@ class Matrix : public Expr::Tag {
   /**
    * @brief Copy-constructs a Matrix from another instance.
    *
-   * Performs a shallow copy of the underlying core.
+   * Copies the underlying core: the elements for owning cores such as
+   * `Core::Dense` and `Core::Heap`, a reference to the same storage for
+   * `Core::Shared` (copy-on-write) and `Core::Map`.
    */
   constexpr Matrix(const Matrix& _other) = default;
 
@@ -157,7 +171,7 @@ class Matrix : public Expr::Tag {
   /**
    * @brief Copy-assigns from another Matrix.
    *
-   * Performs a shallow copy of the underlying core.
+   * Copies the underlying core, as the copy constructor does.
    *
    * @return Reference to the current Matrix.
    */
@@ -199,7 +213,8 @@ class Matrix : public Expr::Tag {
    * type that satisfies `Sglty::Traits::Expr::is_valid_v<T>`.
    *
    * Useful for creating a concrete matrix from compile-time expression trees,
-   * such as the result of arithmetic operations between matrices.
+   * such as the result of arithmetic operations between matrices. The tree
+   * is rewritten by `Expr::Simplify()` before it is evaluated.
    *
    * Enabled only if `_expr` is a valid expression.
    *
@@ -309,59 +324,119 @@ class Matrix : public Expr::Tag {
    */
   constexpr Sglty::Core::Major Major() const;
 
+  /**
+   * @brief Returns the leading dimension: the number of elements between the
+   * starts of consecutive rows (row-major) or columns (column-major) in
+   * `Data()`.
+   *
+   * `Cols()` or `Rows()` for packed cores, more for padded ones such as
+   * `Core::Padded` or a `Core::Map` with an outer stride. Kernels walking
+   * `Data()` line by line step by it.
+   *
+   * @return `Traits::Core::outer_stride_v<core_impl>`.
+   */
+  constexpr static size_type OuterStride();
+
   /**
    * @brief Casts the matrix to a different value type.
    *
-   * Rebinds the underlying core implementation to use the new value type `_Up`,
-   * preserving all other core traits like size and layout.
+   * Returns a lazy `Unary<Matrix, Expr::Cast<_Up>>` expression that converts
+   * each element on access, so the conversion is fused into whatever consumes
+   * it. Its `core_impl` is the core rebound to `_Up`, preserving size and
+   * layout; use `Evaluate(m.Cast<_Up>())` for a converted copy.
    *
    * @tparam _Up The new value type.
-   * @return A new Matrix with the same shape and layout, but different value
-   * type.
+   * @return A conversion expression with the same shape and layout.
    */
   template <typename _Up>
-  constexpr Matrix<typename core_impl::core_rebind_value<_Up>> Cast() const;
+  constexpr auto Cast() const;
 
   /**
    * @brief Reorders the matrix to a different memory layout (row-major or
    * column-major).
    *
-   * Rebinds the core implementation to use the new memory layout specified
-   * by `_major`. Actual layout handling is delegated to the core
-   * implementation.
+   * Returns a lazy `Unary<Matrix, Expr::Reorder<_major>>` expression whose
+   * `core_impl` is the core rebound to `_major`. Nothing is copied until it is
+   * evaluated; use `Evaluate(m.Reorder<_major>())` for a reordered copy.
    *
    * @tparam _major The new layout order (row-major or column-major).
-   * @return A new Matrix with the reordered layout.
+   * @return A reorder expression with the same shape and values.
    */
   template <Core::Major _major>
-  constexpr Matrix<typename core_impl::core_rebind_major<_major>> Reorder()
-      const;
+  constexpr auto Reorder() const;
 
   /**
-   * @brief Returns a zero-initialized matrix.
+   * @brief Returns a lazy zero matrix.
    *
-   * Constructs a matrix of the same type and size with all elements set to
-   * zero. The implementation is handled manually by the `Matrix` class.
+   * A `Nullary<Matrix, Expr::Constant<value_type>>` expression filled
+   * with zero; elements are generated where the expression is consumed.
+   * Converts implicitly to a `Matrix`.
    *
-   * @return A zero matrix.
+   * @return A zero matrix expression.
    */
-  constexpr static Matrix Zero();
+  constexpr static auto Zero();
 
   /**
-   * @brief Returns the identity matrix.
+   * @brief Returns a lazy identity matrix.
    *
-   * Constructs an identity matrix of the same shape, where diagonal elements
-   * are one and all others are zero. The implementation is handled manually.
+   * A `Nullary<Matrix, Expr::Identity<value_type>>` expression where
+   * diagonal elements are one and all others are zero. Adding it in place
+   * (`m += s * Matrix::Identity()`) only touches the diagonal.
    *
    * Only meaningful for square matrices — compiler error otherwise.
    *
-   * @return An identity matrix.
+   * @return An identity matrix expression.
+   */
+  constexpr static auto Identity();
+
+  /**
+   * @brief Returns a lazy matrix with every element equal to `_v`.
+   *
+   * @param _v The fill value.
+   * @return A constant matrix expression.
    */
-  constexpr static Matrix Identity();
+  constexpr static auto Constant(const value_type& _v);
+
+  /**
+   * @brief Returns a lazy linear ramp.
+   *
+   * The element at (i, j) is `_start + i * _row_step + j * _col_step`; the
+   * defaults number the elements 0, 1, 2, ... in row-major order.
+   *
+   * @param _start    Value at (0, 0).
+   * @param _row_step Increment per row.
+   * @param _col_step Increment per column.
+   * @return A ramp matrix expression.
+   */
+  constexpr static auto Iota(const value_type& _start    = value_type(0),
+                             const value_type& _row_step = value_type(cols),
+                             const value_type& _col_step = value_type(1));
+
+  /**
+   * @brief Returns a lazy uniform random matrix.
+   *
+   * Values come from a counter-based generator (`Kernel::Philox4x32()`)
+   * keyed by `_seed`, so a seed always produces the same matrix regardless of
+   * evaluation order or thread count. Use `Evaluate(..., Exec::Par{})` for
+   * large initializations.
+   *
+   * @param _seed Key of the generator.
+   * @param _lo   Lower bound (inclusive).
+   * @param _hi   Upper bound (exclusive for floating-point types, inclusive
+   * for integral types).
+   * @return A random matrix expression.
+   */
+  constexpr static auto Random(std::uint64_t _seed,
+                               const value_type& _lo = value_type(0),
+                               const value_type& _hi = value_type(1));
 
   /**
    * @brief Accesses a mutable element at the specified position.
    *
+   * Goes through the core's mutable `At()`, so it detaches a copy-on-write
+   * core even when the element is only read; read through a `const` matrix
+   * to avoid that.
+   *
    * @param _row The row index (zero-based).
    * @param _col The column index (zero-based).
    * @return Reference to the element at (_row, _col).
@@ -378,11 +453,58 @@ class Matrix : public Expr::Tag {
   constexpr const_reference operator()(const size_type _row,
                                        const size_type _col) const;
 
+  /**
+   * @brief Returns a pointer to the underlying element storage.
+   *
+   * Elements are stored as laid out by the core: densely packed in `Major()`
+   * order when `Traits::Core::is_contiguous_v<core_impl>` holds, otherwise at
+   * `Traits::Core::row_stride_v` / `col_stride_v` (e.g. a padded `Core::Map`).
+   *
+   * @return Pointer to the first element.
+   */
+  constexpr pointer Data();
+
+  /**
+   * @brief Returns a read-only pointer to the underlying element storage.
+   *
+   * @return Const pointer to the first element.
+   */
+  constexpr const_pointer Data() const;
+
+  /**
+   * @brief Returns whether no other matrix shares this matrix's storage.
+   *
+   * Only copy-on-write cores (`Traits::Core::is_copy_on_write_v`, e.g.
+   * `Core::Shared`) share storage between copies; for every other core this
+   * is `true`. A kernel may write a unique matrix through `Data()` in place;
+   * otherwise `Data()` copies the storage first.
+   */
+  constexpr bool Unique() const;
+
+#if SGLTY_HAS_MDSPAN
+  /**
+   * @brief Views the elements as a rank-2 `std::mdspan`.
+   *
+   * The mapping is a `std::layout_stride` built from the core's strides, so
+   * padded and strided cores are described exactly. Dense cores only.
+   *
+   * @return A span over `Data()` with static extents `rows` x `cols`.
+   */
+  auto AsMdspan();
+
+  /**
+   * @brief Views the elements as a read-only rank-2 `std::mdspan`.
+   *
+   * @return A span over `Data()` with static extents `rows` x `cols`.
+   */
+  auto AsMdspan() const;
+#endif
+
   /**
    * @brief Adds a valid expression to the matrix.
    *
    * Performs element-wise addition with another matrix or expression
-   * satisfying `Sglty::Traits::Expr::is_valid_v`.
+   * satisfying `Sglty::Traits::Expr::is_valid_v`, via `Expr::AddAssign()`.
    *
    * @tparam _expr The expression type.
    * @param _e The expression to add.
@@ -417,7 +539,27 @@ class Matrix : public Expr::Tag {
   template <typename _expr>
   constexpr Matrix& operator-=(const _expr& _e);
 
-  // temporary for tests
+  /**
+   * @brief Transposes a square matrix in place.
+   *
+   * Matrices whose rows (or columns) are contiguous, padded or not, are
+   * transposed by `Kernel::TransposeInPlace()`, which swaps mirrored blocks
+   * through a small stack buffer; other cores (and constant evaluation) swap
+   * mirrored elements one by one. To transpose into another matrix, assign
+   * `Op::Alg::Trp(m)` instead.
+   *
+   * Only meaningful for square matrices — compiler error otherwise.
+   *
+   * @return Reference to the current matrix after transposition.
+   */
+  constexpr Matrix& TransposeInPlace();
+
+  /**
+   * @brief Writes the matrix to `std::cout`, one row per line.
+   *
+   * Elements are space separated and formatted with `IO::TextWriter`. Use
+   * `Sglty::IO::WriteCsv()` for other streams, delimiters or files.
+   */
   void Print() const;
 
  private:
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+
+namespace Sglty::Test {
+
+/// Number of failed checks so far.
+inline int& Failures() {
+  static int failures = 0;
+  return failures;
+}
+
+/// Records a failed check with its location; used through `SGLTY_CHECK`.
+inline void Check(bool _ok, const char* _what, const char* _file, int _line) {
+  if (!_ok) {
+    Failures()++;
+    std::cerr << _file << ':' << _line << ": check failed: " << _what << '\n';
+  }
+}
+
+/// Returns whether every element of two matrices of one shape is equal.
+template <typename _lhs, typename _rhs>
+bool Equal(const _lhs& _l, const _rhs& _r) {
+  for (std::size_t i = 0; i < _lhs::rows; i++) {
+    for (std::size_t j = 0; j < _lhs::cols; j++) {
+      if (!(_l(i, j) == _r(i, j))) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+/// Returns whether every element differs by at most `_tol` (relative to 1).
+template <typename _lhs, typename _rhs>
+bool Near(const _lhs& _l, const _rhs& _r, double _tol) {
+  for (std::size_t i = 0; i < _lhs::rows; i++) {
+    for (std::size_t j = 0; j < _lhs::cols; j++) {
+      const double l = double(_l(i, j));
+      const double r = double(_r(i, j));
+      if (!(std::abs(l - r) <= _tol * std::max(1.0, std::abs(r)))) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+/// Prints a summary and returns the process exit code.
+inline int Report() {
+  if (Failures() != 0) {
+    std::cerr << Failures() << " check(s) failed\n";
+    return 1;
+  }
+  return 0;
+}
+
+}  // namespace Sglty::Test
+
+#define SGLTY_CHECK(_cond) \
+  ::Sglty::Test::Check(static_cast<bool>(_cond), #_cond, __FILE__, __LINE__)
+
+// Tests/Check.hpp
@@ -0,0 +1,154 @@
+// Matrix comparisons: exact equality, tolerances at their boundaries, NaN,
+// and operands of different majors, on the flat and element-wise paths.
+
+#include <cstddef>
+#include <limits>
+
+#include "Singularity/Lib.hpp"
+#include "Singularity/Convenience.hpp"
+#include "Singularity/Core/Heap.hpp"
+#include "Check.hpp"
+
+namespace {
+
+using namespace Sglty;
+using Core::Major;
+using Op::Cmp::IsApprox;
+using Op::Cmp::IsEqual;
+using Op::Cmp::IsNotEqual;
+
+template <typename _matrix>
+_matrix Ramp() {
+  _matrix m;
+  for (std::size_t i = 0; i < _matrix::rows; i++) {
+    for (std::size_t j = 0; j < _matrix::cols; j++) {
+      m(i, j) = typename _matrix::value_type(int(i * 7 + j * 3) % 11);
+    }
+  }
+  return m;
+}
+
+constexpr bool Constant() {
+  constexpr DenseMat<int, 2, 2> a(3);
+  constexpr DenseMat<int, 2, 2, Major::Col> b(3);
+  constexpr DenseMat<int, 2, 2> c(4);
+  return IsEqual(a, b) && a == b && a != c && IsApprox(a, c, 0.25) &&
+         !IsApprox(a, c, 0.2);
+}
+static_assert(Constant());
+
+// Equal matrices compare equal; a single different element anywhere, the
+// last one included, makes them unequal.
+template <typename _matrix>
+void CheckEqual() {
+  const auto a = Ramp<_matrix>();
+  _matrix    b = a;
+  SGLTY_CHECK(IsEqual(a, b) && a == b && !IsNotEqual(a, b));
+  SGLTY_CHECK(IsEqual(a + b, b + a));
+
+  for (std::size_t k : {std::size_t(0), _matrix::rows * _matrix::cols / 2,
+                        _matrix::rows * _matrix::cols - 1}) {
+    b = a;
+    b(k / _matrix::cols, k % _matrix::cols) += 1;
+    SGLTY_CHECK(!IsEqual(a, b) && a != b && IsNotEqual(a, b));
+  }
+}
+
+// `|l - r| <= max(abs, rel * max(|l|, |r|))`, checked exactly at the bound
+// with values whose differences and products are exact.
+template <typename _matrix>
+void CheckTolerance() {
+  using value_type = typename _matrix::value_type;
+
+  const auto a = Ramp<_matrix>();
+  _matrix    b = a;
+  b(1, 2)      = value_type(3);
+  b(0, 0)      = value_type(0);
+  _matrix c    = b;
+  c(1, 2)      = value_type(4);
+
+  // Relative: 3 against 4 differ by exactly 0.25 * 4.
+  SGLTY_CHECK(IsApprox(b, c, 0.25));
+  SGLTY_CHECK(IsApprox(c, b, 0.25));
+  SGLTY_CHECK(!IsApprox(b, c, 0.2499));
+  SGLTY_CHECK(IsApprox(b, c, 0.2499, 1.0));
+  SGLTY_CHECK(!IsApprox(b, c, 0.0, 0.999));
+
+  // Absolute: near zero a relative tolerance alone never passes.
+  if constexpr (!std::is_integral_v<value_type>) {
+    c       = b;
+    c(0, 0) = value_type(0.5);
+    SGLTY_CHECK(!IsApprox(b, c, 0.5));
+    SGLTY_CHECK(IsApprox(b, c, 0.0, 0.5));
+    SGLTY_CHECK(!IsApprox(b, c, 0.0, 0.4999));
+  }
+}
+
+template <typename _matrix>
+void CheckNaN() {
+  using value_type = typename _matrix::value_type;
+  constexpr value_type nan = std::numeric_limits<value_type>::quiet_NaN();
+  constexpr value_type inf = std::numeric_limits<value_type>::infinity();
+
+  _matrix a = Ramp<_matrix>();
+  a(2, 1)   = nan;
+  const _matrix b = a;
+
+  // NaN equals nothing, itself included, at any tolerance.
+  SGLTY_CHECK(!IsEqual(a, b) && a != b);
+  SGLTY_CHECK(!IsApprox(a, b, 1.0, 1e30));
+  SGLTY_CHECK(!IsApprox(a, a));
+
+  // Signed zeros are equal, and infinities close only to themselves at any
+  // tolerance.
+  _matrix z = Ramp<_matrix>();
+  _matrix w = z;
+  z(0, 0)   = value_type(0.0);
+  w(0, 0)   = value_type(-0.0);
+  SGLTY_CHECK(IsEqual(z, w));
+  z(1, 1) = inf;
+  w(1, 1) = inf;
+  SGLTY_CHECK(IsEqual(z, w) && IsApprox(z, w));
+  w(1, 1) = -inf;
+  SGLTY_CHECK(!IsEqual(z, w) && !IsApprox(z, w, 1.0, 1e30));
+}
+
+// Operands of different majors, or expressions, are compared element by
+// element in the left operand's order.
+void CheckMixedMajors() {
+  using Row = HeapMat<double, 40, 33>;
+  using Col = HeapMat<double, 40, 33, Major::Col>;
+
+  const Row a = Ramp<Row>();
+  Col       b;
+  Expr::Assign(b, a);
+  SGLTY_CHECK(IsEqual(a, b) && IsEqual(b, a) && a == b);
+  SGLTY_CHECK(IsApprox(a, b, 0.0));
+  SGLTY_CHECK(IsEqual(a * 2.0, b.Reorder<Major::Row>() + a));
+
+  b(39, 32) += 1e-9;
+  SGLTY_CHECK(!IsEqual(a, b) && !IsEqual(b, a) && a != b);
+  SGLTY_CHECK(IsApprox(a, b, 1e-9) && IsApprox(b, a, 1e-9));
+  SGLTY_CHECK(!IsApprox(a, b, 1e-12));
+
+  b(0, 0) = std::numeric_limits<double>::quiet_NaN();
+  SGLTY_CHECK(!IsApprox(a, b, 1.0, 1.0) && !IsApprox(b, a, 1.0, 1.0));
+}
+
+}  // namespace
+
+int main() {
+  CheckEqual<DenseMat<int, 5, 7>>();
+  CheckEqual<HeapMat<float, 33, 17, Major::Col>>();
+  CheckEqual<HeapMat<double, 64, 48>>();
+  CheckTolerance<DenseMat<int, 4, 4>>();
+  CheckTolerance<DenseMat<float, 4, 4, Major::Col>>();
+  CheckTolerance<HeapMat<double, 24, 40>>();
+  CheckNaN<DenseMat<float, 4, 3>>();
+  CheckNaN<HeapMat<double, 40, 24>>();
+  CheckMixedMajors();
+
+  return Test::Report();
+}
+
+// Tests/Compare.cpp
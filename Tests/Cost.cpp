@@ -0,0 +1,78 @@
+// The cost model of expression nodes and of `Expr::Assign()`.
+
+#include "Singularity/Lib.hpp"
+#include "Singularity/Convenience.hpp"
+#include "Singularity/Core/Heap.hpp"
+#include "Check.hpp"
+
+namespace {
+
+using namespace Sglty;
+
+using A = DenseMat<float, 4, 3>;
+using B = DenseMat<float, 3, 5>;
+
+constexpr Expr::Cost matrix = A::cost();
+static_assert(matrix.flops == 0);
+static_assert(matrix.bytes_read == 4 * 3 * sizeof(float));
+static_assert(matrix.bytes_written == 4 * 3 * sizeof(float));
+
+// One addition per element, both operands read once.
+constexpr Expr::Cost sum = decltype(A() + A())::cost();
+static_assert(sum.flops == 4 * 3);
+static_assert(sum.bytes_read == 2 * 4 * 3 * sizeof(float));
+static_assert(sum.bytes_written == 4 * 3 * sizeof(float));
+
+// 4x5 dot products of length 3; lhs re-read per column, rhs per row.
+constexpr Expr::Cost product = decltype(A() * B())::cost();
+static_assert(product.flops == 4 * 5 * (2 * 3 - 1));
+static_assert(product.bytes_read ==
+              (4 * 3 * 5 + 3 * 5 * 4) * sizeof(float));
+static_assert(product.bytes_written == 4 * 5 * sizeof(float));
+
+// Nested nodes add their operands' work but write only the result.
+constexpr Expr::Cost nested = decltype(A() * B() + A() * B())::cost();
+static_assert(nested.flops == 2 * product.flops + 4 * 5);
+static_assert(nested.bytes_read == 2 * product.bytes_read);
+static_assert(nested.expr_size == sizeof(decltype(A() * B() + A() * B())));
+
+// A product occurring twice is evaluated once into a temporary and read
+// back twice.
+constexpr Expr::Cost shared = Expr::AssignCost<decltype(A() * B() +
+                                                        A() * B())>();
+static_assert(nested.temporaries == 0);
+static_assert(shared.temporaries == 1);
+static_assert(shared.flops == product.flops + 4 * 5);
+static_assert(shared.bytes_read ==
+              product.bytes_read + 2 * 4 * 5 * sizeof(float));
+static_assert(shared.bytes_written == 2 * 4 * 5 * sizeof(float));
+static_assert(Expr::AssignCost<decltype(A() + A())>().temporaries == 0);
+
+// An aliased destination adds the temporary and the copy out of it. Heap
+// leaves are held by reference, so they can alias.
+void CheckAliased() {
+  using S = HeapMat<float, 3, 3>;
+  S m;
+  S n;
+  constexpr Expr::Cost square = decltype(m * m)::cost();
+
+  const Expr::Cost aliased = Expr::AssignCost(m, m * m);
+  SGLTY_CHECK(aliased.temporaries == 1);
+  SGLTY_CHECK(aliased.flops == square.flops);
+  SGLTY_CHECK(aliased.bytes_read == square.bytes_read + S::cost().bytes_read);
+  SGLTY_CHECK(aliased.bytes_written ==
+              square.bytes_written + S::cost().bytes_written);
+
+  SGLTY_CHECK(Expr::AssignCost(n, m * m).temporaries == 0);
+  SGLTY_CHECK(Expr::AssignCost(m, m * 2.0f + m).temporaries == 0);
+  SGLTY_CHECK(Expr::AssignCost(m, Op::Alg::Trp(m)).temporaries == 1);
+}
+
+}  // namespace
+
+int main() {
+  CheckAliased();
+  return Test::Report();
+}
+
+// Tests/Cost.cpp
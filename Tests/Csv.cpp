@@ -0,0 +1,152 @@
+// Delimited text: round trips, delimiters, quoted values and blank lines,
+// and the errors malformed input raises.
+
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include "Singularity/Lib.hpp"
+#include "Singularity/Convenience.hpp"
+#include "Singularity/IO/Csv.hpp"
+#include "Check.hpp"
+
+namespace {
+
+using namespace Sglty;
+using Core::Major;
+
+// The message of the error `ReadCsv()` throws, or empty.
+template <typename _matrix>
+std::string ReadError(const std::string& _text,
+                      _matrix& _m,
+                      const IO::CsvOptions& _opt = {}) {
+  std::istringstream in(_text);
+  try {
+    IO::ReadCsv(in, _m, _opt);
+    return "";
+  } catch (const std::runtime_error& e) {
+    return e.what();
+  }
+}
+
+bool Mentions(const std::string& _what, const char* _part) {
+  return _what.find(_part) != std::string::npos;
+}
+
+template <typename _matrix>
+std::string Write(const _matrix& _m, const IO::CsvOptions& _opt = {}) {
+  std::ostringstream out;
+  IO::WriteCsv(out, _m, _opt);
+  return out.str();
+}
+
+// Values written are read back exactly, into either major and in parallel.
+template <typename _Tp>
+void CheckRoundTrip() {
+  using Row = DenseMat<_Tp, 7, 5>;
+  using Col = DenseMat<_Tp, 7, 5, Major::Col>;
+
+  Row src;
+  for (std::size_t i = 0; i < 7; i++) {
+    for (std::size_t j = 0; j < 5; j++) {
+      src(i, j) = _Tp(i * 5 + j) / _Tp(3) - _Tp(6);
+    }
+  }
+
+  const std::string text = Write(src);
+  Row back;
+  SGLTY_CHECK(ReadError(text, back).empty());
+  SGLTY_CHECK(Test::Equal(back, src));
+
+  IO::CsvOptions parallel;
+  parallel.chunk_size = 16;
+  parallel.threads    = 3;
+  Col reordered;
+  SGLTY_CHECK(ReadError(text, reordered, parallel).empty());
+  SGLTY_CHECK(Test::Equal(reordered, src));
+}
+
+void CheckDelimiters() {
+  const DenseMat<int, 3, 4> src = DenseMat<int, 3, 4>::Iota(-5);
+
+  IO::CsvOptions tab;
+  tab.delimiter = '\t';
+  const std::string text = Write(src, tab);
+  SGLTY_CHECK(text.find('\t') != std::string::npos);
+  SGLTY_CHECK(text.find(',') == std::string::npos);
+
+  DenseMat<int, 3, 4> back;
+  SGLTY_CHECK(ReadError(text, back, tab).empty());
+  SGLTY_CHECK(Test::Equal(back, src));
+  SGLTY_CHECK(!ReadError(text, back).empty());
+
+  IO::CsvOptions semicolon;
+  semicolon.delimiter = ';';
+  SGLTY_CHECK(ReadError("1; 2 ;3;4\n5;6;7;8\n9;10;11;12\n", back, semicolon)
+                  .empty());
+  SGLTY_CHECK(back(0, 1) == 2 && back(2, 3) == 12);
+
+  // A space separates on any run of blanks.
+  IO::CsvOptions space;
+  space.delimiter = ' ';
+  SGLTY_CHECK(ReadError("  1 2\t 3    4\n5 6 7 8\n9\t10 11 12  \n", back,
+                        space)
+                  .empty());
+  SGLTY_CHECK(back(0, 2) == 3 && back(2, 1) == 10);
+}
+
+// Quoted values, blank lines, a header and Windows line endings.
+void CheckLayout() {
+  DenseMat<double, 2, 3> m;
+  SGLTY_CHECK(ReadError("\"1.5\",\"-2\", \" 3e2 \"\n"
+                        "\n"
+                        "  \t\r\n"
+                        "4,\"5\",6\r\n"
+                        "\n",
+                        m)
+                  .empty());
+  SGLTY_CHECK(m(0, 0) == 1.5 && m(0, 1) == -2 && m(0, 2) == 300);
+  SGLTY_CHECK(m(1, 0) == 4 && m(1, 1) == 5 && m(1, 2) == 6);
+
+  IO::CsvOptions header;
+  header.header = true;
+  SGLTY_CHECK(ReadError("\"a\",\"b\",\"c\"\n7,8,9\n+1,2,3\n", m, header)
+                  .empty());
+  SGLTY_CHECK(m(0, 0) == 7 && m(1, 0) == 1);
+
+  SGLTY_CHECK(Mentions(ReadError("\"1.5,2,3\n4,5,6\n", m), "unterminated"));
+  SGLTY_CHECK(Mentions(ReadError("\"\",2,3\n4,5,6\n", m), "invalid value"));
+}
+
+void CheckErrors() {
+  DenseMat<float, 2, 2> m;
+  SGLTY_CHECK(Mentions(ReadError("1,x\n3,4\n", m), "invalid value: `x`"));
+  SGLTY_CHECK(Mentions(ReadError("1,2\n3,4.5.6\n", m), "trailing"));
+  SGLTY_CHECK(Mentions(ReadError("1,2\n3,4,\n", m), "trailing"));
+  SGLTY_CHECK(Mentions(ReadError("1,2\n3,,4\n", m), "invalid value"));
+  SGLTY_CHECK(Mentions(ReadError("1,2\n3\n", m), "fewer than 2 columns"));
+  SGLTY_CHECK(Mentions(ReadError("1,2\n", m), "input has 1 rows"));
+  SGLTY_CHECK(Mentions(ReadError("1,2\n3,4\n5,6\n", m), "more than 2 rows"));
+  SGLTY_CHECK(Mentions(ReadError("1,2\n3,1e99\n", m), "out of range"));
+
+  DenseMat<std::uint8_t, 1, 2> u;
+  SGLTY_CHECK(Mentions(ReadError("255,256\n", u), "out of range"));
+  SGLTY_CHECK(Mentions(ReadError("1,-1\n", u), "invalid value"));
+  SGLTY_CHECK(Mentions(ReadError("1,2.5\n", u), "trailing"));
+}
+
+}  // namespace
+
+int main() {
+  CheckRoundTrip<float>();
+  CheckRoundTrip<double>();
+  CheckRoundTrip<std::int64_t>();
+  CheckDelimiters();
+  CheckLayout();
+  CheckErrors();
+
+  return Test::Report();
+}
+
+// Tests/Csv.cpp
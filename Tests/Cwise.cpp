@@ -0,0 +1,171 @@
+// Coefficient-wise operations and broadcasting: element values, every
+// broadcast shape, and mixed-major operands through the bulk assignment.
+
+#include <cmath>
+
+#include "Singularity/Lib.hpp"
+#include "Singularity/Convenience.hpp"
+#include "Singularity/Core/Heap.hpp"
+#include "Singularity/Op/Arthm/Cwise.hpp"
+#include "Singularity/Op/Cnv/Broadcast.hpp"
+#include "Singularity/Op/Math/Func.hpp"
+#include "Check.hpp"
+
+namespace {
+
+using namespace Sglty;
+using namespace Sglty::Op::Arthm;
+using Core::Major;
+using Op::Cnv::Broadcast;
+
+// Nonzero values of both signs, so quotients and minima are meaningful.
+template <typename _matrix>
+_matrix Ramp(int _scale) {
+  _matrix m;
+  for (std::size_t i = 0; i < _matrix::rows; i++) {
+    for (std::size_t j = 0; j < _matrix::cols; j++) {
+      const int v = int(i * 7 + j * 3) % 11 - 5;
+      m(i, j) = typename _matrix::value_type((v == 0 ? 6 : v) * _scale);
+    }
+  }
+  return m;
+}
+
+// Whether `_out(i, j) == _f(_l(i', j'), _r(i'', j''))` everywhere, with an
+// operand of one row or column read at row or column 0.
+template <typename _out, typename _lhs, typename _rhs, typename _fn>
+bool Matches(const _out& _o, const _lhs& _l, const _rhs& _r, _fn _f) {
+  for (std::size_t i = 0; i < _out::rows; i++) {
+    for (std::size_t j = 0; j < _out::cols; j++) {
+      const auto l = _l(_lhs::rows == 1 ? 0 : i, _lhs::cols == 1 ? 0 : j);
+      const auto r = _r(_rhs::rows == 1 ? 0 : i, _rhs::cols == 1 ? 0 : j);
+      if (!(_o(i, j) == _f(l, r))) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+constexpr bool Constant() {
+  constexpr DenseMat<int, 2, 2> a(6);
+  constexpr DenseMat<int, 2, 2> b(4);
+
+  constexpr DenseMat<int, 2, 2> p = CwiseProduct(a, b);
+  constexpr DenseMat<int, 2, 2> q = CwiseQuotient(a, b);
+  constexpr DenseMat<int, 2, 2> lo = CwiseMin(a, b);
+  constexpr DenseMat<int, 2, 2> hi = CwiseMax(a, b);
+  return p(1, 0) == 24 && q(0, 1) == 1 && lo(1, 1) == 4 && hi(0, 0) == 6;
+}
+static_assert(Constant());
+
+template <typename _matrix>
+void CheckValues() {
+  using value_type = typename _matrix::value_type;
+
+  const auto a = Ramp<_matrix>(1);
+  const auto b = Ramp<_matrix>(-2);
+
+  SGLTY_CHECK(Matches(_matrix(CwiseProduct(a, b)), a, b,
+                      [](value_type l, value_type r) { return l * r; }));
+  SGLTY_CHECK(Matches(_matrix(CwiseQuotient(a, b)), a, b,
+                      [](value_type l, value_type r) { return l / r; }));
+  SGLTY_CHECK(Matches(_matrix(CwiseMin(a, b)), a, b,
+                      [](value_type l, value_type r) {
+                        return r < l ? r : l;
+                      }));
+  SGLTY_CHECK(Matches(_matrix(CwiseMax(a, b)), a, b,
+                      [](value_type l, value_type r) {
+                        return l < r ? r : l;
+                      }));
+}
+
+void CheckBroadcast() {
+  using M = DenseMat<float, 5, 4>;
+  const auto m    = Ramp<M>(1);
+  const auto row  = Ramp<DenseMat<float, 1, 4>>(2);
+  const auto col  = Ramp<DenseMat<float, 5, 1>>(3);
+  const auto one  = Ramp<DenseMat<float, 1, 1>>(4);
+  const auto mul  = [](float l, float r) { return l * r; };
+  const auto div  = [](float l, float r) { return l / r; };
+  const auto less = [](float l, float r) { return r < l ? r : l; };
+
+  // Either side may broadcast, in either dimension or both.
+  SGLTY_CHECK(Matches(M(CwiseProduct(m, row)), m, row, mul));
+  SGLTY_CHECK(Matches(M(CwiseProduct(col, m)), col, m, mul));
+  SGLTY_CHECK(Matches(M(CwiseQuotient(m, one)), m, one, div));
+  SGLTY_CHECK(Matches(M(CwiseMin(one, m)), one, m, less));
+  SGLTY_CHECK(Matches(M(CwiseProduct(row, col)), row, col, mul));
+
+  // An explicit broadcast combines with the ordinary operators.
+  const M shifted = m - Broadcast<5, 4>(row);
+  SGLTY_CHECK(
+      Matches(shifted, m, row, [](float l, float r) { return l - r; }));
+  const M scaled = m + Broadcast<5, 4>(col) + Broadcast<5, 4>(one);
+  bool ok = true;
+  for (std::size_t i = 0; i < 5; i++) {
+    for (std::size_t j = 0; j < 4; j++) {
+      ok = ok && scaled(i, j) == m(i, j) + col(i, 0) + one(0, 0);
+    }
+  }
+  SGLTY_CHECK(ok);
+
+  static_assert(decltype(CwiseProduct(row, col))::rows == 5);
+  static_assert(decltype(CwiseProduct(row, col))::cols == 4);
+  static_assert(decltype(Broadcast<5, 4>(one))::rows == 5);
+}
+
+// Operands of the other major are reordered first. Assigned to a matrix of
+// the other major the elements are written in tiles; a function of the
+// result takes the bulk `Op::Math` path.
+void CheckMixedMajors() {
+  using Row = HeapMat<float, 96, 80>;
+  using Col = HeapMat<float, 96, 80, Major::Col>;
+
+  const auto a   = Ramp<Row>(1);
+  const auto b   = Ramp<Col>(2);
+  const auto mul = [](float l, float r) { return l * r; };
+
+  Col prod;
+  Expr::Assign(prod, CwiseProduct(a, b.Reorder<Major::Row>()));
+  SGLTY_CHECK(Matches(prod, a, b, mul));
+
+  const Row quot = CwiseQuotient(b.Reorder<Major::Row>(), a);
+  SGLTY_CHECK(Matches(quot, b, a, [](float l, float r) { return l / r; }));
+
+  HeapMat<float, 1, 1> floor;
+  floor(0, 0) = -3;
+  Col bounded;
+  Expr::Assign(bounded,
+               CwiseMax(CwiseMin(a, b.Reorder<Major::Row>()),
+                        Broadcast<96, 80>(floor)));
+  SGLTY_CHECK(Matches(bounded, a, b, [](float l, float r) {
+    const float lo = r < l ? r : l;
+    return lo < -3 ? -3.0f : lo;
+  }));
+
+  const Row scaled = Op::Math::Exp(CwiseProduct(a, b.Reorder<Major::Row>()) *
+                                   0.01f);
+  bool near = true;
+  for (std::size_t i = 0; i < 96; i++) {
+    for (std::size_t j = 0; j < 80; j++) {
+      const double ref = std::exp(double(a(i, j) * b(i, j) * 0.01f));
+      near = near && std::abs(scaled(i, j) - ref) <= 1e-6 * ref;
+    }
+  }
+  SGLTY_CHECK(near);
+}
+
+}  // namespace
+
+int main() {
+  CheckValues<DenseMat<int, 3, 4>>();
+  CheckValues<DenseMat<float, 6, 5, Major::Col>>();
+  CheckValues<HeapMat<double, 33, 17>>();
+  CheckBroadcast();
+  CheckMixedMajors();
+
+  return Test::Report();
+}
+
+// Tests/Cwise.cpp
@@ -0,0 +1,116 @@
+// The product kernels in every `SGLTY_ISA` variant: `Kernel::Gemm()` rounds
+// exactly like the element-wise product (`Expr::MulMatrix`) and
+// `Kernel::QGemm()` matches it. Products routed to a `Kernel::Backend` match
+// them too.
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "Singularity/Lib.hpp"
+#include "Singularity/Convenience.hpp"
+#include "Singularity/Core/Heap.hpp"
+#include "Singularity/Core/Padded.hpp"
+#include "Singularity/Kernel/Backend.hpp"
+#include "Singularity/Kernel/Gemm.hpp"
+#include "Singularity/Kernel/QGemm.hpp"
+#include "Singularity/Op/Cnv/Cast.hpp"
+#include "Check.hpp"
+
+namespace {
+
+using namespace Sglty;
+
+// Values whose products and sums all round.
+template <typename _matrix>
+_matrix Fractions(int _seed) {
+  using value_type = typename _matrix::value_type;
+
+  _matrix m;
+  for (std::size_t i = 0; i < _matrix::rows; i++) {
+    for (std::size_t j = 0; j < _matrix::cols; j++) {
+      const int d = int(i * 7 + j * 13 + _seed) % 97 + 3;
+      m(i, j)     = value_type(1) / value_type(d);
+    }
+  }
+  return m;
+}
+
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _inner,
+          std::size_t _cols>
+void CheckExact() {
+  const auto a = Fractions<HeapMat<_Tp, _rows, _inner>>(1);
+  const auto b = Fractions<HeapMat<_Tp, _inner, _cols>>(2);
+
+  const HeapMat<_Tp, _rows, _cols> prod = a * b;
+  SGLTY_CHECK(Test::Equal(prod, a * b));
+}
+
+// 8-bit operands go through `Kernel::QGemm()`, whose int32 sums are exact.
+// Casting the product keeps them from wrapping to the 8-bit element type.
+template <typename _Tp,
+          std::size_t _rows,
+          std::size_t _inner,
+          std::size_t _cols>
+void CheckQuantized() {
+  constexpr int lowest = std::is_signed_v<_Tp> ? -128 : 0;
+
+  HeapMat<_Tp, _rows, _inner> a;
+  HeapMat<_Tp, _inner, _cols> b;
+  for (std::size_t i = 0; i < _rows; i++) {
+    for (std::size_t k = 0; k < _inner; k++) {
+      a(i, k) = _Tp(int(i * 31 + k * 17) % 256 + lowest);
+    }
+  }
+  for (std::size_t k = 0; k < _inner; k++) {
+    for (std::size_t j = 0; j < _cols; j++) {
+      b(k, j) = _Tp(int(k * 13 + j * 29) % 256 + lowest);
+    }
+  }
+
+  const auto exact = Op::Cnv::Cast<std::int32_t>(a * b);
+  const auto prod  = Expr::Evaluate(exact);
+  SGLTY_CHECK(Test::Equal(prod, exact));
+}
+
+// Padded operands reach a backend with their leading dimensions, including
+// the symmetric `x * Trp(x)` case.
+template <typename _matrix>
+void CheckBackendStride() {
+  using Op::Alg::Trp;
+
+  static_assert(_matrix::OuterStride() > _matrix::rows);
+
+  const auto a = Fractions<_matrix>(1);
+  const auto b = Fractions<_matrix>(2);
+
+  _matrix expected_ab, expected_aat;
+  {
+    Kernel::BackendScope scope(nullptr);
+    expected_ab  = a * b;
+    expected_aat = a * Trp(a);
+  }
+
+  Kernel::BackendScope scope(&Kernel::ReferenceBackend());
+  const _matrix ab  = a * b;
+  const _matrix aat = a * Trp(a);
+  SGLTY_CHECK(Test::Near(ab, expected_ab, 1e-5));
+  SGLTY_CHECK(Test::Near(aat, expected_aat, 1e-5));
+}
+
+}  // namespace
+
+int main() {
+  CheckExact<float, 37, 53, 71>();
+  CheckExact<double, 64, 64, 64>();
+  CheckQuantized<std::int8_t, 33, 70, 19>();
+  CheckQuantized<std::uint8_t, 64, 129, 48>();
+  CheckBackendStride<PaddedMat<float, 50, 50>>();
+  CheckBackendStride<PaddedMat<double, 36, 36, Core::Major::Col>>();
+
+  return Test::Report();
+}
+
+// Tests/Gemm.cpp
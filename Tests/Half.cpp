@@ -0,0 +1,65 @@
+// Conversions of the 16-bit floating-point types: the software conversion
+// and every `SGLTY_ISA` variant of `Kernel::Convert()` agree bit for bit.
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "Singularity/Lib.hpp"
+#include "Singularity/Kernel/Convert.hpp"
+#include "Singularity/Types/Float16.hpp"
+#include "Check.hpp"
+
+namespace {
+
+using namespace Sglty;
+
+std::uint32_t Bits(float _v) {
+  std::uint32_t ret;
+  std::memcpy(&ret, &_v, sizeof(ret));
+  return ret;
+}
+
+// Signaling NaNs come out quiet with their payload, as `vcvtph2ps` does.
+static_assert(Types::Impl::BitCast<std::uint32_t>(
+                  Types::Impl::HalfToFloat(0x7C01)) == 0x7FC02000);
+
+void CheckNaNs() {
+  bool ok = true;
+  for (std::uint32_t man = 1; man < 0x400; man++) {
+    for (std::uint32_t sign : {0u, 0x8000u}) {
+      const std::uint16_t h = std::uint16_t(sign | 0x7C00 | man);
+      const float         f = Types::Impl::HalfToFloat(h);
+      ok = ok && Bits(f) == ((sign << 16) | 0x7FC00000 | (man << 13));
+    }
+  }
+  SGLTY_CHECK(ok);
+}
+
+void CheckConvert() {
+  std::vector<Types::Half> src(0x10000);
+  for (std::uint32_t h = 0; h < 0x10000; h++) {
+    src[h] = Types::Half::FromBits(std::uint16_t(h));
+  }
+
+  std::vector<float> dst(src.size());
+  Kernel::Convert(src.data(), dst.data(), src.size());
+
+  bool ok = true;
+  for (std::uint32_t h = 0; h < 0x10000; h++) {
+    const float f = Types::Impl::HalfToFloat(std::uint16_t(h));
+    ok            = ok && Bits(dst[h]) == Bits(f);
+  }
+  SGLTY_CHECK(ok);
+}
+
+}  // namespace
+
+int main() {
+  CheckNaNs();
+  CheckConvert();
+
+  return Test::Report();
+}
+
+// Tests/Half.cpp
@@ -0,0 +1,80 @@
+// File-backed cores: read-only and copy-on-write mappings of raw files.
+
+#include <cstdio>
+#include <string>
+#include <type_traits>
+
+#include <unistd.h>
+
+#include "Singularity/Lib.hpp"
+#include "Singularity/Convenience.hpp"
+#include "Singularity/Core/Mapped.hpp"
+#include "Singularity/IO/Raw.hpp"
+#include "Check.hpp"
+
+namespace {
+
+using namespace Sglty;
+using Core::Major;
+using Core::MapMode;
+
+using Ro  = MappedMat<float, 16, 8>;
+using Cow = MappedMat<float, 16, 8, Major::Row, MapMode::CopyOnWrite>;
+
+// Read-only maps hand out const references, like `Map<const T>`.
+static_assert(std::is_same_v<decltype(std::declval<Ro&>()(0, 0)),
+                             const float&>);
+static_assert(std::is_same_v<decltype(std::declval<Ro&>().Data()),
+                             const float*>);
+static_assert(std::is_same_v<decltype(std::declval<Cow&>()(0, 0)), float&>);
+
+}  // namespace
+
+int main() {
+  const std::string path =
+      "sglty_mapped_test_" + std::to_string(::getpid()) + ".bin";
+
+  DenseMat<float, 16, 8> src;
+  for (std::size_t i = 0; i < 16; i++) {
+    for (std::size_t j = 0; j < 8; j++) {
+      src(i, j) = float(i * 8 + j);
+    }
+  }
+  IO::WriteRaw(path, src);
+
+  {
+    Ro ro(path);
+    SGLTY_CHECK(Test::Equal(ro, src));
+    const DenseMat<float, 16, 8> twice = ro + ro;
+    SGLTY_CHECK(twice(3, 5) == 2 * src(3, 5));
+  }
+
+  {
+    Cow m(path);
+    Cow n = m;
+    SGLTY_CHECK(!m.Unique() && !n.Unique());
+
+    // Writing one copy detaches it; the other keeps the file's elements.
+    n(0, 0) = 42.0f;
+    SGLTY_CHECK(n(0, 0) == 42.0f);
+    SGLTY_CHECK(std::as_const(m)(0, 0) == 0.0f);
+    SGLTY_CHECK(m.Unique() && n.Unique());
+
+    // Private writes are kept by later copies and never reach the file.
+    m(1, 1) = -1.0f;
+    Cow o = m;
+    o = o * 2.0f;
+    SGLTY_CHECK(std::as_const(o)(1, 1) == -2.0f);
+    SGLTY_CHECK(std::as_const(m)(1, 1) == -1.0f);
+    SGLTY_CHECK(std::as_const(o)(2, 3) == 2 * src(2, 3));
+    SGLTY_CHECK(std::as_const(m)(2, 3) == src(2, 3));
+
+    Ro file(path);
+    SGLTY_CHECK(Test::Equal(file, src));
+  }
+
+  std::remove(path.c_str());
+  return Test::Report();
+}
+
+// Tests/Mapped.cpp
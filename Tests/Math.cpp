@@ -0,0 +1,240 @@
+// Element-wise math kernels: the accuracy table of `Kernel/Math.hpp` holds
+// for `operator()` and for `Apply()` under every `SGLTY_ISA` variant, and
+// the special cases of `Pow` follow `std::pow`.
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include "Singularity/Lib.hpp"
+#include "Singularity/Kernel/Math.hpp"
+#include "Check.hpp"
+
+namespace {
+
+using namespace Sglty;
+
+// Exact cases need no rounding, so they also hold in constant evaluation.
+static_assert(Kernel::Pow{}(-2.0, 3.0) == -8.0);
+static_assert(Kernel::Pow{}(2.0f, -2.0f) == 0.25f);
+
+// A fixed linear congruential sequence, for sweeps that repeat exactly.
+struct Sequence {
+  std::uint64_t state = 0x9E3779B97F4A7C15ull;
+
+  double Next(double _lo, double _hi) {
+    state = state * 6364136223846793005ull + 1442695040888963407ull;
+    return _lo + (_hi - _lo) * double(state >> 11) * 0x1p-53;
+  }
+};
+
+// Distance from `_got` to `_ref` in ulp of `_Tp` at `_ref`; infinite when
+// only one of them is NaN or infinite.
+template <typename _Tp>
+double Ulps(_Tp _got, long double _ref) {
+  constexpr double inf = std::numeric_limits<double>::infinity();
+  if (std::isnan(_ref) || std::isnan(_got)) {
+    return std::isnan(_ref) && std::isnan(_got) ? 0 : inf;
+  }
+  if (std::isinf(_ref) || std::isinf(_got)) {
+    return _got == _ref ? 0 : inf;
+  }
+  const int e = std::max(std::ilogb(_Tp(_ref)),
+                         std::numeric_limits<_Tp>::min_exponent - 1);
+  const long double ulp =
+      std::ldexp(1.0L, e - (std::numeric_limits<_Tp>::digits - 1));
+  return double(std::fabs((long double)_got - _ref) / ulp);
+}
+
+// Whether two values are the same, counting every NaN as equal.
+template <typename _Tp>
+bool Same(_Tp _l, _Tp _r) {
+  if (std::isnan(_l) || std::isnan(_r)) {
+    return std::isnan(_l) && std::isnan(_r);
+  }
+  return _l == _r && std::signbit(_l) == std::signbit(_r);
+}
+
+// Largest error of `operator()` and `Apply()` of `_func` over `_xs`.
+template <typename _func, typename _Tp, typename _ref>
+double MaxUlps(const std::vector<_Tp>& _xs, _ref _reference) {
+  std::vector<_Tp> bulk(_xs.size());
+  _func::Apply(_xs.data(), bulk.data(), _xs.size());
+
+  double ret = 0;
+  for (std::size_t i = 0; i < _xs.size(); i++) {
+    const long double ref = _reference((long double)_xs[i]);
+    ret = std::max(ret, Ulps<_Tp>(_func{}(_xs[i]), ref));
+    ret = std::max(ret, Ulps<_Tp>(bulk[i], ref));
+  }
+  return ret;
+}
+
+template <typename _Tp>
+std::vector<_Tp> Uniform(double _lo, double _hi, std::size_t _n) {
+  Sequence seq;
+  std::vector<_Tp> ret(_n);
+  for (_Tp& v : ret) {
+    v = _Tp(seq.Next(_lo, _hi));
+  }
+  return ret;
+}
+
+// Positive values spread evenly over the exponents, subnormals included.
+template <typename _Tp>
+std::vector<_Tp> Positive(std::size_t _n) {
+  const double lo = std::numeric_limits<_Tp>::min_exponent -
+                    std::numeric_limits<_Tp>::digits;
+  const double hi = std::numeric_limits<_Tp>::max_exponent;
+  std::vector<_Tp> ret = Uniform<_Tp>(lo, hi, _n);
+  for (_Tp& v : ret) {
+    v = std::exp2(v);
+  }
+  return ret;
+}
+
+template <typename _Tp>
+void CheckAccuracy() {
+  constexpr std::size_t n = 20000;
+  const bool is_float     = sizeof(_Tp) == 4;
+  const double exp_lo     = is_float ? -103 : -744;
+  const double exp_hi     = is_float ? 88 : 709;
+
+  SGLTY_CHECK((MaxUlps<Kernel::Exp>(Uniform<_Tp>(exp_lo, exp_hi, n),
+                                    [](long double _x) {
+                                      return std::exp(_x);
+                                    }) <= 1.5));
+  SGLTY_CHECK((MaxUlps<Kernel::Exp>(Uniform<_Tp>(-1, 1, n),
+                                    [](long double _x) {
+                                      return std::exp(_x);
+                                    }) <= 1.5));
+  SGLTY_CHECK((MaxUlps<Kernel::Log>(Positive<_Tp>(n),
+                                    [](long double _x) {
+                                      return std::log(_x);
+                                    }) <= 1.5));
+  SGLTY_CHECK((MaxUlps<Kernel::Log>(Uniform<_Tp>(0.5, 2, n),
+                                    [](long double _x) {
+                                      return std::log(_x);
+                                    }) <= 1.5));
+  SGLTY_CHECK((MaxUlps<Kernel::Tanh>(Uniform<_Tp>(-20, 20, n),
+                                     [](long double _x) {
+                                       return std::tanh(_x);
+                                     }) <= 3));
+  SGLTY_CHECK((MaxUlps<Kernel::Tanh>(Uniform<_Tp>(-0.01, 0.01, n),
+                                     [](long double _x) {
+                                       return std::tanh(_x);
+                                     }) <= 3));
+  SGLTY_CHECK((MaxUlps<Kernel::Sqrt>(Positive<_Tp>(n),
+                                     [](long double _x) {
+                                       return std::sqrt(_x);
+                                     }) <= 0.5));
+  SGLTY_CHECK((MaxUlps<Kernel::Abs>(Uniform<_Tp>(-1e30, 1e30, n),
+                                    [](long double _x) {
+                                      return std::fabs(_x);
+                                    }) == 0));
+}
+
+// Largest error of `Pow` over `_xs` for one exponent.
+template <typename _Tp>
+double PowUlps(const std::vector<_Tp>& _xs, _Tp _y) {
+  std::vector<_Tp> bulk(_xs.size());
+  Kernel::Pow::Apply(_xs.data(), bulk.data(), _xs.size(), _y);
+
+  double ret = 0;
+  for (std::size_t i = 0; i < _xs.size(); i++) {
+    const long double ref = std::pow((long double)_xs[i], (long double)_y);
+    ret = std::max(ret, Ulps<_Tp>(Kernel::Pow{}(_xs[i], _y), ref));
+    ret = std::max(ret, Ulps<_Tp>(bulk[i], ref));
+  }
+  return ret;
+}
+
+template <typename _Tp>
+void CheckPowAccuracy() {
+  constexpr std::size_t n = 4000;
+  const double bound      = sizeof(_Tp) == 4 ? 0.5 + 1e-6 : 1.5;
+
+  // Bases from 2^-20 to 2^20 and exponents that keep the result in range;
+  // the integers up to 16 take the exact path, the rest exp(y log x).
+  std::vector<_Tp> xs = Uniform<_Tp>(-20, 20, n);
+  for (_Tp& x : xs) {
+    x = std::exp2(x);
+  }
+  for (double y : {-40.5, -17.0, -7.5, -3.0, -2.5, -1.0, -0.5, 0.5, 1.0,
+                   1.5, 2.0, 3.0, 7.0, 13.25, 16.0, 17.0, 40.5}) {
+    if (sizeof(_Tp) == 4 && std::abs(y) > 5) {
+      continue;
+    }
+    SGLTY_CHECK(PowUlps(xs, _Tp(y)) <= bound);
+  }
+
+  // Negative bases with integer exponents, and bases near one, where the
+  // rounding of `y log x` would show.
+  const std::vector<_Tp> neg = Uniform<_Tp>(-8, -0.125, n);
+  for (double y : {-5.0, -2.0, 3.0, 4.0, 16.0, 23.0}) {
+    SGLTY_CHECK(PowUlps(neg, _Tp(y)) <= bound);
+  }
+  const std::vector<_Tp> near = Uniform<_Tp>(0.99, 1.01, n);
+  for (double y : {-1000.5, 0.3, 1000.5}) {
+    SGLTY_CHECK(PowUlps(near, _Tp(y)) <= bound);
+  }
+}
+
+template <typename _Tp>
+void CheckSpecial() {
+  constexpr _Tp inf = std::numeric_limits<_Tp>::infinity();
+  constexpr _Tp nan = std::numeric_limits<_Tp>::quiet_NaN();
+
+  struct Case {
+    _Tp x;
+    _Tp y;
+  };
+  const Case cases[] = {
+      {-2, 3},       {-2, 2},      {-2, -3},    {3, -2},     {10, -1},
+      {-inf, 0.5},   {-inf, 1.5},  {-inf, 3},   {-inf, -3},  {-inf, -2},
+      {inf, -0.5},   {inf, 0.5},   {-0.0, -3},  {-0.0, 3},   {-0.0, 0.5},
+      {-0.0, -0.5},  {0, -2},      {0, 2},      {-1, inf},   {-1, -inf},
+      {0.5, -inf},   {0.5, inf},   {2, inf},    {2, -inf},   {-2, -inf},
+      {1, nan},      {nan, 0},     {nan, 1},    {2, nan},    {-2, 0.5},
+      {-0.5, 1.5},   {-1, 0.5},    {0, 0},      {-inf, 0},   {1, -inf},
+  };
+  for (const Case& c : cases) {
+    const _Tp ref = std::pow(c.x, c.y);
+    _Tp bulk;
+    Kernel::Pow::Apply(&c.x, &bulk, 1, c.y);
+    SGLTY_CHECK(Same(Kernel::Pow{}(c.x, c.y), ref));
+    SGLTY_CHECK(Same(bulk, ref));
+  }
+
+  // Subnormal bases.
+  const _Tp tiny = std::numeric_limits<_Tp>::denorm_min() * 12345;
+  SGLTY_CHECK(Ulps<_Tp>(Kernel::Pow{}(tiny, _Tp(0.5)),
+                        std::pow((long double)tiny, 0.5L)) <= 1);
+
+  SGLTY_CHECK(Same(Kernel::Exp{}(-inf), _Tp(0)));
+  SGLTY_CHECK(Same(Kernel::Exp{}(inf), inf));
+  SGLTY_CHECK(Same(Kernel::Exp{}(nan), nan));
+  SGLTY_CHECK(Same(Kernel::Log{}(_Tp(0)), -inf));
+  SGLTY_CHECK(Same(Kernel::Log{}(_Tp(-1)), nan));
+  SGLTY_CHECK(Same(Kernel::Log{}(inf), inf));
+  SGLTY_CHECK(Same(Kernel::Tanh{}(-inf), _Tp(-1)));
+  SGLTY_CHECK(Same(Kernel::Sqrt{}(_Tp(-0.0)), _Tp(-0.0)));
+  SGLTY_CHECK(Same(Kernel::Abs{}(_Tp(-0.0)), _Tp(0)));
+}
+
+}  // namespace
+
+int main() {
+  CheckAccuracy<float>();
+  CheckAccuracy<double>();
+  CheckPowAccuracy<float>();
+  CheckPowAccuracy<double>();
+  CheckSpecial<float>();
+  CheckSpecial<double>();
+  return Test::Report();
+}
+
+// Tests/Math.cpp
@@ -0,0 +1,317 @@
+// Core matrix behavior: construction, element access, arithmetic and the
+// trait layer, in constant evaluation and at runtime.
+
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Singularity/Lib.hpp"
+#include "Singularity/Convenience.hpp"
+#include "Singularity/Core/Heap.hpp"
+#include "Singularity/Core/Map.hpp"
+#include "Singularity/Core/Shared.hpp"
+#include "Singularity/Op/Alg/Det.hpp"
+#include "Singularity/Op/Alg/Inv.hpp"
+#include "Singularity/Types/Batch.hpp"
+#include "Check.hpp"
+
+namespace {
+
+using namespace Sglty;
+using Core::Major;
+
+static_assert(Traits::Core::is_valid_v<Core::Dense<int, 2, 3, Major::Row>>);
+static_assert(Traits::Core::is_valid_v<
+              Core::Heap<float, 4, 4, Major::Col, Mem::Allocator<float>>>);
+static_assert(!Traits::Core::is_valid_v<int>);
+static_assert(Traits::Expr::is_valid_v<decltype(DenseMat<int, 2, 2>() +
+                                                 DenseMat<int, 2, 2>())>);
+
+// The README example, in constant evaluation.
+constexpr bool ReadmeExample() {
+  constexpr DenseMat<float, 2, 3>           a(1);
+  constexpr DenseMat<int, 3, 2, Major::Col> b(2);
+
+  constexpr DenseMat<int, 2, 2> x = a.Cast<int>() * b.Reorder<Major::Row>();
+  return x(0, 0) == 6 && x(0, 1) == 6 && x(1, 0) == 6 && x(1, 1) == 6;
+}
+static_assert(ReadmeExample());
+
+template <typename _matrix>
+_matrix Ramp(int _scale) {
+  _matrix m;
+  for (std::size_t i = 0; i < _matrix::rows; i++) {
+    for (std::size_t j = 0; j < _matrix::cols; j++) {
+      m(i, j) = typename _matrix::value_type(int(i * 7 + j * 3) % 11 * _scale);
+    }
+  }
+  return m;
+}
+
+template <typename _lhs, typename _rhs>
+auto NaiveProduct(const _lhs& _l, const _rhs& _r) {
+  DenseMat<double, _lhs::rows, _rhs::cols> out;
+  for (std::size_t i = 0; i < _lhs::rows; i++) {
+    for (std::size_t j = 0; j < _rhs::cols; j++) {
+      double sum = 0;
+      for (std::size_t k = 0; k < _lhs::cols; k++) {
+        sum += double(_l(i, k)) * double(_r(k, j));
+      }
+      out(i, j) = sum;
+    }
+  }
+  return out;
+}
+
+template <typename _lhs, typename _rhs>
+void CheckArithmetic() {
+  const auto a = Ramp<_lhs>(1);
+  const auto b = Ramp<_rhs>(2);
+
+  const _lhs sum = a + b;
+  const _lhs dif = a - b;
+  const _lhs neg = -a;
+  const _lhs scl = a * typename _lhs::value_type(3);
+  bool ok = true;
+  for (std::size_t i = 0; i < _lhs::rows; i++) {
+    for (std::size_t j = 0; j < _lhs::cols; j++) {
+      ok = ok && sum(i, j) == a(i, j) + b(i, j) &&
+           dif(i, j) == a(i, j) - b(i, j) && neg(i, j) == -a(i, j) &&
+           scl(i, j) == a(i, j) * 3;
+    }
+  }
+  SGLTY_CHECK(ok);
+
+  const auto prod = Expr::Evaluate(a * Op::Alg::Trp(b));
+  SGLTY_CHECK(Test::Near(prod, NaiveProduct(a, Op::Alg::Trp(b)), 1e-6));
+
+  _lhs acc = a;
+  acc += b;
+  acc -= a;
+  SGLTY_CHECK(Test::Equal(acc, b));
+}
+
+void CheckMixedMajors() {
+  const auto a = Ramp<HeapMat<float, 40, 24>>(1);
+  const auto b = Ramp<HeapMat<float, 24, 40, Major::Col>>(2);
+
+  const HeapMat<float, 40, 40> prod = a * b.Reorder<Major::Row>();
+  SGLTY_CHECK(Test::Near(prod, NaiveProduct(a, b), 1e-6));
+
+  const HeapMat<float, 24, 40> sum =
+      Op::Alg::Trp(a) + b.Reorder<Major::Row>();
+  bool ok = true;
+  for (std::size_t i = 0; i < 24; i++) {
+    for (std::size_t j = 0; j < 40; j++) {
+      ok = ok && sum(i, j) == a(j, i) + b(i, j);
+    }
+  }
+  SGLTY_CHECK(ok);
+}
+
+void CheckDetInv() {
+  DenseMat<double, 3, 3> m;
+  m(0, 0) = 4, m(0, 1) = 7, m(0, 2) = 2;
+  m(1, 0) = 3, m(1, 1) = 6, m(1, 2) = 1;
+  m(2, 0) = 2, m(2, 1) = 5, m(2, 2) = 3;
+
+  SGLTY_CHECK(std::abs(Op::Alg::Det(m) - 9.0) < 1e-12);
+
+  const DenseMat<double, 3, 3> inv = Op::Alg::Inv(m);
+  const DenseMat<double, 3, 3> id  = m * inv;
+  SGLTY_CHECK(Test::Near(id, DenseMat<double, 3, 3>::Identity(), 1e-12));
+}
+
+// The last block of a batch of 20 has 4 unused lanes, which are inverted as
+// identity matrices even after a subtraction zeroed them.
+void CheckBatchInv() {
+  Types::Batch<double, 3, 3, 20> m;
+  for (std::size_t k = 0; k < 20; k++) {
+    m.Set(k, Ramp<DenseMat<double, 3, 3>>(1) +
+                 DenseMat<double, 3, 3>::Identity() * double(k + 5));
+  }
+
+  const auto inv = Types::Inv(m);
+  bool       ok  = true;
+  for (std::size_t k = 0; k < 20; k++) {
+    ok = ok && Test::Near(inv.Get(k), Op::Alg::Inv(m.Get(k)), 1e-12);
+  }
+  SGLTY_CHECK(ok);
+
+  const auto zero = Types::Inv(m - m);
+  const auto& pad = zero.Block(2);
+  for (std::size_t k = 20 % 8; k < 8; k++) {
+    ok = ok && pad(0, 0)[k] == 1 && pad(1, 1)[k] == 1 && pad(0, 1)[k] == 0;
+  }
+  SGLTY_CHECK(ok);
+}
+
+// `Expr::Simplify()` rewrites the type of an expression, not its value.
+void CheckSimplify() {
+  using M = HeapMat<double, 24, 24>;
+  using Op::Alg::Trp;
+
+  const auto a = Ramp<M>(1);
+  const auto b = Ramp<M>(2);
+
+  static_assert(std::is_same_v<decltype(Expr::Simplify(Trp(Trp(a)))),
+                               const M&>);
+  static_assert(std::is_same_v<decltype(Expr::Simplify(-(-a))), const M&>);
+  static_assert(
+      std::is_same_v<Expr::Impl::Simplified<decltype(Trp(a * b))>,
+                     Expr::Binary<Expr::Unary<M, Expr::Trp>,
+                                  Expr::Unary<M, Expr::Trp>,
+                                  Expr::MulMatrix>>);
+  static_assert(
+      std::is_same_v<Expr::Impl::Simplified<decltype((a * 2.0) * 3.0)>,
+                     Expr::Binary<M, double, Expr::MulScalar>>);
+
+  SGLTY_CHECK(Test::Equal(Expr::Evaluate(Trp(Trp(a)) + -(-b)),
+                          Expr::Evaluate(a + b)));
+  SGLTY_CHECK(Test::Equal(Expr::Evaluate(Trp(a * b)),
+                          NaiveProduct(Trp(b), Trp(a))));
+  SGLTY_CHECK(Test::Equal(Expr::Evaluate((a * 2.0) * 3.0),
+                          Expr::Evaluate(a * 6.0)));
+  SGLTY_CHECK(Test::Equal(Expr::Evaluate((a * 2.0) * (b * 0.5)),
+                          NaiveProduct(a, b)));
+}
+
+// A repeated product is evaluated once only when its leaves are equal; the
+// result is the same either way.
+void CheckSharedSubexpressions() {
+  using M = HeapMat<double, 24, 24>;
+  using Op::Alg::Trp;
+
+  const auto a = Ramp<M>(1);
+  const auto b = Ramp<M>(2);
+  const auto c = Ramp<M>(3);
+  const M    ab = NaiveProduct(a, b);
+  const M    ac = NaiveProduct(a, c);
+
+  static_assert(Expr::Impl::has_shared_v<decltype(a * b + Trp(a * b))>);
+  static_assert(!Expr::Impl::has_shared_v<decltype(a + Trp(a))>);
+
+  SGLTY_CHECK(Test::Equal(Expr::Evaluate(a * b + Trp(a * b)),
+                          Expr::Evaluate(ab + Trp(ab))));
+  SGLTY_CHECK(Test::Equal(Expr::Evaluate(a * b + Trp(a * c)),
+                          Expr::Evaluate(ab + Trp(ac))));
+
+  // Equal copies are shared too.
+  const M copy = a;
+  SGLTY_CHECK(Test::Equal(Expr::Evaluate(a * b - copy * b), M(0.0)));
+}
+
+// Copies of a moved-from heap matrix have no storage and can be assigned to.
+void CheckMovedFrom() {
+  HeapMat<float, 8, 8> a(1.f);
+  const HeapMat<float, 8, 8> b = std::move(a);
+
+  HeapMat<float, 8, 8> c = a;
+  c = b;
+  SGLTY_CHECK(Test::Equal(c, b));
+
+  HeapMat<float, 8, 8> d(2.f);
+  d = a;
+  d = b;
+  SGLTY_CHECK(Test::Equal(d, b));
+}
+
+// Views whose storage the assigned expression also reads. Large sizes take
+// the transpose and product kernels.
+template <std::size_t _n>
+void CheckAliasing() {
+  using View = MapMat<float, _n, _n>;
+
+  std::vector<float> buffer((_n + 1) * _n);
+  View m(buffer.data());
+  View shifted(buffer.data() + _n);  // starts one row into `m`
+  const auto a = Ramp<HeapMat<float, _n, _n>>(1);
+
+  m = a;
+  m = Op::Alg::Trp(m);
+  SGLTY_CHECK(Test::Equal(m, Op::Alg::Trp(a)));
+
+  m = a;
+  m = m + Op::Alg::Trp(m);
+  SGLTY_CHECK(Test::Equal(m, Expr::Evaluate(a + Op::Alg::Trp(a))));
+
+  m = a;
+  m = m * m;
+  SGLTY_CHECK(Test::Near(m, NaiveProduct(a, a), 1e-6));
+
+  m = a;
+  shifted = m * 2.0f;
+  SGLTY_CHECK(Test::Equal(shifted, Expr::Evaluate(a * 2.0f)));
+
+  // Reading each element just before writing it is safe in place.
+  m = a;
+  m = m * 2.0f + m;
+  SGLTY_CHECK(Test::Equal(m, Expr::Evaluate(a * 3.0f)));
+}
+
+// Heap-backed leaves are held by reference, so assigning an expression over
+// a matrix to that matrix goes through the aliasing checks.
+void CheckReferencedLeaves() {
+  static_assert(std::is_reference_v<Expr::operand_t<HeapMat<float, 4, 4>>>);
+  static_assert(!std::is_reference_v<Expr::operand_t<DenseMat<float, 4, 4>>>);
+
+  const auto a = Ramp<HeapMat<float, 64, 64>>(1);
+  const auto b = Ramp<HeapMat<float, 64, 64>>(2);
+  const auto e = a + b;
+  SGLTY_CHECK(&e._l == &a && &e._r == &b);
+
+  HeapMat<float, 64, 64> h = a;
+  h = Op::Alg::Trp(h);
+  SGLTY_CHECK(Test::Equal(h, Op::Alg::Trp(a)));
+
+  h = a;
+  h = h + Op::Alg::Trp(h);
+  SGLTY_CHECK(Test::Equal(h, Expr::Evaluate(a + Op::Alg::Trp(a))));
+
+  // `s` shares its buffer with `t` and reads it while being assigned.
+  SharedMat<float, 64, 64>       s = a;
+  const SharedMat<float, 64, 64> t = s;
+  s = s + s;
+  SGLTY_CHECK(Test::Equal(s, Expr::Evaluate(a + a)));
+  SGLTY_CHECK(Test::Equal(t, a));
+}
+
+// A shared matrix overwritten by an expression gets a fresh buffer without
+// copying or clearing the old one; copies of it compare equal by address.
+void CheckSharedDiscard() {
+  const auto a = Ramp<SharedMat<float, 32, 32>>(1);
+  const auto b = Ramp<SharedMat<float, 32, 32>>(2);
+
+  SharedMat<float, 32, 32>       s = a;
+  const SharedMat<float, 32, 32> t = s;
+  SGLTY_CHECK(Expr::Impl::SameLeaf(s, t));
+
+  s = b * 2.0f;
+  SGLTY_CHECK(Test::Equal(s, Expr::Evaluate(b * 2.0f)));
+  SGLTY_CHECK(Test::Equal(t, a));
+  SGLTY_CHECK(std::as_const(s).Data() != t.Data());
+}
+
+}  // namespace
+
+int main() {
+  CheckArithmetic<DenseMat<int, 5, 7>, DenseMat<int, 5, 7>>();
+  CheckArithmetic<DenseMat<float, 9, 4>, DenseMat<float, 9, 4>>();
+  CheckArithmetic<HeapMat<double, 33, 17>, HeapMat<double, 33, 17>>();
+  CheckArithmetic<HeapMat<float, 96, 80, Major::Col>,
+                  HeapMat<float, 96, 80, Major::Col>>();
+  CheckMixedMajors();
+  CheckDetInv();
+  CheckBatchInv();
+  CheckSimplify();
+  CheckSharedSubexpressions();
+  CheckMovedFrom();
+  CheckAliasing<6>();
+  CheckAliasing<64>();
+  CheckReferencedLeaves();
+  CheckSharedDiscard();
+
+  return Test::Report();
+}
+
+// Tests/Matrix.cpp
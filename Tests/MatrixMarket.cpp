@@ -0,0 +1,111 @@
+// MatrixMarket reading and writing.
+
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include "Singularity/Lib.hpp"
+#include "Singularity/Convenience.hpp"
+#include "Singularity/IO/MatrixMarket.hpp"
+#include "Check.hpp"
+
+namespace {
+
+using namespace Sglty;
+
+const char* const skew_file =
+    "%%MatrixMarket matrix coordinate integer skew-symmetric\n"
+    "3 3 2\n"
+    "2 1 5\n"
+    "3 2 -7\n";
+
+template <typename _matrix>
+bool Reads(const char* _text, _matrix& _m) {
+  std::istringstream in(_text);
+  try {
+    IO::ReadMatrixMarket(in, _m);
+    return true;
+  } catch (const std::runtime_error&) {
+    return false;
+  }
+}
+
+void CheckSkewSymmetric() {
+  DenseMat<int, 3, 3> m;
+  SGLTY_CHECK(Reads(skew_file, m));
+  SGLTY_CHECK(m(1, 0) == 5 && m(0, 1) == -5);
+  SGLTY_CHECK(m(2, 1) == -7 && m(1, 2) == 7);
+  SGLTY_CHECK(m(0, 0) == 0 && m(2, 0) == 0);
+
+  DenseMat<double, 3, 3> d;
+  SGLTY_CHECK(Reads(skew_file, d));
+  SGLTY_CHECK(d(0, 1) == -5.0);
+
+  // The mirrored entries cannot be represented.
+  DenseMat<std::uint32_t, 3, 3> u;
+  SGLTY_CHECK(!Reads(skew_file, u));
+}
+
+void CheckSymmetricUnsigned() {
+  DenseMat<std::uint8_t, 2, 2> m;
+  SGLTY_CHECK(Reads("%%MatrixMarket matrix coordinate integer symmetric\n"
+                    "2 2 2\n1 1 3\n2 1 4\n",
+                    m));
+  SGLTY_CHECK(m(0, 0) == 3 && m(1, 0) == 4 && m(0, 1) == 4 && m(1, 1) == 0);
+}
+
+// Only the standard fields are accepted, and `pattern` only for coordinates.
+void CheckFields() {
+  DenseMat<double, 2, 2> m;
+  const auto reads = [&](const std::string& _format, const char* _field) {
+    std::string body = "2 2 1\n2 1 7\n";
+    if (_format == "array") {
+      body = "2 2\n1\n2\n3\n4\n";
+    } else if (std::string(_field) == "pattern") {
+      body = "2 2 1\n2 1\n";
+    }
+    return Reads(("%%MatrixMarket matrix " + _format + " " + _field +
+                  " general\n" + body)
+                     .c_str(),
+                 m);
+  };
+
+  SGLTY_CHECK(reads("array", "real") && m(1, 0) == 2 && m(0, 1) == 3);
+  SGLTY_CHECK(reads("array", "integer") && m(1, 1) == 4);
+  SGLTY_CHECK(reads("coordinate", "REAL") && m(1, 0) == 7 && m(0, 0) == 0);
+  SGLTY_CHECK(reads("coordinate", "pattern") && m(1, 0) == 1);
+  SGLTY_CHECK(!reads("array", "pattern"));
+  SGLTY_CHECK(!reads("array", "double"));
+  SGLTY_CHECK(!reads("coordinate", "double"));
+  SGLTY_CHECK(!reads("coordinate", "complex"));
+  SGLTY_CHECK(!reads("coordinate", ""));
+}
+
+void CheckRoundTrip() {
+  using M = DenseMat<float, 5, 4, Core::Major::Col>;
+
+  const M src = M::Iota(0.5f);
+  std::ostringstream out;
+  IO::WriteMatrixMarket(out, src);
+
+  M back;
+  SGLTY_CHECK(Reads(out.str().c_str(), back));
+  SGLTY_CHECK(Test::Equal(back, src));
+
+  DenseMat<float, 4, 5> wrong;
+  SGLTY_CHECK(!Reads(out.str().c_str(), wrong));
+}
+
+}  // namespace
+
+int main() {
+  CheckSkewSymmetric();
+  CheckSymmetricUnsigned();
+  CheckFields();
+  CheckRoundTrip();
+
+  return Test::Report();
+}
+
+// Tests/MatrixMarket.cpp
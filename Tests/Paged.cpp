@@ -0,0 +1,239 @@
+// Mem::PagedAllocator and Mem::PagedResource: storage of heap-backed
+// matrices, alignment, first-touch initialization and the fallbacks when huge
+// pages or NUMA placement are unavailable.
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <type_traits>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#if defined(__linux__)
+#include <linux/filter.h>
+#include <linux/seccomp.h>
+#include <sys/prctl.h>
+#include <sys/syscall.h>
+#endif
+
+#include "Singularity/Lib.hpp"
+#include "Singularity/Convenience.hpp"
+#include "Singularity/Core/Heap.hpp"
+#include "Singularity/Mem/Paged.hpp"
+#include "Check.hpp"
+
+namespace {
+
+using namespace Sglty;
+using Core::Major;
+using Mem::Numa;
+using Mem::Pages;
+
+template <Pages _pages, Numa _numa, Major _major = Major::Row>
+using PagedMat =
+    Types::Matrix<Core::Heap<float,
+                             300,
+                             200,
+                             _major,
+                             Mem::PagedAllocator<float, _pages, _numa>>>;
+
+bool Aligned(const void* _p, std::size_t _alignment) {
+  return reinterpret_cast<std::uintptr_t>(_p) % _alignment == 0;
+}
+
+// Whether every element equals `_v`.
+template <typename _matrix>
+bool Filled(const _matrix& _m, float _v) {
+  for (std::size_t i = 0; i < _matrix::rows; i++) {
+    for (std::size_t j = 0; j < _matrix::cols; j++) {
+      if (_m(i, j) != _v) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Matrices take their storage from the policy's pool, give it back when
+// destroyed, and reuse it for the next matrix of the same size.
+template <Pages _pages, Numa _numa>
+void CheckHeap() {
+  using M         = PagedMat<_pages, _numa>;
+  using allocator = Mem::PagedAllocator<float, _pages, _numa>;
+  Mem::Pool& pool = Mem::PagedPool<_pages, _numa>();
+
+  const std::size_t before = pool.Stats().system_allocations;
+  {
+    M a(2.0f);
+    M b;
+    SGLTY_CHECK(Aligned(a.Data(), Mem::Pool::alignment));
+    SGLTY_CHECK(Aligned(b.Data(), Mem::Pool::alignment));
+    SGLTY_CHECK(Filled(a, 2.0f));
+    SGLTY_CHECK(pool.Stats().in_use >= 2 * sizeof(float) * M::rows * M::cols);
+
+    b = a * 3.0f;
+    SGLTY_CHECK(Filled(b, 6.0f));
+
+    // Results of other majors and value types keep the allocator.
+    const auto c = Evaluate(b.template Reorder<Major::Col>());
+    using result = typename std::decay_t<decltype(c)>::core_impl;
+    static_assert(
+        std::is_same_v<typename result::allocator_type, allocator>);
+    SGLTY_CHECK(Test::Equal(c, b));
+  }
+  SGLTY_CHECK(pool.Stats().in_use == 0);
+
+  const std::size_t mapped = pool.Stats().system_allocations;
+  SGLTY_CHECK(mapped > before);
+  {
+    M again(1.0f);
+    SGLTY_CHECK(Filled(again, 1.0f));
+    SGLTY_CHECK(pool.Stats().system_allocations == mapped);
+  }
+}
+
+// First-touch storage is value-initialized in parallel, in either major.
+void CheckFirstTouch() {
+  static_assert(Mem::parallel_first_touch_v<
+                Mem::PagedAllocator<float, Pages::Default, Numa::FirstTouch>>);
+  static_assert(!Mem::parallel_first_touch_v<
+                Mem::PagedAllocator<float, Pages::Default, Numa::Interleave>>);
+
+  const PagedMat<Pages::Default, Numa::FirstTouch> row;
+  const PagedMat<Pages::Default, Numa::FirstTouch, Major::Col> col;
+  SGLTY_CHECK(Filled(row, 0.0f) && Filled(col, 0.0f));
+}
+
+// Mappings are rounded up to whole pages of the policy and aligned to them.
+void CheckResource() {
+  const std::size_t page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+  const std::size_t huge = std::size_t(2) << 20;
+
+  Mem::PagedResource regular(Pages::Default, Numa::Default);
+  void* p = regular.allocate(1, 64);
+  void* q = regular.allocate(page + 1, page);
+  SGLTY_CHECK(Aligned(p, page) && Aligned(q, page));
+  SGLTY_CHECK(regular.Stats().in_use == 3 * page);
+  SGLTY_CHECK(regular.Stats().system_allocations == 2);
+  static_cast<char*>(q)[2 * page - 1] = 1;
+  regular.deallocate(p, 1, 64);
+  regular.deallocate(q, page + 1, page);
+  SGLTY_CHECK(regular.Stats().in_use == 0);
+  SGLTY_CHECK(regular.Stats().peak == 3 * page);
+
+  // Stricter alignments than a page cannot be served.
+  bool thrown = false;
+  try {
+    (void)regular.allocate(page, 2 * page);
+  } catch (const std::bad_alloc&) {
+    thrown = true;
+  }
+  SGLTY_CHECK(thrown);
+
+  Mem::PagedResource transparent(Pages::Transparent, Numa::Default);
+  p = transparent.allocate(huge + 1, 64);
+  SGLTY_CHECK(Aligned(p, huge));
+  SGLTY_CHECK(transparent.Stats().in_use == 2 * huge);
+  static_cast<char*>(p)[2 * huge - 1] = 1;
+  transparent.deallocate(p, huge + 1, 64);
+
+  // Without free explicit huge pages the mapping falls back to transparent
+  // ones, which are still 2 MB aligned.
+  Mem::PagedResource explicit_huge(Pages::Huge2M, Numa::Default);
+  p = explicit_huge.allocate(huge, 64);
+  SGLTY_CHECK(Aligned(p, huge));
+  SGLTY_CHECK(explicit_huge.HugePageFallbacks() <= 1);
+  static_cast<char*>(p)[huge - 1] = 1;
+  explicit_huge.deallocate(p, huge, 64);
+  SGLTY_CHECK(explicit_huge.Stats().in_use == 0);
+}
+
+// Interleaved storage is usable whether the kernel applied the policy or
+// not; where it did, the pages carry it.
+void CheckInterleave() {
+  const std::size_t page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+
+  Mem::PagedResource resource(Pages::Default, Numa::Interleave);
+  auto* p = static_cast<char*>(resource.allocate(4 * page, 64));
+  for (std::size_t k = 0; k < 4 * page; k += page) {
+    p[k] = char(k / page);
+  }
+  SGLTY_CHECK(p[3 * page] == 3);
+
+#if defined(__linux__) && defined(SYS_get_mempolicy)
+  constexpr int mpol_interleave = 3;
+  constexpr int mpol_f_addr     = 1 << 1;
+  int mode = -1;
+  if (::syscall(SYS_get_mempolicy, &mode, nullptr, 0, p, mpol_f_addr) == 0) {
+    SGLTY_CHECK(mode == mpol_interleave);
+  }
+#endif
+  resource.deallocate(p, 4 * page, 64);
+}
+
+// With the NUMA system calls failing, as on kernels built without NUMA or in
+// restricted containers, placement is skipped and the storage still works.
+// Runs in a child process, whose system calls are filtered with seccomp.
+void CheckNumaUnavailable() {
+#if defined(__linux__) && defined(SYS_mbind) && defined(SYS_get_mempolicy)
+  const pid_t pid = ::fork();
+  if (pid == 0) {
+    sock_filter filter[] = {
+        BPF_STMT(BPF_LD | BPF_W | BPF_ABS, offsetof(seccomp_data, nr)),
+        BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, SYS_mbind, 2, 0),
+        BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, SYS_get_mempolicy, 1, 0),
+        BPF_STMT(BPF_RET | BPF_K, SECCOMP_RET_ALLOW),
+        BPF_STMT(BPF_RET | BPF_K, SECCOMP_RET_ERRNO | ENOSYS),
+    };
+    sock_fprog program = {sizeof(filter) / sizeof(filter[0]), filter};
+    if (::prctl(PR_SET_NO_NEW_PRIVS, 1, 0, 0, 0) != 0 ||
+        ::prctl(PR_SET_SECCOMP, SECCOMP_MODE_FILTER, &program) != 0) {
+      ::_exit(2);
+    }
+    if (::syscall(SYS_get_mempolicy, nullptr, nullptr, 0, nullptr, 0) == 0 ||
+        errno != ENOSYS) {
+      ::_exit(3);
+    }
+
+    bool ok = true;
+    {
+      Mem::PagedResource resource(Pages::Transparent, Numa::Interleave);
+      void* p = resource.allocate(1 << 20, 64);
+      static_cast<char*>(p)[(1 << 20) - 1] = 1;
+      resource.deallocate(p, 1 << 20, 64);
+
+      PagedMat<Pages::Default, Numa::Interleave> m(4.0f);
+      PagedMat<Pages::Default, Numa::Interleave> n = m + m;
+      ok = Filled(n, 8.0f);
+    }
+    ::_exit(ok ? 0 : 1);
+  }
+
+  int status = 0;
+  SGLTY_CHECK(pid > 0 && ::waitpid(pid, &status, 0) == pid);
+  // Status 2: seccomp is not available here, so there is nothing to check.
+  SGLTY_CHECK(WIFEXITED(status) &&
+              (WEXITSTATUS(status) == 0 || WEXITSTATUS(status) == 2));
+#endif
+}
+
+}  // namespace
+
+int main() {
+  // Before any thread exists, so the child process is safe to use.
+  CheckNumaUnavailable();
+
+  CheckHeap<Pages::Default, Numa::Default>();
+  CheckHeap<Pages::Transparent, Numa::Interleave>();
+  CheckHeap<Pages::Huge2M, Numa::FirstTouch>();
+  CheckFirstTouch();
+  CheckResource();
+  CheckInterleave();
+
+  return Test::Report();
+}
+
+// Tests/Paged.cpp
@@ -0,0 +1,123 @@
+// Exec::ParallelFor and the parallel evaluation overloads.
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include "Singularity/Lib.hpp"
+#include "Singularity/Convenience.hpp"
+#include "Singularity/Core/Heap.hpp"
+#include "Singularity/Exec/Evaluate.hpp"
+#include "Check.hpp"
+
+namespace {
+
+using namespace Sglty;
+
+// Counts the threads that ever ran a range.
+std::atomic<int> started{0};
+
+struct Started {
+  Started() {
+    started++;
+  }
+};
+
+void CheckCoverage() {
+  for (std::size_t threads : {1, 2, 3, 8, 64}) {
+    std::vector<std::atomic<int>> hits(1000);
+    Exec::ParallelFor(
+        0,
+        hits.size(),
+        [&](std::size_t lo, std::size_t hi) {
+          for (std::size_t k = lo; k < hi; k++) {
+            hits[k]++;
+          }
+        },
+        threads);
+    bool once = true;
+    for (const auto& h : hits) {
+      once = once && h == 1;
+    }
+    SGLTY_CHECK(once);
+  }
+}
+
+void CheckExceptions() {
+  bool caught = false;
+  std::atomic<int> ran{0};
+  try {
+    Exec::ParallelFor(
+        0,
+        8,
+        [&](std::size_t lo, std::size_t) {
+          ran++;
+          if (lo == 3) {
+            throw std::runtime_error("range 3");
+          }
+        },
+        8);
+  } catch (const std::runtime_error&) {
+    caught = true;
+  }
+  SGLTY_CHECK(caught);
+  SGLTY_CHECK(ran == 8);
+}
+
+void CheckNested() {
+  std::atomic<std::size_t> sum{0};
+  Exec::ParallelFor(
+      0,
+      16,
+      [&](std::size_t lo, std::size_t hi) {
+        for (std::size_t k = lo; k < hi; k++) {
+          Exec::ParallelFor(
+              0,
+              100,
+              [&](std::size_t l, std::size_t h) { sum += h - l; },
+              4);
+        }
+      },
+      4);
+  SGLTY_CHECK(sum == 1600);
+}
+
+// Workers persist: repeated calls do not keep starting threads. Runs first,
+// while the pool only holds the workers of these calls.
+void CheckPersistentWorkers() {
+  for (int k = 0; k < 200; k++) {
+    Exec::ParallelFor(
+        0,
+        64,
+        [](std::size_t, std::size_t) {
+          thread_local Started mark;
+          (void)mark;
+        },
+        4);
+  }
+  SGLTY_CHECK(started <= 4);
+}
+
+void CheckParallelAssign() {
+  using M = HeapMat<float, 256, 256>;
+  const M a = M::Random(7);
+  const M b = M::Random(8);
+
+  const M serial   = a + b * 2.0f;
+  const M parallel = Expr::Evaluate(a + b * 2.0f, Exec::Par{4});
+  SGLTY_CHECK(Test::Equal(serial, parallel));
+}
+
+}  // namespace
+
+int main() {
+  CheckPersistentWorkers();
+  CheckCoverage();
+  CheckExceptions();
+  CheckNested();
+  CheckParallelAssign();
+
+  return Test::Report();
+}
+
+// Tests/Parallel.cpp
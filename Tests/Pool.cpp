@@ -0,0 +1,61 @@
+// Mem::Pool and the per-thread pools behind Mem::LocalPool().
+
+#include <memory>
+#include <set>
+#include <thread>
+
+#include "Singularity/Lib.hpp"
+#include "Singularity/Convenience.hpp"
+#include "Singularity/Core/Heap.hpp"
+#include "Singularity/Mem/Pool.hpp"
+#include "Check.hpp"
+
+namespace {
+
+using namespace Sglty;
+
+void CheckReuse() {
+  Mem::Pool pool;
+  void* p = pool.allocate(1000, Mem::Pool::alignment);
+  pool.deallocate(p, 1000, Mem::Pool::alignment);
+  void* q = pool.allocate(900, Mem::Pool::alignment);
+  SGLTY_CHECK(p == q);
+  SGLTY_CHECK(pool.Stats().system_allocations == 1);
+  pool.deallocate(q, 900, Mem::Pool::alignment);
+  SGLTY_CHECK(pool.Stats().in_use == 0);
+}
+
+// Threads started one after another share one pool instead of each leaving
+// one behind, and a matrix outliving its thread can still be freed.
+void CheckThreadPools() {
+  std::set<Mem::Pool*> pools;
+  std::unique_ptr<HeapMat<float, 16, 16>> kept[32];
+  for (int t = 0; t < 32; t++) {
+    std::thread([&] {
+      pools.insert(&Mem::LocalPool());
+      kept[t] = std::make_unique<HeapMat<float, 16, 16>>(float(t));
+    }).join();
+  }
+  SGLTY_CHECK(pools.size() == 1);
+
+  bool ok = true;
+  for (int t = 0; t < 32; t++) {
+    ok = ok && (*kept[t])(15, 15) == float(t);
+    kept[t].reset();
+  }
+  SGLTY_CHECK(ok);
+
+  // The blocks went back to the exited threads' pool.
+  SGLTY_CHECK((*pools.begin())->Stats().in_use == 0);
+}
+
+}  // namespace
+
+int main() {
+  CheckReuse();
+  CheckThreadPools();
+
+  return Test::Report();
+}
+
+// Tests/Pool.cpp
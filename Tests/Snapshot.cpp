@@ -0,0 +1,210 @@
+// Binary snapshots: round trips of every element type, reading across major
+// orders, parallel chunking and detection of damaged files.
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include <unistd.h>
+
+#include "Singularity/Lib.hpp"
+#include "Singularity/Convenience.hpp"
+#include "Singularity/Core/Heap.hpp"
+#include "Singularity/IO/Snapshot.hpp"
+#include "Singularity/Types/Float16.hpp"
+#include "Check.hpp"
+
+namespace {
+
+using namespace Sglty;
+using Core::Major;
+
+// Small values with runs, so `ShuffleRle` has something to shrink.
+template <typename _matrix>
+_matrix Pattern() {
+  using value_type = typename _matrix::value_type;
+
+  _matrix ret;
+  for (std::size_t i = 0; i < _matrix::rows; i++) {
+    for (std::size_t j = 0; j < _matrix::cols; j++) {
+      ret(i, j) = value_type(float((i * _matrix::cols + j) / 3 % 100));
+    }
+  }
+  return ret;
+}
+
+template <typename _matrix>
+std::string Write(const _matrix& _m, const IO::SnapshotOptions& _opt = {}) {
+  std::ostringstream out;
+  IO::WriteSnapshot(out, _m, _opt);
+  return out.str();
+}
+
+// The message of the error `ReadSnapshot()` throws, or empty.
+template <typename _matrix>
+std::string ReadError(const std::string& _bytes,
+                      _matrix& _m,
+                      const IO::SnapshotOptions& _opt = {}) {
+  std::istringstream in(_bytes);
+  try {
+    IO::ReadSnapshot(in, _m, _opt);
+    return "";
+  } catch (const std::runtime_error& e) {
+    return e.what();
+  }
+}
+
+bool Mentions(const std::string& _what, const char* _part) {
+  return _what.find(_part) != std::string::npos;
+}
+
+template <typename _Tp>
+void CheckRoundTrip() {
+  using M = DenseMat<_Tp, 6, 5>;
+
+  const M src = Pattern<M>();
+  for (IO::Compression c : {IO::Compression::None,
+                            IO::Compression::ShuffleRle}) {
+    IO::SnapshotOptions opt;
+    opt.compression = c;
+
+    M back;
+    SGLTY_CHECK(ReadError(Write(src, opt), back).empty());
+    SGLTY_CHECK(Test::Equal(back, src));
+  }
+}
+
+// A row-major file read into a column-major matrix is reordered.
+void CheckMajor() {
+  const auto src = Pattern<DenseMat<double, 7, 3, Major::Row>>();
+
+  DenseMat<double, 7, 3, Major::Col> back;
+  SGLTY_CHECK(ReadError(Write(src), back).empty());
+  SGLTY_CHECK(Test::Equal(back, src));
+
+  DenseMat<double, 3, 7, Major::Col> wrong;
+  SGLTY_CHECK(Mentions(ReadError(Write(src), wrong), "shape"));
+  DenseMat<float, 7, 3, Major::Row> narrow;
+  SGLTY_CHECK(Mentions(ReadError(Write(src), narrow), "value type"));
+}
+
+// Many chunks, encoded and decoded on several threads; the result does not
+// depend on the thread count.
+void CheckChunks() {
+  using M = HeapMat<float, 64, 48>;
+
+  const M src = Pattern<M>();
+  IO::SnapshotOptions opt;
+  opt.chunk_size = 1001;  // rounded down to 250 elements
+  opt.threads    = 4;
+
+  const std::string bytes    = Write(src, opt);
+  IO::SnapshotOptions serial = opt;
+  serial.threads = 1;
+  SGLTY_CHECK(bytes == Write(src, serial));
+
+  std::istringstream in(bytes);
+  IO::SnapshotHeader header;
+  in.read(reinterpret_cast<char*>(&header), sizeof(header));
+  SGLTY_CHECK(header.chunk_size == 1000);
+  SGLTY_CHECK(header.chunk_count == (64 * 48 + 249) / 250);
+
+  M back;
+  SGLTY_CHECK(ReadError(bytes, back, opt).empty());
+  SGLTY_CHECK(Test::Equal(back, src));
+}
+
+// Damage to the header, the chunk table or a chunk, and a short file, are
+// all reported, on a file written to disk.
+void CheckCorrupted() {
+  using M = HeapMat<std::int32_t, 32, 32>;
+
+  const std::string path =
+      "sglty_snapshot_test_" + std::to_string(::getpid()) + ".bin";
+  const M src = Pattern<M>();
+  IO::SnapshotOptions opt;
+  opt.chunk_size = 512;
+  opt.threads    = 3;
+  IO::WriteSnapshot(path, src, opt);
+
+  std::string bytes;
+  {
+    std::ifstream in(path, std::ios::binary);
+    bytes.assign(std::istreambuf_iterator<char>(in),
+                 std::istreambuf_iterator<char>());
+  }
+  M back;
+  IO::ReadSnapshot(path, back, opt);
+  SGLTY_CHECK(Test::Equal(back, src));
+
+  // 4096 bytes in chunks of 512.
+  const std::size_t table   = sizeof(IO::SnapshotHeader);
+  const std::size_t payload = table + 8 * sizeof(IO::SnapshotChunk);
+
+  std::string flipped = bytes;
+  flipped[offsetof(IO::SnapshotHeader, chunk_size)] ^= 0x01;
+  SGLTY_CHECK(Mentions(ReadError(flipped, back, opt), "chunking"));
+
+  flipped = bytes;
+  flipped[table + 3] ^= 0x10;
+  SGLTY_CHECK(Mentions(ReadError(flipped, back, opt), "header checksum"));
+
+  flipped = bytes;
+  flipped[bytes.size() - 1] ^= 0x01;
+  SGLTY_CHECK(Mentions(ReadError(flipped, back, opt), "checksum mismatch"));
+
+  flipped = bytes;
+  flipped[payload] ^= 0x01;
+  SGLTY_CHECK(!ReadError(flipped, back, opt).empty());
+
+  for (std::size_t size : {std::size_t(0),
+                           table - 1,
+                           payload - 1,
+                           bytes.size() - 1}) {
+    SGLTY_CHECK(Mentions(ReadError(bytes.substr(0, size), back, opt),
+                         "end of file"));
+  }
+
+  {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(bytes.data(), std::streamsize(bytes.size() / 2));
+  }
+  bool thrown = false;
+  try {
+    IO::ReadSnapshot(path, back, opt);
+  } catch (const std::runtime_error& e) {
+    thrown = Mentions(e.what(), "end of file");
+  }
+  SGLTY_CHECK(thrown);
+
+  std::remove(path.c_str());
+}
+
+}  // namespace
+
+int main() {
+  CheckRoundTrip<std::int8_t>();
+  CheckRoundTrip<std::uint8_t>();
+  CheckRoundTrip<std::int16_t>();
+  CheckRoundTrip<std::uint16_t>();
+  CheckRoundTrip<std::int32_t>();
+  CheckRoundTrip<std::uint32_t>();
+  CheckRoundTrip<std::int64_t>();
+  CheckRoundTrip<std::uint64_t>();
+  CheckRoundTrip<float>();
+  CheckRoundTrip<double>();
+  CheckRoundTrip<Types::Half>();
+  CheckRoundTrip<Types::BFloat16>();
+  CheckMajor();
+  CheckChunks();
+  CheckCorrupted();
+
+  return Test::Report();
+}
+
+// Tests/Snapshot.cpp
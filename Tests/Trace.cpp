@@ -0,0 +1,79 @@
+// Evaluation tracing: counters and the exported trace-event document.
+
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Singularity/Lib.hpp"
+#include "Singularity/Convenience.hpp"
+#include "Singularity/Instr/Trace.hpp"
+#include "Check.hpp"
+
+namespace {
+
+using namespace Sglty;
+
+using M = DenseMat<float, 8, 8>;
+
+void Evaluate(int _times) {
+  const M a(1.0f);
+  M b;
+  for (int k = 0; k < _times; k++) {
+    b = a + a;
+  }
+}
+
+std::set<std::string> TraceThreads(const std::string& _json) {
+  std::set<std::string> tids;
+  const std::string key = "\"tid\":";
+  for (std::size_t at = _json.find(key); at != std::string::npos;
+       at = _json.find(key, at + 1)) {
+    const std::size_t begin = at + key.size();
+    tids.insert(_json.substr(begin, _json.find(',', begin) - begin));
+  }
+  return tids;
+}
+
+}  // namespace
+
+int main() {
+  Instr::Reset();
+
+  Evaluate(2);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 3; t++) {
+    threads.emplace_back([] { Evaluate(2); });
+  }
+  for (std::thread& t : threads) {
+    t.join();
+  }
+
+  std::size_t calls = 0;
+  for (const auto& [name, counter] : Instr::Counters()) {
+    calls += counter.calls;
+  }
+  SGLTY_CHECK(calls == 8);
+
+  std::ostringstream out;
+  Instr::WriteTrace(out);
+  const std::string json = out.str();
+  SGLTY_CHECK(json.rfind("{\"traceEvents\":[", 0) == 0);
+
+  // One small, distinct track per thread.
+  SGLTY_CHECK((TraceThreads(json) ==
+               std::set<std::string>{"1", "2", "3", "4"}));
+
+  // After a reset the ids start over, for threads seen before as well.
+  Instr::Reset();
+  std::thread([] { Evaluate(1); }).join();
+  Evaluate(1);
+  std::ostringstream again;
+  Instr::WriteTrace(again);
+  SGLTY_CHECK((TraceThreads(again.str()) == std::set<std::string>{"1", "2"}));
+
+  return Test::Report();
+}
+
+// Tests/Trace.cpp
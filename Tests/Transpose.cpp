@@ -0,0 +1,79 @@
+// The transpose kernels in every `SGLTY_ISA` variant: `Trp()` and
+// `Reorder()` assignments and `Matrix::TransposeInPlace()`, over shapes that
+// leave partial blocks and over padded storage.
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Singularity/Lib.hpp"
+#include "Singularity/Convenience.hpp"
+#include "Singularity/Core/Heap.hpp"
+#include "Singularity/Core/Padded.hpp"
+#include "Check.hpp"
+
+namespace {
+
+using namespace Sglty;
+using Core::Major;
+
+template <typename _matrix>
+_matrix Ramp() {
+  _matrix m;
+  for (std::size_t i = 0; i < _matrix::rows; i++) {
+    for (std::size_t j = 0; j < _matrix::cols; j++) {
+      m(i, j) = typename _matrix::value_type(i * _matrix::cols + j);
+    }
+  }
+  return m;
+}
+
+// Whether `_t` holds the transpose of `_m`.
+template <typename _lhs, typename _rhs>
+bool IsTranspose(const _lhs& _t, const _rhs& _m) {
+  for (std::size_t i = 0; i < _lhs::rows; i++) {
+    for (std::size_t j = 0; j < _lhs::cols; j++) {
+      if (!(_t(i, j) == _m(j, i))) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+template <typename _src, typename _dst>
+void CheckTrp() {
+  const auto m = Ramp<_src>();
+  const _dst t = Op::Alg::Trp(m);
+  SGLTY_CHECK(IsTranspose(t, m));
+}
+
+template <typename _matrix>
+void CheckInPlace() {
+  const auto m = Ramp<_matrix>();
+  _matrix    t = m;
+  t.TransposeInPlace();
+  SGLTY_CHECK(IsTranspose(t, m));
+}
+
+}  // namespace
+
+int main() {
+  CheckTrp<HeapMat<float, 67, 129>, HeapMat<float, 129, 67>>();
+  CheckTrp<HeapMat<double, 40, 33>, HeapMat<double, 33, 40>>();
+  CheckTrp<PaddedMat<float, 64, 100>, PaddedMat<float, 100, 64>>();
+  CheckTrp<HeapMat<std::int16_t, 48, 80>, HeapMat<std::int16_t, 80, 48>>();
+
+  // Changing the major order is a transpose of the storage.
+  const auto row = Ramp<HeapMat<float, 70, 90>>();
+  const HeapMat<float, 70, 90, Major::Col> col = row.Reorder<Major::Col>();
+  SGLTY_CHECK(Test::Equal(col, row));
+
+  CheckInPlace<HeapMat<float, 77, 77>>();
+  CheckInPlace<HeapMat<double, 64, 64, Major::Col>>();
+  CheckInPlace<PaddedMat<float, 128, 128>>();
+  CheckInPlace<DenseMat<int, 5, 5>>();
+
+  return Test::Report();
+}
+
+// Tests/Transpose.cpp